@@ -16,13 +16,30 @@
 //
 // License: MIT
 //=============================================================================
+#include "llvm/ADT/Statistic.h"
+#include "llvm/IR/IRBuilder.h"
 #include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/PatternMatch.h"
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/PassPlugin.h"
+#include "llvm/TargetParser/Triple.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
+#include "llvm/Transforms/Utils/Local.h"
+
+// DEBUG_TYPE va definito prima di InstructionWorklist.h, che usa LLVM_DEBUG
+// nelle sue funzioni inline; PassBuilder.h lo ridefinisce e poi lo annulla,
+// quindi la definizione segue gli altri header.
+#define DEBUG_TYPE "assignement1"
+#include "llvm/Transforms/Utils/InstructionWorklist.h"
 
 using namespace llvm;
+using namespace llvm::PatternMatch;
+
+STATISTIC(NumVisited, "Istruzioni visitate dal motore a worklist");
+STATISTIC(NumRewritten, "Istruzioni riscritte dal motore a worklist");
 
 //-----------------------------------------------------------------------------
 // TestPass implementation
@@ -31,264 +48,801 @@ using namespace llvm;
 // everything in an anonymous namespace.
 namespace
 {
-  // Algebraic Identity pass
-  struct AlgIde : PassInfoMixin<AlgIde>
+  struct Combiner;
+
+  // Regola di riscrittura per un'operazione binaria con un operando costante.
+  // Le regole sono scritte per la forma "X op C"; per gli opcode commutativi
+  // la variante "C op X" viene generata automaticamente dalla tabella.
+  struct PatternRule
   {
-    // Main entry point, takes IR unit to run the pass on (&F) and the
-    // corresponding pass manager (to be queried if need be)
-    PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
+    const char *Name;
+    Instruction::BinaryOps Opcode;
+    // Condizione sul valore della costante
+    bool (*Match)(const APInt &C);
+    // Ritorna il valore che sostituisce I (le eventuali nuove istruzioni
+    // vengono inserite subito prima di I), oppure nullptr se la regola non è
+    // applicabile
+    Value *(*Rewrite)(BinaryOperator &I, Value *X, const APInt &C, Combiner &Ctx);
+    // Regole del tipo "X op C -> X op' f(C)" (oppure "-> X" se LaneConst è
+    // nullo): valgono lane per lane, quindi si applicano anche ai vettori con
+    // una costante diversa per ogni lane. Le altre regole si applicano ai
+    // vettori solo quando la costante è uno splat.
+    bool LaneWise = false;
+    Instruction::BinaryOps LaneOpcode = Instruction::BinaryOpsEnd;
+    APInt (*LaneConst)(const APInt &C) = nullptr;
+  };
+
+  // Solo per misurare il costo del dispatch (examples/bench_dispatch.sh):
+  // ogni istruzione prova tutte le regole in sequenza, come faceva la
+  // catena di dyn_cast, invece di consultare solo quelle del suo opcode
+  cl::opt<bool> LinearDispatch(
+      "combiner-linear-dispatch", cl::Hidden,
+      cl::desc("Prova tutte le regole in sequenza invece di usare l'indice "
+               "per opcode"),
+      cl::init(false));
+
+  // Tabella delle regole indicizzata per opcode: il dispatch è un accesso
+  // diretto all'array invece di una catena di dyn_cast
+  struct RuleTable
+  {
+    struct Entry
     {
-      for (auto B = F.begin(); B != F.end(); ++B)
-      {
-        for (auto I = (*B).begin(); I != (*B).end(); ++I)
+      const PatternRule *Rule;
+      // Indice dell'operando che deve essere costante
+      unsigned ConstIdx;
+    };
+    std::array<SmallVector<Entry, 4>, Instruction::BinaryOpsEnd> ByOpcode;
+    // Tutte le regole nell'ordine della tabella, per -combiner-linear-dispatch
+    SmallVector<Entry, 32> All;
+
+    RuleTable(std::initializer_list<ArrayRef<PatternRule>> RuleSets)
+    {
+      for (ArrayRef<PatternRule> Rules : RuleSets)
+        for (const PatternRule &R : Rules)
         {
-          if (runOnInstruction(*I))
+          ByOpcode[R.Opcode].push_back({&R, 1});
+          All.push_back({&R, 1});
+          // Variante con la costante come primo operando
+          if (Instruction::isCommutative(R.Opcode))
           {
-            I = I->eraseFromParent();
-            I--;
+            ByOpcode[R.Opcode].push_back({&R, 0});
+            All.push_back({&R, 0});
           }
         }
+    }
+
+    // Con -combiner-linear-dispatch ritorna tutte le regole: il chiamante
+    // deve scartare quelle di un altro opcode
+    ArrayRef<Entry> lookup(unsigned Opcode) const
+    {
+      return LinearDispatch ? ArrayRef<Entry>(All) : ArrayRef<Entry>(ByOpcode[Opcode]);
+    }
+  };
+
+  // Latenze indicative delle operazioni usate dalla sintesi della
+  // moltiplicazione per costante, per architettura
+  struct MulCostTable
+  {
+    Triple::ArchType Arch;
+    unsigned Mul;
+    // Mul su vettori (es. pmulld su x86)
+    unsigned VectorMul;
+    unsigned Shl;
+    unsigned AddSub;
+  };
+
+  const MulCostTable MulCostTables[] = {
+      {Triple::x86_64, 3, 10, 1, 1},
+      {Triple::x86, 3, 10, 1, 1},
+      {Triple::aarch64, 4, 4, 1, 1},
+      {Triple::arm, 3, 4, 1, 1},
+      {Triple::riscv64, 4, 4, 1, 1},
+      {Triple::riscv32, 4, 4, 1, 1},
+  };
+  const MulCostTable DefaultMulCosts = {Triple::UnknownArch, 3, 3, 1, 1};
+
+  cl::opt<unsigned> MulCostOverride(
+      "strred-mul-cost",
+      cl::desc("Latenza della mul usata dalla strength reduction "
+               "(0 = tabella dell'architettura del modulo)"),
+      cl::init(0));
+
+  cl::opt<bool> CombinerReport(
+      "combiner-report",
+      cl::desc("Stampa per ogni funzione le istruzioni visitate e riscritte"),
+      cl::init(false));
+
+  // Sintesi di x * C come sequenza di shift, add e sub di latenza minima
+  // (lunghezza del cammino critico; a parità di latenza vince la sequenza
+  // con meno istruzioni). Le scomposizioni vengono memorizzate per costante:
+  // il pass conserva l'oggetto tra una funzione e l'altra, quindi le
+  // costanti ripetute in un modulo vengono scomposte una sola volta.
+  class MulDecomposer
+  {
+  public:
+    enum Kind
+    {
+      Identity, // x
+      Shl,      // (x * Sub) << Shift
+      ShlAdd,   // (x << Shift) + x * Sub
+      ShlSub,   // (x << Shift) - x * Sub
+      SubX,     // x * Sub - x
+      FactorAdd, // t = x * Sub, (t << Shift) + t
+      FactorSub, // t = x * Sub, (t << Shift) - t
+    };
+
+    struct Step
+    {
+      unsigned Latency;
+      unsigned Ops;
+      Kind K;
+      APInt Sub;
+      unsigned Shift;
+    };
+
+    // Sceglie la tabella dei costi in base al target del modulo
+    void setTarget(const Module &M)
+    {
+      const MulCostTable *T = &DefaultMulCosts;
+      Triple::ArchType Arch = Triple(M.getTargetTriple()).getArch();
+      for (const MulCostTable &Entry : MulCostTables)
+        if (Entry.Arch == Arch)
+          T = &Entry;
+      // Le scomposizioni dipendono dai costi: se cambiano vanno ricalcolate
+      if (T != Costs)
+        Cache.clear();
+      Costs = T;
+    }
+
+    unsigned mulCost(bool Vector) const
+    {
+      if (MulCostOverride)
+        return MulCostOverride;
+      return Vector ? Costs->VectorMul : Costs->Mul;
+    }
+
+    // Ritorna true se la sequenza per x * C ha latenza minore della mul
+    bool isProfitable(const APInt &C, bool Vector)
+    {
+      return solve(C, mulCost(Vector)).Latency < mulCost(Vector);
+    }
+
+    // Genera la sequenza per x * C prima del punto di inserimento di B
+    Value *emit(IRBuilder<> &B, Value *X, const APInt &C)
+    {
+      Step S = Cache.find(C)->second.Best;
+      switch (S.K)
+      {
+      case Identity:
+        return X;
+      case Shl:
+        return B.CreateShl(emit(B, X, S.Sub), S.Shift);
+      case ShlAdd:
+      case ShlSub:
+      {
+        Value *Shifted = S.Shift ? B.CreateShl(X, S.Shift) : X;
+        Value *T = emit(B, X, S.Sub);
+        return S.K == ShlAdd ? B.CreateAdd(Shifted, T) : B.CreateSub(Shifted, T);
+      }
+      case SubX:
+        return B.CreateSub(emit(B, X, S.Sub), X);
+      case FactorAdd:
+      case FactorSub:
+      {
+        Value *T = emit(B, X, S.Sub);
+        Value *Shifted = B.CreateShl(T, S.Shift);
+        return S.K == FactorAdd ? B.CreateAdd(Shifted, T) : B.CreateSub(Shifted, T);
+      }
       }
-      return PreservedAnalyses::all();
+      llvm_unreachable("tipo di passo sconosciuto");
     }
 
-    bool runOnInstruction(Instruction &I)
+  private:
+    static constexpr unsigned Infinite = ~0u / 2;
+
+    struct Entry
     {
-      // Mi trovo in una moltiplicazione
-      if (MulOperator *mul = dyn_cast<MulOperator>(&I))
+      Step Best;
+      // Limite di latenza con cui è stata fatta la ricerca
+      unsigned Limit;
+    };
+
+    const MulCostTable *Costs = &DefaultMulCosts;
+    DenseMap<APInt, Entry> Cache;
+
+    void consider(Step &Best, const Step &S, unsigned Latency, unsigned Ops,
+                  Kind K, const APInt &Sub, unsigned Shift = 0)
+    {
+      if (S.Latency >= Infinite)
+        return;
+      if (Latency < Best.Latency || (Latency == Best.Latency && Ops < Best.Ops))
+        Best = {Latency, Ops, K, Sub, Shift};
+    }
+
+    // Cerca la sequenza di latenza minima tra quelle con latenza < Limit
+    // (branch and bound: la profondità è limitata dalla latenza della mul).
+    // Ogni caso ricorsivo lavora su una costante strettamente minore (come
+    // intero senza segno), quindi la ricerca termina.
+    Step solve(const APInt &C, unsigned Limit)
+    {
+      Step None = {Infinite, Infinite, Identity, C, 0};
+      auto It = Cache.find(C);
+      // Una soluzione trovata è ottima per qualsiasi limite; l'assenza di
+      // soluzioni vale solo per limiti non più larghi di quello usato
+      if (It != Cache.end() &&
+          (It->second.Best.Latency < Infinite || Limit <= It->second.Limit))
+        return It->second.Best.Latency < Limit ? It->second.Best : None;
+
+      unsigned N = C.getBitWidth();
+      unsigned Shl = Costs->Shl;
+      unsigned Op = Costs->AddSub;
+      // Limite per un sotto-problema seguito da un'operazione di costo Cost
+      auto Sub = [&](unsigned Cost) { return Limit > Cost ? Limit - Cost : 0; };
+      auto Solve = [&](const APInt &V, unsigned L) {
+        return L ? solve(V, L) : None;
+      };
+
+      Step Best = None;
+      if (C.isOne())
+        Best = {0, 0, Identity, C, 0};
+      else if (!C.isZero())
       {
-        // L'operando 0 è una costante
-        if (ConstantInt *c = dyn_cast<ConstantInt>(mul->getOperand(0)))
-        {
-          // L'operando è un 1
-          if (c->getValue() == 1)
-          {
-            mul->replaceAllUsesWith(mul->getOperand(1));
-            // ReplaceInstWithValue(mul, mul->getOperand(1));
-            return true;
-          }
-        }
-        // L'operando 1 è una costante
-        else if (ConstantInt *c = dyn_cast<ConstantInt>(mul->getOperand(1)))
+        if (!C[0])
         {
-          // L'operando è un 1
-          if (c->getValue() == 1)
-          {
-            mul->replaceAllUsesWith(mul->getOperand(0));
-            return true;
-          }
+          // Costante pari: scomponiamo la parte dispari e poi facciamo lo shift
+          unsigned TZ = (C & -C).logBase2();
+          APInt Odd = C.lshr(TZ);
+          Step S = Solve(Odd, Sub(Shl));
+          consider(Best, S, S.Latency + Shl, S.Ops + 1, Kind::Shl, Odd, TZ);
         }
-      }
-      // Mi trovo in una addizione
-      else if (AddOperator *add = dyn_cast<AddOperator>(&I))
-      {
-        // L'operando 0 è una costante
-        if (ConstantInt *c = dyn_cast<ConstantInt>(add->getOperand(0)))
+
+        // Bit più alto: x * C = (x << k) + x * (C - 2^k)
+        //           oppure x * C = (x << (k + 1)) - x * (2^(k + 1) - C)
+        unsigned K = C.logBase2();
+        APInt Pow = APInt::getOneBitSet(N, K);
+        if (C != Pow)
         {
-          // L'operando è uno 0
-          if (c->getValue() == 0)
+          APInt Lo = C - Pow;
+          Step S = Solve(Lo, Sub(Op));
+          consider(Best, S, std::max(K ? Shl : 0, S.Latency) + Op,
+                   S.Ops + (K ? 1 : 0) + 1, ShlAdd, Lo, K);
+          if (K + 1 < N)
           {
-            add->replaceAllUsesWith(add->getOperand(1));
-            return true;
+            APInt Hi = APInt::getOneBitSet(N, K + 1) - C;
+            S = Solve(Hi, Sub(Op));
+            consider(Best, S, std::max(Shl, S.Latency) + Op, S.Ops + 2, ShlSub,
+                     Hi, K + 1);
           }
         }
-        // L'operando 1 è una costante
-        else if (ConstantInt *c = dyn_cast<ConstantInt>(add->getOperand(1)))
+
+        if (C[0])
         {
-          // L'operando è uno 0
-          if (c->getValue() == 0)
+          // x * C = x * (C + 1) - x
+          if (!C.isAllOnes())
           {
-            add->replaceAllUsesWith(add->getOperand(0));
-            return true;
+            APInt Hi = C + 1;
+            Step S = Solve(Hi, Sub(Op));
+            consider(Best, S, S.Latency + Op, S.Ops + 1, SubX, Hi);
           }
-        }
-        // Mi trovo in una operazione
-      }
-      else if (BinaryOperator *ope = dyn_cast<BinaryOperator>(&I))
-      {
-        // Controllo se questa è una divisione/unsigned divisione
-        if (ope->getOpcode() == Instruction::SDiv || ope->getOpcode() == Instruction::UDiv)
-        {
-          // Controllo se l'operando 1 è una costante
-          if (ConstantInt *c = dyn_cast<ConstantInt>(ope->getOperand(1)))
+          // Costante negativa: x * C = x - x * (1 - C)
+          if (C.isNegative())
           {
-            if (c->getValue() == 1)
-            {
-              // Rimpiazzo gli usi se questa costante è uguale a 1
-              ope->replaceAllUsesWith(ope->getOperand(0));
-              return true;
-            }
+            APInt Neg = 1 - C;
+            Step S = Solve(Neg, Sub(Op));
+            consider(Best, S, S.Latency + Op, S.Ops + 1, ShlSub, Neg, 0);
           }
-          // Se non è una divisione controllo se è una sottrazione
-        }
-        else if (ope->getOpcode() == Instruction::Sub)
-        {
-          // Controllo se l'operando 1 è una costante
-          if (ConstantInt *c = dyn_cast<ConstantInt>(ope->getOperand(1)))
+          // Fattori della forma 2^k + 1 e 2^k - 1
+          for (unsigned K = 1; K < N && Limit > Shl + Op; ++K)
           {
-            // Controllo se la costante è uguale a 0
-            if (c->getValue() == 0)
+            APInt Pow = APInt::getOneBitSet(N, K);
+            for (bool Plus : {true, false})
             {
-              // Rimpiazzo tutti gli usi
-              ope->replaceAllUsesWith(ope->getOperand(0));
-              return true;
+              APInt F = Plus ? Pow + 1 : Pow - 1;
+              if (F.ule(1) || F.uge(C) || !C.urem(F).isZero())
+                continue;
+              APInt Q = C.udiv(F);
+              Step S = Solve(Q, Sub(Shl + Op));
+              consider(Best, S, S.Latency + Shl + Op, S.Ops + 2,
+                       Plus ? FactorAdd : FactorSub, Q, K);
             }
           }
         }
       }
-      return false;
+
+      Cache[C] = {Best, Limit};
+      return Best.Latency < Limit ? Best : None;
     }
-    static bool isRequired() { return true; }
   };
 
-  // Strength Reduction pass
-  struct StrRed : PassInfoMixin<StrRed>
+  // Motore di riscrittura a worklist condiviso da tutti i pass.
+  // Ogni istruzione viene visitata una volta; quando viene riscritta si
+  // rimettono in coda i suoi utilizzatori e le istruzioni appena create,
+  // così le ottimizzazioni rese possibili da una riscrittura vengono
+  // applicate nella stessa passata fino al punto fisso.
+  struct Combiner
   {
-    // Main entry point, takes IR unit to run the pass on (&F) and the
-    // corresponding pass manager (to be queried if need be)
-    PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
+    const RuleTable &Table;
+    // Sintesi delle moltiplicazioni, condivisa tra le funzioni del modulo
+    MulDecomposer *Mul;
+    InstructionWorklist Worklist;
+    unsigned Visited = 0;
+    unsigned Rewritten = 0;
+
+    Combiner(const RuleTable &T, MulDecomposer *M = nullptr) : Table(T), Mul(M) {}
+
+    // Applica la regola a "X op COp"; COp può essere una costante intera, uno
+    // splat oppure (per le regole lane per lane) un vettore di costanti
+    Value *applyRule(const PatternRule &R, BinaryOperator &I, Value *X, Value *COp)
     {
-      for (auto B = F.begin(); B != F.end(); ++B)
+      const APInt *C;
+      if (match(COp, m_APInt(C)))
+        return R.Match(*C) ? R.Rewrite(I, X, *C, *this) : nullptr;
+
+      auto *CV = dyn_cast<ConstantDataVector>(COp);
+      if (!R.LaneWise || !CV)
+        return nullptr;
+      SmallVector<Constant *, 16> Lanes;
+      for (unsigned i = 0, e = CV->getNumElements(); i != e; ++i)
       {
-        for (auto I = (*B).begin(); I != (*B).end(); ++I)
-        {
-          if (runOnInstruction(*I))
-          {
-            I = I->eraseFromParent();
-            I--;
-          }
-        }
+        APInt Lane = CV->getElementAsAPInt(i);
+        if (!R.Match(Lane))
+          return nullptr;
+        if (R.LaneConst)
+          Lanes.push_back(ConstantInt::get(CV->getElementType(), R.LaneConst(Lane)));
       }
-      return PreservedAnalyses::all();
+      if (!R.LaneConst)
+        return X;
+      Instruction *New = BinaryOperator::Create(R.LaneOpcode, X, ConstantVector::get(Lanes));
+      New->insertBefore(&I);
+      return New;
     }
 
-    bool runOnInstruction(Instruction &I)
+    // Applica la prima regola che riesce a riscrivere I
+    bool visit(Instruction &I)
     {
-      // Mi trovo in una moltiplicazione
-      if (MulOperator *mul = dyn_cast<MulOperator>(&I))
-      {
-        // Controllo il valore del primo operando
-        if (ConstantInt *c = dyn_cast<ConstantInt>(mul->getOperand(0)))
-        {
-          // Controllo se è una potenza di 2
-          if (c->getValue().isPowerOf2())
-          {
-            // Calcoliamo il log
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2());
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(1), shift_val);
-            // Inseriamo e rimuoviamo l'istruzione NON ottimizzata
-            shift->insertBefore(&I);
-            I.replaceAllUsesWith(shift);
-            return true;
-          }
-          // Controllo se siamo a disstanza -1 da potenza di 2 più vicina
-          else if ((c->getValue() + 1).isPowerOf2())
-          {
-            // Calcoliamo il log addizionato di 1
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2() + 1);
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(1), shift_val);
-            // Inseriamo l'istruzione
-            shift->insertBefore(&I);
-            // Creiamo l'istruzione finale
-            Instruction *sub = BinaryOperator::Create(Instruction::Sub, shift, mul->getOperand(1));
-            // Inseriamo l'istruzione di add
-            sub->insertBefore(&I);
-            // Rimuoviamo l'istruzione NON ottimizzata
-            I.replaceAllUsesWith(sub);
-
-            return true;
-          }
-          // Controllo se siamo a distanza +1 da potenza di 2 più vicina
-          else if ((c->getValue() - 1).isPowerOf2())
-          {
-            // Calcoliamo il log
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2());
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(1), shift_val);
-            // Inseriamo l'istruzione
-            shift->insertBefore(&I);
-            // Creiamo l'istruzione finale
-            Instruction *add = BinaryOperator::Create(Instruction::Add, shift, mul->getOperand(1));
-            // Inseriamo l'istruzione di sub
-            add->insertBefore(&I);
-            // Rimuoviamo l'istruzione NON ottimizzata
-            I.replaceAllUsesWith(add);
-            return true;
-          }
-        }
-        // Controllo il valore del secondo operando
-        if (ConstantInt *c = dyn_cast<ConstantInt>(mul->getOperand(1)))
-        {
-          // Controllo se è una potenza di 2
-          if (c->getValue().isPowerOf2())
-          {
-            // Calcoliamo il log
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2());
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(0), shift_val);
-            // Inseriamo l'istruzione e rimuoviamo quella NON ottimizzata
-            shift->insertBefore(&I);
-            I.replaceAllUsesWith(shift);
-            return true;
-          }
-          else if ((c->getValue() + 1).isPowerOf2())
-          {
-            // Calcoliamo il log addizionato di 1
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2() + 1);
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(0), shift_val);
-            // Inseriamo e rimuoviamo l'istruzione NON ottimizzata
-            shift->insertBefore(&I);
-            // Creiamo l'istruzione finale
-            Instruction *sub = BinaryOperator::Create(Instruction::Sub, shift, mul->getOperand(0));
-            // Inseriamo l'istruzione di add
-            sub->insertBefore(&I);
-            I.replaceAllUsesWith(sub);
-            return true;
-          }
-          else if ((c->getValue() - 1).isPowerOf2())
-          {
-            // Calcoliamo il log
-            Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2());
-            // Creiamo l'istruzione
-            Instruction *shift = BinaryOperator::Create(Instruction::Shl, mul->getOperand(0), shift_val);
-            // Inseriamo l'istruzione
-            shift->insertBefore(&I);
-            // Creiamo l'istruzione finale
-            Instruction *add = BinaryOperator::Create(Instruction::Add, shift, mul->getOperand(0));
-            // Inseriamo l'istruzione di add
-            add->insertBefore(&I);
-            // Rimuoviamo l'istruzione NON ottimizzata
-            I.replaceAllUsesWith(add);
-            return true;
-          }
-        }
-        // Mi trovo in una operazione
-        else if (BinaryOperator *div = dyn_cast<BinaryOperator>(&I))
-        {
-          // Controllo se è una divisione
-          if (div->getOpcode() != Instruction::SDiv && div->getOpcode() != Instruction::UDiv)
-            return false;
-          // Controllo il primo operando
-          else if (ConstantInt *c = dyn_cast<ConstantInt>(div->getOperand(1)))
-          {
-            // Controllo se l'operando è una potenza di 2
-            if (c->getValue().isPowerOf2())
-            {
-              Value *shift_val = ConstantInt::get(c->getType(), c->getValue().logBase2());
-              Instruction *shift = BinaryOperator::Create(Instruction::AShr, div->getOperand(0), shift_val);
-              shift->insertBefore(&I);
-              I.replaceAllUsesWith(shift);
-              return true;
-            }
-          }
-        }
+      // Non vale la pena riscrivere un valore che nessuno usa
+      BinaryOperator *BO = dyn_cast<BinaryOperator>(&I);
+      if (!BO || I.use_empty())
         return false;
+
+      // Le regole inseriscono le nuove istruzioni subito prima di I: ci
+      // segniamo il punto di partenza per poterle rimettere in coda
+      Instruction *Prev = I.getPrevNode();
+      for (const RuleTable::Entry &E : Table.lookup(BO->getOpcode()))
+      {
+        if (E.Rule->Opcode != BO->getOpcode())
+          continue;
+        Value *New = applyRule(*E.Rule, *BO, BO->getOperand(1 - E.ConstIdx),
+                               BO->getOperand(E.ConstIdx));
+        if (!New)
+          continue;
+        LLVM_DEBUG(dbgs() << E.Rule->Name << ": " << I << "\n");
+
+        // Gli utilizzatori di I potrebbero diventare semplificabili
+        for (User *U : I.users())
+          Worklist.push(cast<Instruction>(U));
+        // Anche le istruzioni create dalla regola vanno visitate
+        for (Instruction *N = Prev ? Prev->getNextNode() : &I.getParent()->front();
+             N != &I; N = N->getNextNode())
+          Worklist.push(N);
+
+        I.replaceAllUsesWith(New);
+        eraseInstruction(I);
+        ++Rewritten;
+        return true;
       }
       return false;
     }
+
+    // Rimuove I e gli operandi rimasti senza utilizzatori
+    void eraseInstruction(Instruction &I)
+    {
+      SmallVector<Value *, 2> Ops(I.operands());
+      Worklist.remove(&I);
+      I.eraseFromParent();
+      for (Value *Op : Ops)
+        RecursivelyDeleteTriviallyDeadInstructions(
+            Op, nullptr, nullptr,
+            [&](Value *V) { Worklist.remove(cast<Instruction>(V)); });
+    }
+
+    bool runOnFunction(Function &F)
+    {
+      Visited = Rewritten = 0;
+      // Inseriamo le istruzioni in ordine inverso, così vengono estratte
+      // nell'ordine in cui compaiono nella funzione
+      for (BasicBlock &B : reverse(F))
+        for (Instruction &I : reverse(B))
+          Worklist.push(&I);
+
+      while (!Worklist.isEmpty())
+      {
+        Instruction *I = Worklist.removeOne();
+        ++Visited;
+        visit(*I);
+      }
+
+      NumVisited += Visited;
+      NumRewritten += Rewritten;
+      if (CombinerReport)
+        errs() << F.getName() << ": istruzioni visitate " << Visited
+               << ", riscritte " << Rewritten << "\n";
+      return Rewritten > 0;
+    }
+
+    // Le riscritture sostituiscono solo istruzioni non terminatori, quindi il
+    // CFG (e con esso DominatorTree, LoopInfo, ...) resta valido
+    PreservedAnalyses run(Function &F)
+    {
+      if (!runOnFunction(F))
+        return PreservedAnalyses::all();
+      PreservedAnalyses PA;
+      PA.preserveSet<CFGAnalyses>();
+      return PA;
+    }
+  };
+
+  //---------------------------------------------------------------------------
+  // Condizioni sulle costanti e costruttori delle istruzioni sostitutive
+  //---------------------------------------------------------------------------
+  bool isZero(const APInt &C) { return C.isZero(); }
+  bool isOne(const APInt &C) { return C.isOne(); }
+  bool isAny(const APInt &) { return true; }
+  bool isPow2(const APInt &C) { return C.isPowerOf2(); }
+
+  // Costanti usate dalle regole lane per lane
+  APInt log2Of(const APInt &C) { return APInt(C.getBitWidth(), C.logBase2()); }
+  APInt lowMask(const APInt &C) { return C - 1; }
+
+  // Crea l'operazione binaria e la inserisce prima di I
+  Instruction *insertBinOp(Instruction::BinaryOps Op, Value *A, Value *B,
+                           Instruction &I)
+  {
+    Instruction *New = BinaryOperator::Create(Op, A, B);
+    New->insertBefore(&I);
+    return New;
+  }
+
+  // L'operazione è un'identità: il risultato è l'altro operando
+  Value *keepOperand(BinaryOperator &, Value *X, const APInt &, Combiner &) { return X; }
+
+  // x * 2^n  ->  x << n
+  Value *mulToShl(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    Value *shift_val = ConstantInt::get(X->getType(), C.logBase2());
+    return insertBinOp(Instruction::Shl, X, shift_val, I);
+  }
+
+  // x * C  ->  sequenza di shift/add/sub, se costa meno della mul
+  Value *mulToShiftAdd(BinaryOperator &I, Value *X, const APInt &C, Combiner &Ctx)
+  {
+    if (!Ctx.Mul || !Ctx.Mul->isProfitable(C, X->getType()->isVectorTy()))
+      return nullptr;
+    IRBuilder<> B(&I);
+    return Ctx.Mul->emit(B, X, C);
+  }
+
+  // x /u 2^n  ->  x >>u n
+  Value *udivToLShr(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    Value *shift_val = ConstantInt::get(X->getType(), C.logBase2());
+    return insertBinOp(Instruction::LShr, X, shift_val, I);
+  }
+
+  //---------------------------------------------------------------------------
+  // Divisione per costante tramite moltiplicazione per il "magic number"
+  // (Hacker's Delight, cap. 10): x / d  ->  mulhi(x, M) >> s con le
+  // eventuali correzioni. I numeri magici sono calcolati con APInt, quindi
+  // valgono per qualsiasi larghezza intera.
+  //---------------------------------------------------------------------------
+  struct SignedMagic
+  {
+    APInt Magic;
+    unsigned Shift;
+  };
+
+  struct UnsignedMagic
+  {
+    APInt Magic;
+    // Il magic number non sta in N bit: serve la sequenza con l'add
+    bool IsAdd;
+    unsigned Shift;
+  };
+
+  // Divisore con segno d, con |d| >= 2
+  SignedMagic computeSignedMagic(const APInt &D)
+  {
+    unsigned N = D.getBitWidth();
+    APInt SignedMin = APInt::getSignedMinValue(N);
+    APInt AD = D.abs();
+    APInt T = SignedMin + D.lshr(N - 1);
+    APInt ANC = T - 1 - T.urem(AD); // |nc|
+    unsigned P = N - 1;
+    APInt Q1 = SignedMin.udiv(ANC); // 2^p / |nc|
+    APInt R1 = SignedMin - Q1 * ANC;
+    APInt Q2 = SignedMin.udiv(AD); // 2^p / |d|
+    APInt R2 = SignedMin - Q2 * AD;
+    APInt Delta;
+    do
+    {
+      P = P + 1;
+      Q1 <<= 1;
+      R1 <<= 1;
+      if (R1.uge(ANC))
+      {
+        Q1 += 1;
+        R1 -= ANC;
+      }
+      Q2 <<= 1;
+      R2 <<= 1;
+      if (R2.uge(AD))
+      {
+        Q2 += 1;
+        R2 -= AD;
+      }
+      Delta = AD - R2;
+    } while (Q1.ult(Delta) || (Q1 == Delta && R1.isZero()));
+
+    APInt Magic = Q2 + 1;
+    if (D.isNegative())
+      Magic.negate();
+    return {Magic, P - N};
+  }
+
+  // Divisore senza segno d, con 2 <= d < 2^(N-1)
+  UnsignedMagic computeUnsignedMagic(const APInt &D)
+  {
+    unsigned N = D.getBitWidth();
+    bool IsAdd = false;
+    APInt AllOnes = APInt::getAllOnes(N);
+    APInt SignedMin = APInt::getSignedMinValue(N);
+    APInt SignedMax = APInt::getSignedMaxValue(N);
+    APInt NC = AllOnes - (AllOnes - D).urem(D);
+    unsigned P = N - 1;
+    APInt Q1 = SignedMin.udiv(NC); // 2^p / nc
+    APInt R1 = SignedMin - Q1 * NC;
+    APInt Q2 = SignedMax.udiv(D); // (2^p - 1) / d
+    APInt R2 = SignedMax - Q2 * D;
+    APInt Delta;
+    do
+    {
+      P = P + 1;
+      if (R1.uge(NC - R1))
+      {
+        Q1 = Q1 + Q1 + 1;
+        R1 = R1 + R1 - NC;
+      }
+      else
+      {
+        Q1 = Q1 + Q1;
+        R1 = R1 + R1;
+      }
+      if ((R2 + 1).uge(D - R2))
+      {
+        if (Q2.uge(SignedMax))
+          IsAdd = true;
+        Q2 = Q2 + Q2 + 1;
+        R2 = R2 + R2 + 1 - D;
+      }
+      else
+      {
+        if (Q2.uge(SignedMin))
+          IsAdd = true;
+        Q2 = Q2 + Q2;
+        R2 = R2 + R2 + 1;
+      }
+      Delta = D - 1 - R2;
+    } while (P < N * 2 && (Q1.ult(Delta) || (Q1 == Delta && R1.isZero())));
+
+    return {Q2 + 1, IsAdd, P - N};
+  }
+
+  // Parte alta del prodotto su 2N bit: (ext(x) * ext(M)) >> N
+  Value *createMulHigh(IRBuilder<> &B, Value *X, const APInt &M, bool Signed)
+  {
+    Type *Ty = X->getType();
+    unsigned N = Ty->getScalarSizeInBits();
+    Type *WideTy = Ty->getWithNewBitWidth(2 * N);
+    Value *WideX = Signed ? B.CreateSExt(X, WideTy) : B.CreateZExt(X, WideTy);
+    APInt WideM = Signed ? M.sext(2 * N) : M.zext(2 * N);
+    Value *Prod = B.CreateMul(WideX, ConstantInt::get(WideTy, WideM));
+    return B.CreateTrunc(B.CreateLShr(Prod, N), Ty);
+  }
+
+  // Quoziente di x /u d, con d >= 2
+  Value *buildUDiv(IRBuilder<> &B, Value *X, const APInt &D)
+  {
+    Type *Ty = X->getType();
+    if (D.isPowerOf2())
+      return B.CreateLShr(X, ConstantInt::get(Ty, D.logBase2()));
+    // Con il bit più alto del divisore a 1 il quoziente vale 0 oppure 1
+    if (D.isNegative())
+      return B.CreateZExt(B.CreateICmpUGE(X, ConstantInt::get(Ty, D)), Ty);
+
+    UnsignedMagic M = computeUnsignedMagic(D);
+    Value *Q = createMulHigh(B, X, M.Magic, false);
+    if (!M.IsAdd)
+      return B.CreateLShr(Q, ConstantInt::get(Ty, M.Shift));
+    // Il magic number ha N+1 bit: q = (((x - q) >> 1) + q) >> (s - 1)
+    Value *NPQ = B.CreateLShr(B.CreateSub(X, Q), ConstantInt::get(Ty, 1));
+    NPQ = B.CreateAdd(NPQ, Q);
+    return B.CreateLShr(NPQ, ConstantInt::get(Ty, M.Shift - 1));
+  }
+
+  // Quoziente di x /s d, con |d| >= 2
+  Value *buildSDiv(IRBuilder<> &B, Value *X, const APInt &D)
+  {
+    Type *Ty = X->getType();
+    unsigned N = D.getBitWidth();
+    APInt AD = D.abs();
+    Value *Q;
+    if (AD.isPowerOf2())
+    {
+      // Lo shift aritmetico arrotonda verso -inf: per i dividendi negativi
+      // aggiungiamo 2^k - 1 prima dello shift per arrotondare verso zero
+      unsigned K = AD.logBase2();
+      Value *Sign = B.CreateAShr(X, ConstantInt::get(Ty, K - 1));
+      Value *Bias = B.CreateLShr(Sign, ConstantInt::get(Ty, N - K));
+      Q = B.CreateAShr(B.CreateAdd(X, Bias), ConstantInt::get(Ty, K));
+      return D.isNegative() ? B.CreateNeg(Q) : Q;
+    }
+
+    SignedMagic M = computeSignedMagic(D);
+    Q = createMulHigh(B, X, M.Magic, true);
+    // Correzione quando il segno del magic number non è quello del divisore
+    if (D.isStrictlyPositive() && M.Magic.isNegative())
+      Q = B.CreateAdd(Q, X);
+    else if (D.isNegative() && M.Magic.isStrictlyPositive())
+      Q = B.CreateSub(Q, X);
+    if (M.Shift > 0)
+      Q = B.CreateAShr(Q, ConstantInt::get(Ty, M.Shift));
+    // Aggiungiamo 1 se il quoziente è negativo (arrotondamento verso zero)
+    Value *Sign = B.CreateLShr(Q, ConstantInt::get(Ty, N - 1));
+    return B.CreateAdd(Q, Sign);
+  }
+
+  bool isUnsignedDivisor(const APInt &C) { return C.ugt(1); }
+  bool isSignedDivisor(const APInt &C)
+  {
+    return C.getBitWidth() > 1 && !C.isZero() && !C.isOne() && !C.isAllOnes();
+  }
+  bool isSignedPow2(const APInt &C)
+  {
+    return isSignedDivisor(C) && C.abs().isPowerOf2();
+  }
+
+  // x /u d  ->  mulhi(x, M) >> s
+  Value *udivToMagic(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    IRBuilder<> B(&I);
+    return buildUDiv(B, X, C);
+  }
+
+  // x /s d  ->  shift con correzione dell'arrotondamento oppure magic number
+  Value *sdivToMagic(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    IRBuilder<> B(&I);
+    return buildSDiv(B, X, C);
+  }
+
+  // x %u 2^n  ->  x & (2^n - 1)
+  Value *uremToAnd(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    return insertBinOp(Instruction::And, X, ConstantInt::get(X->getType(), C - 1), I);
+  }
+
+  // x %u d  ->  x - (x /u d) * d
+  Value *uremToMagic(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    IRBuilder<> B(&I);
+    Value *Q = buildUDiv(B, X, C);
+    return B.CreateSub(X, B.CreateMul(Q, ConstantInt::get(X->getType(), C)));
+  }
+
+  // x %s d  ->  x - (x /s d) * d
+  Value *sremToMagic(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    IRBuilder<> B(&I);
+    Value *Q = buildSDiv(B, X, C);
+    return B.CreateSub(X, B.CreateMul(Q, ConstantInt::get(X->getType(), C)));
+  }
+
+  // Scompone V nella forma base + offset costante (b + n, n + b oppure b - n)
+  bool matchOffset(Value *V, Value *&Base, APInt &Offset)
+  {
+    const APInt *C;
+    if (match(V, m_c_Add(m_Value(Base), m_APInt(C))))
+    {
+      Offset = *C;
+      return true;
+    }
+    if (match(V, m_Sub(m_Value(Base), m_APInt(C))))
+    {
+      Offset = -*C;
+      return true;
+    }
+    return false;
+  }
+
+  // Catene di add/sub con costanti vengono ridotte a un unico offset:
+  //   a = b + n, c = a - n  ->  c = b
+  //   a = b - n, c = a + n  ->  c = b
+  //   a = b + n, c = a - m  ->  c = b + (n - m)
+  // Il motore rimette in coda gli utilizzatori di ogni istruzione riscritta,
+  // quindi una catena di k operazioni viene ridotta seguendo la catena
+  // def-use in O(k), senza scorrere il resto del blocco.
+  Value *foldOffset(BinaryOperator &I, Value *X, const APInt &C, Combiner &)
+  {
+    Value *B;
+    APInt Offset;
+    if (!matchOffset(X, B, Offset))
+      return nullptr;
+    Offset += I.getOpcode() == Instruction::Sub ? -C : C;
+    if (Offset.isZero())
+      return B;
+    return insertBinOp(Instruction::Add, B, ConstantInt::get(B->getType(), Offset), I);
+  }
+
+  //---------------------------------------------------------------------------
+  // Tabelle delle regole
+  //---------------------------------------------------------------------------
+  const PatternRule AlgIdeRules[] = {
+      {"mul-one", Instruction::Mul, isOne, keepOperand, true},
+      {"add-zero", Instruction::Add, isZero, keepOperand, true},
+      {"sub-zero", Instruction::Sub, isZero, keepOperand, true},
+      {"sdiv-one", Instruction::SDiv, isOne, keepOperand, true},
+      {"udiv-one", Instruction::UDiv, isOne, keepOperand, true},
+  };
+
+  const PatternRule StrRedRules[] = {
+      {"mul-pow2", Instruction::Mul, isPow2, mulToShl, true, Instruction::Shl, log2Of},
+      {"mul-const", Instruction::Mul, isAny, mulToShiftAdd},
+      {"udiv-pow2", Instruction::UDiv, isPow2, udivToLShr, true, Instruction::LShr, log2Of},
+      {"udiv-const", Instruction::UDiv, isUnsignedDivisor, udivToMagic},
+      {"sdiv-pow2", Instruction::SDiv, isSignedPow2, sdivToMagic},
+      {"sdiv-const", Instruction::SDiv, isSignedDivisor, sdivToMagic},
+      {"urem-pow2", Instruction::URem, isPow2, uremToAnd, true, Instruction::And, lowMask},
+      {"urem-const", Instruction::URem, isUnsignedDivisor, uremToMagic},
+      {"srem-const", Instruction::SRem, isSignedDivisor, sremToMagic},
+  };
+
+  const PatternRule MultiInstrRules[] = {
+      {"sub-offset", Instruction::Sub, isAny, foldOffset},
+      {"add-offset", Instruction::Add, isAny, foldOffset},
+  };
+
+  // Le tabelle vengono costruite una sola volta al caricamento del plugin
+  const RuleTable AlgIdeTable({AlgIdeRules});
+  const RuleTable StrRedTable({StrRedRules});
+  const RuleTable MultiInstrTable({MultiInstrRules});
+  const RuleTable AllTable({AlgIdeRules, StrRedRules, MultiInstrRules});
+
+  // Algebraic Identity pass
+  struct AlgIde : PassInfoMixin<AlgIde>
+  {
+    // Main entry point, takes IR unit to run the pass on (&F) and the
+    // corresponding pass manager (to be queried if need be)
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
+    {
+      Combiner C(AlgIdeTable);
+      return C.run(F);
+    }
+    static bool isRequired() { return true; }
+  };
+
+  // Strength Reduction pass
+  struct StrRed : PassInfoMixin<StrRed>
+  {
+    MulDecomposer Mul;
+
+    // Main entry point, takes IR unit to run the pass on (&F) and the
+    // corresponding pass manager (to be queried if need be)
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
+    {
+      Mul.setTarget(*F.getParent());
+      Combiner C(StrRedTable, &Mul);
+      return C.run(F);
+    }
     static bool isRequired() { return true; }
   };
 
@@ -299,116 +853,23 @@ namespace
     // corresponding pass manager (to be queried if need be)
     PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
     {
-      for (auto B = F.begin(); B != F.end(); ++B)
-      {
-        for (auto I = (*B).begin(); I != (*B).end(); ++I)
-        {
-          if (runOnInstruction(*I))
-          {
-            I = I->eraseFromParent();
-            I--;
-          }
-        }
-      }
-      return PreservedAnalyses::all();
+      Combiner C(MultiInstrTable);
+      return C.run(F);
     }
+    static bool isRequired() { return true; }
+  };
 
-    bool runOnInstruction(Instruction &I)
+  // Tutte le ottimizzazioni in un'unica passata: le regole dei tre pass
+  // vengono applicate dallo stesso motore fino al punto fisso
+  struct AllOpts : PassInfoMixin<AllOpts>
+  {
+    MulDecomposer Mul;
+
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &)
     {
-      // Mi trovo in una add
-      if (AddOperator *add = dyn_cast<AddOperator>(&I))
-      {
-        // Controllo se l'operando 0 è una costante
-        if (ConstantInt *c = dyn_cast<ConstantInt>(add->getOperand(0)))
-        {
-          // Reperisco istruzione successiva
-          Instruction *next = I.getNextNode();
-          while (next)
-          {
-            // Controllo se è sottrazione
-            if (SubOperator *sub = dyn_cast<SubOperator>(next))
-            {
-              // Controllo se si verificano le condizioni per ottimizzazione
-              if (add == sub->getOperand(0) && (add->getOperand(0) == sub->getOperand(1)))
-              {
-                // Rimpiazziamo tutti gli usi della sottrazione
-                sub->replaceAllUsesWith(add->getOperand(1));
-                // Cancelliamo la sottrazione
-                Instruction *temp = next->getPrevNode();
-                next->eraseFromParent();
-                next = temp;
-              }
-            }
-            next = next->getNextNode();
-          }
-          return false;
-        }
-        // Controllo se l'operando 1 è una costante
-        if (ConstantInt *c = dyn_cast<ConstantInt>(add->getOperand(1)))
-        {
-          // Reperisco istruzione successiva
-          Instruction *next = I.getNextNode();
-          while (next)
-          {
-            // Controllo se è sottrazione
-            if (SubOperator *sub = dyn_cast<SubOperator>(next))
-            {
-              // Controllo se si verificano le condizioni per ottimizzazione
-              if (add == sub->getOperand(0) && (add->getOperand(1) == sub->getOperand(1)))
-              {
-                // Rimpiazziamo tutti gli usi della sottrazione
-                sub->replaceAllUsesWith(add->getOperand(0));
-                // Cancelliamo la sottrazione
-                Instruction *temp = next->getPrevNode();
-                next->eraseFromParent();
-                next = temp;
-              }
-            }
-            next = next->getNextNode();
-          }
-          return false;
-        }
-      }
-      if (SubOperator *sub = dyn_cast<SubOperator>(&I))
-      {
-        // Controllo se l'operando 0 è una costante
-        // Effettuiamo controllo solo sul secondo operando dato che se la costante fosse
-        // al primo non si potrebbe effettuare l'ottimizzazione
-        if (ConstantInt *c = dyn_cast<ConstantInt>(sub->getOperand(1)))
-        {
-          // Reperisco istruzione successiva
-          Instruction *next = I.getNextNode();
-          while (next)
-          {
-            // Controllo se è sottrazione
-            if (AddOperator *add = dyn_cast<AddOperator>(next))
-            {
-              // Controllo se si verificano le condizioni per ottimizzazione
-              if (sub == add->getOperand(0) && (sub->getOperand(1) == add->getOperand(1)))
-              {
-                // Rimpiazziamo tutti gli usi dell'addizione
-                add->replaceAllUsesWith(sub->getOperand(0));
-                // Cancelliamo l'addizione
-                Instruction *temp = next->getPrevNode();
-                next->eraseFromParent();
-                next = temp;
-              }
-              if (sub == add->getOperand(1) && (sub->getOperand(1) == add->getOperand(0)))
-              {
-                // Rimpiazziamo tutti gli usi dell'addizione
-                add->replaceAllUsesWith(sub->getOperand(0));
-                // Cancelliamo l'addizione
-                Instruction *temp = next->getPrevNode();
-                next->eraseFromParent();
-                next = temp;
-              }
-            }
-            next = next->getNextNode();
-          }
-          return false;
-        }
-      }
-      return false;
+      Mul.setTarget(*F.getParent());
+      Combiner C(AllTable, &Mul);
+      return C.run(F);
     }
     static bool isRequired() { return true; }
   };
@@ -445,9 +906,7 @@ getOpts1()
                   }
                   else if (Name == "all")
                   {
-                    FPM.addPass(AlgIde());
-                    FPM.addPass(StrRed());
-                    FPM.addPass(MultiInstr());
+                    FPM.addPass(AllOpts());
                     return true;
                   }
                   return false;
@@ -0,0 +1,52 @@
+; Benchmark della divisione per costante: @kernel somma quozienti e resti
+; per 3, 7, 10 e 1000 su 10000000 valori e main ne misura i cicli con
+; llvm.readcyclecounter. Ogni iterazione parte dal risultato della
+; precedente, così conta la latenza della divisione e non solo il throughput. Va eseguito con `lli -O0`: ai livelli più alti il
+; backend applica già la stessa trasformazione e le due versioni coincidono.
+;
+;   opt -load-pass-plugin=../build/libAssignement1.so -passes="strength-reduction" DivBench.ll -S -o DivBench_opt.ll
+;   lli -O0 DivBench.ll && lli -O0 DivBench_opt.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+@fmt = private unnamed_addr constant [48 x i8] c"risultato %d, %llu cicli (%llu per iterazione)\0A\00"
+
+declare i32 @printf(ptr, ...)
+declare i64 @llvm.readcyclecounter()
+
+define internal i32 @kernel(i32 %n) noinline {
+entry:
+    br label %loop
+loop:
+    %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+    %acc = phi i32 [ 0, %entry ], [ %acc.next, %loop ]
+    %v = xor i32 %i, %acc
+    %x = sub i32 %v, 5000000  ; Anche valori negativi
+    %d3 = sdiv i32 %x, 3
+    %y = add i32 %d3, %i
+    %d7 = udiv i32 %y, 7
+    %r10 = srem i32 %x, 10
+    %d1000 = sdiv i32 %y, 1000
+    %r1000 = urem i32 %d7, 1000
+    %a = add i32 %acc, %d3
+    %b = add i32 %a, %d7
+    %c = add i32 %b, %r10
+    %d = add i32 %c, %d1000
+    %acc.next = add i32 %d, %r1000
+    %i.next = add i32 %i, 1
+    %done = icmp eq i32 %i.next, %n
+    br i1 %done, label %exit, label %loop
+exit:
+    ret i32 %acc.next
+}
+
+define i32 @main() {
+entry:
+    %t0 = call i64 @llvm.readcyclecounter()
+    %r = call i32 @kernel(i32 10000000)
+    %t1 = call i64 @llvm.readcyclecounter()
+    %cycles = sub i64 %t1, %t0
+    %per = udiv i64 %cycles, 10000000
+    call i32 (ptr, ...) @printf(ptr @fmt, i32 %r, i64 %cycles, i64 %per)
+    ret i32 0
+}
@@ -0,0 +1,1022 @@
+; Verifica della divisione per costante: ogni @check_iN divide %x per un
+; insieme di costanti (riscritte da strength-reduction) e confronta il
+; risultato con quello delle funzioni @ref_*, che dividono per un argomento
+; e restano vere divisioni. main prova tutti i valori a 8 e 16 bit, i valori
+; ai bordi e 1000000 valori casuali (xorshift) a 32 e 64 bit, stampa il
+; numero di risultati diversi ed esce con 1 se ce ne sono.
+;
+;   opt -load-pass-plugin=../build/libAssignement1.so -passes="strength-reduction" DivCheck.ll -S -o DivCheck_opt.ll
+;   lli DivCheck.ll && lli DivCheck_opt.ll
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+@bounds_i32 = internal constant [35 x i32] [i32 0, i32 1, i32 -1, i32 2, i32 -2, i32 3, i32 -3, i32 6, i32 -6, i32 7, i32 -7, i32 9, i32 10, i32 11, i32 -10, i32 999, i32 1000, i32 1001, i32 -999, i32 -1000, i32 -1001, i32 640, i32 641, i32 642, i32 1000000, i32 -1000000, i32 2147483647, i32 2147483646, i32 -2147483648, i32 -2147483647, i32 1073741823, i32 1073741824, i32 -1073741824, i32 2147483640, i32 -2147483640]
+@bounds_i64 = internal constant [33 x i64] [i64 0, i64 1, i64 -1, i64 2, i64 -2, i64 3, i64 -3, i64 7, i64 -7, i64 10, i64 -10, i64 999, i64 1000, i64 1001, i64 -999, i64 -1000, i64 -1001, i64 1000000006, i64 1000000007, i64 1000000008, i64 -1000000007, i64 2147483647, i64 -2147483648, i64 4294967295, i64 4294967296, i64 9223372036854775807, i64 9223372036854775806, i64 -9223372036854775808, i64 -9223372036854775807, i64 4611686018427387903, i64 4611686018427387904, i64 -4611686018427387904, i64 9223372036854775000]
+@fmt = private unnamed_addr constant [33 x i8] c"i%d: %u risultati diversi su %u\0A\00"
+
+declare i32 @printf(ptr, ...)
+
+define internal i8 @ref_sdiv_i8(i8 %x, i8 %d) noinline {
+entry:
+    %q = sdiv i8 %x, %d
+    ret i8 %q
+}
+
+define internal i8 @ref_udiv_i8(i8 %x, i8 %d) noinline {
+entry:
+    %q = udiv i8 %x, %d
+    ret i8 %q
+}
+
+define internal i8 @ref_srem_i8(i8 %x, i8 %d) noinline {
+entry:
+    %q = srem i8 %x, %d
+    ret i8 %q
+}
+
+define internal i8 @ref_urem_i8(i8 %x, i8 %d) noinline {
+entry:
+    %q = urem i8 %x, %d
+    ret i8 %q
+}
+
+; Numero di risultati diversi tra divisione per costante e divisione vera
+define internal i32 @check_i8(i8 %x) noinline {
+entry:
+    %sdiv3 = sdiv i8 %x, 3
+    %sdiv3.ref = call i8 @ref_sdiv_i8(i8 %x, i8 3)
+    %sdiv3.ne = icmp ne i8 %sdiv3, %sdiv3.ref
+    %sdiv3.err = zext i1 %sdiv3.ne to i32
+    %acc1 = add i32 0, %sdiv3.err
+    %udiv3 = udiv i8 %x, 3
+    %udiv3.ref = call i8 @ref_udiv_i8(i8 %x, i8 3)
+    %udiv3.ne = icmp ne i8 %udiv3, %udiv3.ref
+    %udiv3.err = zext i1 %udiv3.ne to i32
+    %acc2 = add i32 %acc1, %udiv3.err
+    %srem3 = srem i8 %x, 3
+    %srem3.ref = call i8 @ref_srem_i8(i8 %x, i8 3)
+    %srem3.ne = icmp ne i8 %srem3, %srem3.ref
+    %srem3.err = zext i1 %srem3.ne to i32
+    %acc3 = add i32 %acc2, %srem3.err
+    %urem3 = urem i8 %x, 3
+    %urem3.ref = call i8 @ref_urem_i8(i8 %x, i8 3)
+    %urem3.ne = icmp ne i8 %urem3, %urem3.ref
+    %urem3.err = zext i1 %urem3.ne to i32
+    %acc4 = add i32 %acc3, %urem3.err
+    %sdiv5 = sdiv i8 %x, 5
+    %sdiv5.ref = call i8 @ref_sdiv_i8(i8 %x, i8 5)
+    %sdiv5.ne = icmp ne i8 %sdiv5, %sdiv5.ref
+    %sdiv5.err = zext i1 %sdiv5.ne to i32
+    %acc5 = add i32 %acc4, %sdiv5.err
+    %udiv5 = udiv i8 %x, 5
+    %udiv5.ref = call i8 @ref_udiv_i8(i8 %x, i8 5)
+    %udiv5.ne = icmp ne i8 %udiv5, %udiv5.ref
+    %udiv5.err = zext i1 %udiv5.ne to i32
+    %acc6 = add i32 %acc5, %udiv5.err
+    %srem5 = srem i8 %x, 5
+    %srem5.ref = call i8 @ref_srem_i8(i8 %x, i8 5)
+    %srem5.ne = icmp ne i8 %srem5, %srem5.ref
+    %srem5.err = zext i1 %srem5.ne to i32
+    %acc7 = add i32 %acc6, %srem5.err
+    %urem5 = urem i8 %x, 5
+    %urem5.ref = call i8 @ref_urem_i8(i8 %x, i8 5)
+    %urem5.ne = icmp ne i8 %urem5, %urem5.ref
+    %urem5.err = zext i1 %urem5.ne to i32
+    %acc8 = add i32 %acc7, %urem5.err
+    %sdiv7 = sdiv i8 %x, 7
+    %sdiv7.ref = call i8 @ref_sdiv_i8(i8 %x, i8 7)
+    %sdiv7.ne = icmp ne i8 %sdiv7, %sdiv7.ref
+    %sdiv7.err = zext i1 %sdiv7.ne to i32
+    %acc9 = add i32 %acc8, %sdiv7.err
+    %udiv7 = udiv i8 %x, 7
+    %udiv7.ref = call i8 @ref_udiv_i8(i8 %x, i8 7)
+    %udiv7.ne = icmp ne i8 %udiv7, %udiv7.ref
+    %udiv7.err = zext i1 %udiv7.ne to i32
+    %acc10 = add i32 %acc9, %udiv7.err
+    %srem7 = srem i8 %x, 7
+    %srem7.ref = call i8 @ref_srem_i8(i8 %x, i8 7)
+    %srem7.ne = icmp ne i8 %srem7, %srem7.ref
+    %srem7.err = zext i1 %srem7.ne to i32
+    %acc11 = add i32 %acc10, %srem7.err
+    %urem7 = urem i8 %x, 7
+    %urem7.ref = call i8 @ref_urem_i8(i8 %x, i8 7)
+    %urem7.ne = icmp ne i8 %urem7, %urem7.ref
+    %urem7.err = zext i1 %urem7.ne to i32
+    %acc12 = add i32 %acc11, %urem7.err
+    %sdiv10 = sdiv i8 %x, 10
+    %sdiv10.ref = call i8 @ref_sdiv_i8(i8 %x, i8 10)
+    %sdiv10.ne = icmp ne i8 %sdiv10, %sdiv10.ref
+    %sdiv10.err = zext i1 %sdiv10.ne to i32
+    %acc13 = add i32 %acc12, %sdiv10.err
+    %udiv10 = udiv i8 %x, 10
+    %udiv10.ref = call i8 @ref_udiv_i8(i8 %x, i8 10)
+    %udiv10.ne = icmp ne i8 %udiv10, %udiv10.ref
+    %udiv10.err = zext i1 %udiv10.ne to i32
+    %acc14 = add i32 %acc13, %udiv10.err
+    %srem10 = srem i8 %x, 10
+    %srem10.ref = call i8 @ref_srem_i8(i8 %x, i8 10)
+    %srem10.ne = icmp ne i8 %srem10, %srem10.ref
+    %srem10.err = zext i1 %srem10.ne to i32
+    %acc15 = add i32 %acc14, %srem10.err
+    %urem10 = urem i8 %x, 10
+    %urem10.ref = call i8 @ref_urem_i8(i8 %x, i8 10)
+    %urem10.ne = icmp ne i8 %urem10, %urem10.ref
+    %urem10.err = zext i1 %urem10.ne to i32
+    %acc16 = add i32 %acc15, %urem10.err
+    %sdiv100 = sdiv i8 %x, 100
+    %sdiv100.ref = call i8 @ref_sdiv_i8(i8 %x, i8 100)
+    %sdiv100.ne = icmp ne i8 %sdiv100, %sdiv100.ref
+    %sdiv100.err = zext i1 %sdiv100.ne to i32
+    %acc17 = add i32 %acc16, %sdiv100.err
+    %udiv100 = udiv i8 %x, 100
+    %udiv100.ref = call i8 @ref_udiv_i8(i8 %x, i8 100)
+    %udiv100.ne = icmp ne i8 %udiv100, %udiv100.ref
+    %udiv100.err = zext i1 %udiv100.ne to i32
+    %acc18 = add i32 %acc17, %udiv100.err
+    %srem100 = srem i8 %x, 100
+    %srem100.ref = call i8 @ref_srem_i8(i8 %x, i8 100)
+    %srem100.ne = icmp ne i8 %srem100, %srem100.ref
+    %srem100.err = zext i1 %srem100.ne to i32
+    %acc19 = add i32 %acc18, %srem100.err
+    %urem100 = urem i8 %x, 100
+    %urem100.ref = call i8 @ref_urem_i8(i8 %x, i8 100)
+    %urem100.ne = icmp ne i8 %urem100, %urem100.ref
+    %urem100.err = zext i1 %urem100.ne to i32
+    %acc20 = add i32 %acc19, %urem100.err
+    %sdiv4 = sdiv i8 %x, 4
+    %sdiv4.ref = call i8 @ref_sdiv_i8(i8 %x, i8 4)
+    %sdiv4.ne = icmp ne i8 %sdiv4, %sdiv4.ref
+    %sdiv4.err = zext i1 %sdiv4.ne to i32
+    %acc21 = add i32 %acc20, %sdiv4.err
+    %udiv4 = udiv i8 %x, 4
+    %udiv4.ref = call i8 @ref_udiv_i8(i8 %x, i8 4)
+    %udiv4.ne = icmp ne i8 %udiv4, %udiv4.ref
+    %udiv4.err = zext i1 %udiv4.ne to i32
+    %acc22 = add i32 %acc21, %udiv4.err
+    %srem4 = srem i8 %x, 4
+    %srem4.ref = call i8 @ref_srem_i8(i8 %x, i8 4)
+    %srem4.ne = icmp ne i8 %srem4, %srem4.ref
+    %srem4.err = zext i1 %srem4.ne to i32
+    %acc23 = add i32 %acc22, %srem4.err
+    %urem4 = urem i8 %x, 4
+    %urem4.ref = call i8 @ref_urem_i8(i8 %x, i8 4)
+    %urem4.ne = icmp ne i8 %urem4, %urem4.ref
+    %urem4.err = zext i1 %urem4.ne to i32
+    %acc24 = add i32 %acc23, %urem4.err
+    %sdivm3 = sdiv i8 %x, -3
+    %sdivm3.ref = call i8 @ref_sdiv_i8(i8 %x, i8 -3)
+    %sdivm3.ne = icmp ne i8 %sdivm3, %sdivm3.ref
+    %sdivm3.err = zext i1 %sdivm3.ne to i32
+    %acc25 = add i32 %acc24, %sdivm3.err
+    %udivm3 = udiv i8 %x, -3
+    %udivm3.ref = call i8 @ref_udiv_i8(i8 %x, i8 -3)
+    %udivm3.ne = icmp ne i8 %udivm3, %udivm3.ref
+    %udivm3.err = zext i1 %udivm3.ne to i32
+    %acc26 = add i32 %acc25, %udivm3.err
+    %sremm3 = srem i8 %x, -3
+    %sremm3.ref = call i8 @ref_srem_i8(i8 %x, i8 -3)
+    %sremm3.ne = icmp ne i8 %sremm3, %sremm3.ref
+    %sremm3.err = zext i1 %sremm3.ne to i32
+    %acc27 = add i32 %acc26, %sremm3.err
+    %uremm3 = urem i8 %x, -3
+    %uremm3.ref = call i8 @ref_urem_i8(i8 %x, i8 -3)
+    %uremm3.ne = icmp ne i8 %uremm3, %uremm3.ref
+    %uremm3.err = zext i1 %uremm3.ne to i32
+    %acc28 = add i32 %acc27, %uremm3.err
+    %sdivm7 = sdiv i8 %x, -7
+    %sdivm7.ref = call i8 @ref_sdiv_i8(i8 %x, i8 -7)
+    %sdivm7.ne = icmp ne i8 %sdivm7, %sdivm7.ref
+    %sdivm7.err = zext i1 %sdivm7.ne to i32
+    %acc29 = add i32 %acc28, %sdivm7.err
+    %udivm7 = udiv i8 %x, -7
+    %udivm7.ref = call i8 @ref_udiv_i8(i8 %x, i8 -7)
+    %udivm7.ne = icmp ne i8 %udivm7, %udivm7.ref
+    %udivm7.err = zext i1 %udivm7.ne to i32
+    %acc30 = add i32 %acc29, %udivm7.err
+    %sremm7 = srem i8 %x, -7
+    %sremm7.ref = call i8 @ref_srem_i8(i8 %x, i8 -7)
+    %sremm7.ne = icmp ne i8 %sremm7, %sremm7.ref
+    %sremm7.err = zext i1 %sremm7.ne to i32
+    %acc31 = add i32 %acc30, %sremm7.err
+    %uremm7 = urem i8 %x, -7
+    %uremm7.ref = call i8 @ref_urem_i8(i8 %x, i8 -7)
+    %uremm7.ne = icmp ne i8 %uremm7, %uremm7.ref
+    %uremm7.err = zext i1 %uremm7.ne to i32
+    %acc32 = add i32 %acc31, %uremm7.err
+    %sdivm8 = sdiv i8 %x, -8
+    %sdivm8.ref = call i8 @ref_sdiv_i8(i8 %x, i8 -8)
+    %sdivm8.ne = icmp ne i8 %sdivm8, %sdivm8.ref
+    %sdivm8.err = zext i1 %sdivm8.ne to i32
+    %acc33 = add i32 %acc32, %sdivm8.err
+    %udivm8 = udiv i8 %x, -8
+    %udivm8.ref = call i8 @ref_udiv_i8(i8 %x, i8 -8)
+    %udivm8.ne = icmp ne i8 %udivm8, %udivm8.ref
+    %udivm8.err = zext i1 %udivm8.ne to i32
+    %acc34 = add i32 %acc33, %udivm8.err
+    %sremm8 = srem i8 %x, -8
+    %sremm8.ref = call i8 @ref_srem_i8(i8 %x, i8 -8)
+    %sremm8.ne = icmp ne i8 %sremm8, %sremm8.ref
+    %sremm8.err = zext i1 %sremm8.ne to i32
+    %acc35 = add i32 %acc34, %sremm8.err
+    %uremm8 = urem i8 %x, -8
+    %uremm8.ref = call i8 @ref_urem_i8(i8 %x, i8 -8)
+    %uremm8.ne = icmp ne i8 %uremm8, %uremm8.ref
+    %uremm8.err = zext i1 %uremm8.ne to i32
+    %acc36 = add i32 %acc35, %uremm8.err
+    %sdiv127 = sdiv i8 %x, 127
+    %sdiv127.ref = call i8 @ref_sdiv_i8(i8 %x, i8 127)
+    %sdiv127.ne = icmp ne i8 %sdiv127, %sdiv127.ref
+    %sdiv127.err = zext i1 %sdiv127.ne to i32
+    %acc37 = add i32 %acc36, %sdiv127.err
+    %udiv127 = udiv i8 %x, 127
+    %udiv127.ref = call i8 @ref_udiv_i8(i8 %x, i8 127)
+    %udiv127.ne = icmp ne i8 %udiv127, %udiv127.ref
+    %udiv127.err = zext i1 %udiv127.ne to i32
+    %acc38 = add i32 %acc37, %udiv127.err
+    %srem127 = srem i8 %x, 127
+    %srem127.ref = call i8 @ref_srem_i8(i8 %x, i8 127)
+    %srem127.ne = icmp ne i8 %srem127, %srem127.ref
+    %srem127.err = zext i1 %srem127.ne to i32
+    %acc39 = add i32 %acc38, %srem127.err
+    %urem127 = urem i8 %x, 127
+    %urem127.ref = call i8 @ref_urem_i8(i8 %x, i8 127)
+    %urem127.ne = icmp ne i8 %urem127, %urem127.ref
+    %urem127.err = zext i1 %urem127.ne to i32
+    %acc40 = add i32 %acc39, %urem127.err
+    ret i32 %acc40
+}
+
+define internal i16 @ref_sdiv_i16(i16 %x, i16 %d) noinline {
+entry:
+    %q = sdiv i16 %x, %d
+    ret i16 %q
+}
+
+define internal i16 @ref_udiv_i16(i16 %x, i16 %d) noinline {
+entry:
+    %q = udiv i16 %x, %d
+    ret i16 %q
+}
+
+define internal i16 @ref_srem_i16(i16 %x, i16 %d) noinline {
+entry:
+    %q = srem i16 %x, %d
+    ret i16 %q
+}
+
+define internal i16 @ref_urem_i16(i16 %x, i16 %d) noinline {
+entry:
+    %q = urem i16 %x, %d
+    ret i16 %q
+}
+
+; Numero di risultati diversi tra divisione per costante e divisione vera
+define internal i32 @check_i16(i16 %x) noinline {
+entry:
+    %sdiv3 = sdiv i16 %x, 3
+    %sdiv3.ref = call i16 @ref_sdiv_i16(i16 %x, i16 3)
+    %sdiv3.ne = icmp ne i16 %sdiv3, %sdiv3.ref
+    %sdiv3.err = zext i1 %sdiv3.ne to i32
+    %acc1 = add i32 0, %sdiv3.err
+    %udiv3 = udiv i16 %x, 3
+    %udiv3.ref = call i16 @ref_udiv_i16(i16 %x, i16 3)
+    %udiv3.ne = icmp ne i16 %udiv3, %udiv3.ref
+    %udiv3.err = zext i1 %udiv3.ne to i32
+    %acc2 = add i32 %acc1, %udiv3.err
+    %srem3 = srem i16 %x, 3
+    %srem3.ref = call i16 @ref_srem_i16(i16 %x, i16 3)
+    %srem3.ne = icmp ne i16 %srem3, %srem3.ref
+    %srem3.err = zext i1 %srem3.ne to i32
+    %acc3 = add i32 %acc2, %srem3.err
+    %urem3 = urem i16 %x, 3
+    %urem3.ref = call i16 @ref_urem_i16(i16 %x, i16 3)
+    %urem3.ne = icmp ne i16 %urem3, %urem3.ref
+    %urem3.err = zext i1 %urem3.ne to i32
+    %acc4 = add i32 %acc3, %urem3.err
+    %sdiv7 = sdiv i16 %x, 7
+    %sdiv7.ref = call i16 @ref_sdiv_i16(i16 %x, i16 7)
+    %sdiv7.ne = icmp ne i16 %sdiv7, %sdiv7.ref
+    %sdiv7.err = zext i1 %sdiv7.ne to i32
+    %acc5 = add i32 %acc4, %sdiv7.err
+    %udiv7 = udiv i16 %x, 7
+    %udiv7.ref = call i16 @ref_udiv_i16(i16 %x, i16 7)
+    %udiv7.ne = icmp ne i16 %udiv7, %udiv7.ref
+    %udiv7.err = zext i1 %udiv7.ne to i32
+    %acc6 = add i32 %acc5, %udiv7.err
+    %srem7 = srem i16 %x, 7
+    %srem7.ref = call i16 @ref_srem_i16(i16 %x, i16 7)
+    %srem7.ne = icmp ne i16 %srem7, %srem7.ref
+    %srem7.err = zext i1 %srem7.ne to i32
+    %acc7 = add i32 %acc6, %srem7.err
+    %urem7 = urem i16 %x, 7
+    %urem7.ref = call i16 @ref_urem_i16(i16 %x, i16 7)
+    %urem7.ne = icmp ne i16 %urem7, %urem7.ref
+    %urem7.err = zext i1 %urem7.ne to i32
+    %acc8 = add i32 %acc7, %urem7.err
+    %sdiv10 = sdiv i16 %x, 10
+    %sdiv10.ref = call i16 @ref_sdiv_i16(i16 %x, i16 10)
+    %sdiv10.ne = icmp ne i16 %sdiv10, %sdiv10.ref
+    %sdiv10.err = zext i1 %sdiv10.ne to i32
+    %acc9 = add i32 %acc8, %sdiv10.err
+    %udiv10 = udiv i16 %x, 10
+    %udiv10.ref = call i16 @ref_udiv_i16(i16 %x, i16 10)
+    %udiv10.ne = icmp ne i16 %udiv10, %udiv10.ref
+    %udiv10.err = zext i1 %udiv10.ne to i32
+    %acc10 = add i32 %acc9, %udiv10.err
+    %srem10 = srem i16 %x, 10
+    %srem10.ref = call i16 @ref_srem_i16(i16 %x, i16 10)
+    %srem10.ne = icmp ne i16 %srem10, %srem10.ref
+    %srem10.err = zext i1 %srem10.ne to i32
+    %acc11 = add i32 %acc10, %srem10.err
+    %urem10 = urem i16 %x, 10
+    %urem10.ref = call i16 @ref_urem_i16(i16 %x, i16 10)
+    %urem10.ne = icmp ne i16 %urem10, %urem10.ref
+    %urem10.err = zext i1 %urem10.ne to i32
+    %acc12 = add i32 %acc11, %urem10.err
+    %sdiv1000 = sdiv i16 %x, 1000
+    %sdiv1000.ref = call i16 @ref_sdiv_i16(i16 %x, i16 1000)
+    %sdiv1000.ne = icmp ne i16 %sdiv1000, %sdiv1000.ref
+    %sdiv1000.err = zext i1 %sdiv1000.ne to i32
+    %acc13 = add i32 %acc12, %sdiv1000.err
+    %udiv1000 = udiv i16 %x, 1000
+    %udiv1000.ref = call i16 @ref_udiv_i16(i16 %x, i16 1000)
+    %udiv1000.ne = icmp ne i16 %udiv1000, %udiv1000.ref
+    %udiv1000.err = zext i1 %udiv1000.ne to i32
+    %acc14 = add i32 %acc13, %udiv1000.err
+    %srem1000 = srem i16 %x, 1000
+    %srem1000.ref = call i16 @ref_srem_i16(i16 %x, i16 1000)
+    %srem1000.ne = icmp ne i16 %srem1000, %srem1000.ref
+    %srem1000.err = zext i1 %srem1000.ne to i32
+    %acc15 = add i32 %acc14, %srem1000.err
+    %urem1000 = urem i16 %x, 1000
+    %urem1000.ref = call i16 @ref_urem_i16(i16 %x, i16 1000)
+    %urem1000.ne = icmp ne i16 %urem1000, %urem1000.ref
+    %urem1000.err = zext i1 %urem1000.ne to i32
+    %acc16 = add i32 %acc15, %urem1000.err
+    %sdiv641 = sdiv i16 %x, 641
+    %sdiv641.ref = call i16 @ref_sdiv_i16(i16 %x, i16 641)
+    %sdiv641.ne = icmp ne i16 %sdiv641, %sdiv641.ref
+    %sdiv641.err = zext i1 %sdiv641.ne to i32
+    %acc17 = add i32 %acc16, %sdiv641.err
+    %udiv641 = udiv i16 %x, 641
+    %udiv641.ref = call i16 @ref_udiv_i16(i16 %x, i16 641)
+    %udiv641.ne = icmp ne i16 %udiv641, %udiv641.ref
+    %udiv641.err = zext i1 %udiv641.ne to i32
+    %acc18 = add i32 %acc17, %udiv641.err
+    %srem641 = srem i16 %x, 641
+    %srem641.ref = call i16 @ref_srem_i16(i16 %x, i16 641)
+    %srem641.ne = icmp ne i16 %srem641, %srem641.ref
+    %srem641.err = zext i1 %srem641.ne to i32
+    %acc19 = add i32 %acc18, %srem641.err
+    %urem641 = urem i16 %x, 641
+    %urem641.ref = call i16 @ref_urem_i16(i16 %x, i16 641)
+    %urem641.ne = icmp ne i16 %urem641, %urem641.ref
+    %urem641.err = zext i1 %urem641.ne to i32
+    %acc20 = add i32 %acc19, %urem641.err
+    %sdiv16 = sdiv i16 %x, 16
+    %sdiv16.ref = call i16 @ref_sdiv_i16(i16 %x, i16 16)
+    %sdiv16.ne = icmp ne i16 %sdiv16, %sdiv16.ref
+    %sdiv16.err = zext i1 %sdiv16.ne to i32
+    %acc21 = add i32 %acc20, %sdiv16.err
+    %udiv16 = udiv i16 %x, 16
+    %udiv16.ref = call i16 @ref_udiv_i16(i16 %x, i16 16)
+    %udiv16.ne = icmp ne i16 %udiv16, %udiv16.ref
+    %udiv16.err = zext i1 %udiv16.ne to i32
+    %acc22 = add i32 %acc21, %udiv16.err
+    %srem16 = srem i16 %x, 16
+    %srem16.ref = call i16 @ref_srem_i16(i16 %x, i16 16)
+    %srem16.ne = icmp ne i16 %srem16, %srem16.ref
+    %srem16.err = zext i1 %srem16.ne to i32
+    %acc23 = add i32 %acc22, %srem16.err
+    %urem16 = urem i16 %x, 16
+    %urem16.ref = call i16 @ref_urem_i16(i16 %x, i16 16)
+    %urem16.ne = icmp ne i16 %urem16, %urem16.ref
+    %urem16.err = zext i1 %urem16.ne to i32
+    %acc24 = add i32 %acc23, %urem16.err
+    %sdivm7 = sdiv i16 %x, -7
+    %sdivm7.ref = call i16 @ref_sdiv_i16(i16 %x, i16 -7)
+    %sdivm7.ne = icmp ne i16 %sdivm7, %sdivm7.ref
+    %sdivm7.err = zext i1 %sdivm7.ne to i32
+    %acc25 = add i32 %acc24, %sdivm7.err
+    %udivm7 = udiv i16 %x, -7
+    %udivm7.ref = call i16 @ref_udiv_i16(i16 %x, i16 -7)
+    %udivm7.ne = icmp ne i16 %udivm7, %udivm7.ref
+    %udivm7.err = zext i1 %udivm7.ne to i32
+    %acc26 = add i32 %acc25, %udivm7.err
+    %sremm7 = srem i16 %x, -7
+    %sremm7.ref = call i16 @ref_srem_i16(i16 %x, i16 -7)
+    %sremm7.ne = icmp ne i16 %sremm7, %sremm7.ref
+    %sremm7.err = zext i1 %sremm7.ne to i32
+    %acc27 = add i32 %acc26, %sremm7.err
+    %uremm7 = urem i16 %x, -7
+    %uremm7.ref = call i16 @ref_urem_i16(i16 %x, i16 -7)
+    %uremm7.ne = icmp ne i16 %uremm7, %uremm7.ref
+    %uremm7.err = zext i1 %uremm7.ne to i32
+    %acc28 = add i32 %acc27, %uremm7.err
+    %sdivm1000 = sdiv i16 %x, -1000
+    %sdivm1000.ref = call i16 @ref_sdiv_i16(i16 %x, i16 -1000)
+    %sdivm1000.ne = icmp ne i16 %sdivm1000, %sdivm1000.ref
+    %sdivm1000.err = zext i1 %sdivm1000.ne to i32
+    %acc29 = add i32 %acc28, %sdivm1000.err
+    %udivm1000 = udiv i16 %x, -1000
+    %udivm1000.ref = call i16 @ref_udiv_i16(i16 %x, i16 -1000)
+    %udivm1000.ne = icmp ne i16 %udivm1000, %udivm1000.ref
+    %udivm1000.err = zext i1 %udivm1000.ne to i32
+    %acc30 = add i32 %acc29, %udivm1000.err
+    %sremm1000 = srem i16 %x, -1000
+    %sremm1000.ref = call i16 @ref_srem_i16(i16 %x, i16 -1000)
+    %sremm1000.ne = icmp ne i16 %sremm1000, %sremm1000.ref
+    %sremm1000.err = zext i1 %sremm1000.ne to i32
+    %acc31 = add i32 %acc30, %sremm1000.err
+    %uremm1000 = urem i16 %x, -1000
+    %uremm1000.ref = call i16 @ref_urem_i16(i16 %x, i16 -1000)
+    %uremm1000.ne = icmp ne i16 %uremm1000, %uremm1000.ref
+    %uremm1000.err = zext i1 %uremm1000.ne to i32
+    %acc32 = add i32 %acc31, %uremm1000.err
+    %sdiv32767 = sdiv i16 %x, 32767
+    %sdiv32767.ref = call i16 @ref_sdiv_i16(i16 %x, i16 32767)
+    %sdiv32767.ne = icmp ne i16 %sdiv32767, %sdiv32767.ref
+    %sdiv32767.err = zext i1 %sdiv32767.ne to i32
+    %acc33 = add i32 %acc32, %sdiv32767.err
+    %udiv32767 = udiv i16 %x, 32767
+    %udiv32767.ref = call i16 @ref_udiv_i16(i16 %x, i16 32767)
+    %udiv32767.ne = icmp ne i16 %udiv32767, %udiv32767.ref
+    %udiv32767.err = zext i1 %udiv32767.ne to i32
+    %acc34 = add i32 %acc33, %udiv32767.err
+    %srem32767 = srem i16 %x, 32767
+    %srem32767.ref = call i16 @ref_srem_i16(i16 %x, i16 32767)
+    %srem32767.ne = icmp ne i16 %srem32767, %srem32767.ref
+    %srem32767.err = zext i1 %srem32767.ne to i32
+    %acc35 = add i32 %acc34, %srem32767.err
+    %urem32767 = urem i16 %x, 32767
+    %urem32767.ref = call i16 @ref_urem_i16(i16 %x, i16 32767)
+    %urem32767.ne = icmp ne i16 %urem32767, %urem32767.ref
+    %urem32767.err = zext i1 %urem32767.ne to i32
+    %acc36 = add i32 %acc35, %urem32767.err
+    ret i32 %acc36
+}
+
+define internal i32 @ref_sdiv_i32(i32 %x, i32 %d) noinline {
+entry:
+    %q = sdiv i32 %x, %d
+    ret i32 %q
+}
+
+define internal i32 @ref_udiv_i32(i32 %x, i32 %d) noinline {
+entry:
+    %q = udiv i32 %x, %d
+    ret i32 %q
+}
+
+define internal i32 @ref_srem_i32(i32 %x, i32 %d) noinline {
+entry:
+    %q = srem i32 %x, %d
+    ret i32 %q
+}
+
+define internal i32 @ref_urem_i32(i32 %x, i32 %d) noinline {
+entry:
+    %q = urem i32 %x, %d
+    ret i32 %q
+}
+
+; Numero di risultati diversi tra divisione per costante e divisione vera
+define internal i32 @check_i32(i32 %x) noinline {
+entry:
+    %sdiv3 = sdiv i32 %x, 3
+    %sdiv3.ref = call i32 @ref_sdiv_i32(i32 %x, i32 3)
+    %sdiv3.ne = icmp ne i32 %sdiv3, %sdiv3.ref
+    %sdiv3.err = zext i1 %sdiv3.ne to i32
+    %acc1 = add i32 0, %sdiv3.err
+    %udiv3 = udiv i32 %x, 3
+    %udiv3.ref = call i32 @ref_udiv_i32(i32 %x, i32 3)
+    %udiv3.ne = icmp ne i32 %udiv3, %udiv3.ref
+    %udiv3.err = zext i1 %udiv3.ne to i32
+    %acc2 = add i32 %acc1, %udiv3.err
+    %srem3 = srem i32 %x, 3
+    %srem3.ref = call i32 @ref_srem_i32(i32 %x, i32 3)
+    %srem3.ne = icmp ne i32 %srem3, %srem3.ref
+    %srem3.err = zext i1 %srem3.ne to i32
+    %acc3 = add i32 %acc2, %srem3.err
+    %urem3 = urem i32 %x, 3
+    %urem3.ref = call i32 @ref_urem_i32(i32 %x, i32 3)
+    %urem3.ne = icmp ne i32 %urem3, %urem3.ref
+    %urem3.err = zext i1 %urem3.ne to i32
+    %acc4 = add i32 %acc3, %urem3.err
+    %sdiv7 = sdiv i32 %x, 7
+    %sdiv7.ref = call i32 @ref_sdiv_i32(i32 %x, i32 7)
+    %sdiv7.ne = icmp ne i32 %sdiv7, %sdiv7.ref
+    %sdiv7.err = zext i1 %sdiv7.ne to i32
+    %acc5 = add i32 %acc4, %sdiv7.err
+    %udiv7 = udiv i32 %x, 7
+    %udiv7.ref = call i32 @ref_udiv_i32(i32 %x, i32 7)
+    %udiv7.ne = icmp ne i32 %udiv7, %udiv7.ref
+    %udiv7.err = zext i1 %udiv7.ne to i32
+    %acc6 = add i32 %acc5, %udiv7.err
+    %srem7 = srem i32 %x, 7
+    %srem7.ref = call i32 @ref_srem_i32(i32 %x, i32 7)
+    %srem7.ne = icmp ne i32 %srem7, %srem7.ref
+    %srem7.err = zext i1 %srem7.ne to i32
+    %acc7 = add i32 %acc6, %srem7.err
+    %urem7 = urem i32 %x, 7
+    %urem7.ref = call i32 @ref_urem_i32(i32 %x, i32 7)
+    %urem7.ne = icmp ne i32 %urem7, %urem7.ref
+    %urem7.err = zext i1 %urem7.ne to i32
+    %acc8 = add i32 %acc7, %urem7.err
+    %sdiv10 = sdiv i32 %x, 10
+    %sdiv10.ref = call i32 @ref_sdiv_i32(i32 %x, i32 10)
+    %sdiv10.ne = icmp ne i32 %sdiv10, %sdiv10.ref
+    %sdiv10.err = zext i1 %sdiv10.ne to i32
+    %acc9 = add i32 %acc8, %sdiv10.err
+    %udiv10 = udiv i32 %x, 10
+    %udiv10.ref = call i32 @ref_udiv_i32(i32 %x, i32 10)
+    %udiv10.ne = icmp ne i32 %udiv10, %udiv10.ref
+    %udiv10.err = zext i1 %udiv10.ne to i32
+    %acc10 = add i32 %acc9, %udiv10.err
+    %srem10 = srem i32 %x, 10
+    %srem10.ref = call i32 @ref_srem_i32(i32 %x, i32 10)
+    %srem10.ne = icmp ne i32 %srem10, %srem10.ref
+    %srem10.err = zext i1 %srem10.ne to i32
+    %acc11 = add i32 %acc10, %srem10.err
+    %urem10 = urem i32 %x, 10
+    %urem10.ref = call i32 @ref_urem_i32(i32 %x, i32 10)
+    %urem10.ne = icmp ne i32 %urem10, %urem10.ref
+    %urem10.err = zext i1 %urem10.ne to i32
+    %acc12 = add i32 %acc11, %urem10.err
+    %sdiv1000 = sdiv i32 %x, 1000
+    %sdiv1000.ref = call i32 @ref_sdiv_i32(i32 %x, i32 1000)
+    %sdiv1000.ne = icmp ne i32 %sdiv1000, %sdiv1000.ref
+    %sdiv1000.err = zext i1 %sdiv1000.ne to i32
+    %acc13 = add i32 %acc12, %sdiv1000.err
+    %udiv1000 = udiv i32 %x, 1000
+    %udiv1000.ref = call i32 @ref_udiv_i32(i32 %x, i32 1000)
+    %udiv1000.ne = icmp ne i32 %udiv1000, %udiv1000.ref
+    %udiv1000.err = zext i1 %udiv1000.ne to i32
+    %acc14 = add i32 %acc13, %udiv1000.err
+    %srem1000 = srem i32 %x, 1000
+    %srem1000.ref = call i32 @ref_srem_i32(i32 %x, i32 1000)
+    %srem1000.ne = icmp ne i32 %srem1000, %srem1000.ref
+    %srem1000.err = zext i1 %srem1000.ne to i32
+    %acc15 = add i32 %acc14, %srem1000.err
+    %urem1000 = urem i32 %x, 1000
+    %urem1000.ref = call i32 @ref_urem_i32(i32 %x, i32 1000)
+    %urem1000.ne = icmp ne i32 %urem1000, %urem1000.ref
+    %urem1000.err = zext i1 %urem1000.ne to i32
+    %acc16 = add i32 %acc15, %urem1000.err
+    %sdiv641 = sdiv i32 %x, 641
+    %sdiv641.ref = call i32 @ref_sdiv_i32(i32 %x, i32 641)
+    %sdiv641.ne = icmp ne i32 %sdiv641, %sdiv641.ref
+    %sdiv641.err = zext i1 %sdiv641.ne to i32
+    %acc17 = add i32 %acc16, %sdiv641.err
+    %udiv641 = udiv i32 %x, 641
+    %udiv641.ref = call i32 @ref_udiv_i32(i32 %x, i32 641)
+    %udiv641.ne = icmp ne i32 %udiv641, %udiv641.ref
+    %udiv641.err = zext i1 %udiv641.ne to i32
+    %acc18 = add i32 %acc17, %udiv641.err
+    %srem641 = srem i32 %x, 641
+    %srem641.ref = call i32 @ref_srem_i32(i32 %x, i32 641)
+    %srem641.ne = icmp ne i32 %srem641, %srem641.ref
+    %srem641.err = zext i1 %srem641.ne to i32
+    %acc19 = add i32 %acc18, %srem641.err
+    %urem641 = urem i32 %x, 641
+    %urem641.ref = call i32 @ref_urem_i32(i32 %x, i32 641)
+    %urem641.ne = icmp ne i32 %urem641, %urem641.ref
+    %urem641.err = zext i1 %urem641.ne to i32
+    %acc20 = add i32 %acc19, %urem641.err
+    %sdiv1000000 = sdiv i32 %x, 1000000
+    %sdiv1000000.ref = call i32 @ref_sdiv_i32(i32 %x, i32 1000000)
+    %sdiv1000000.ne = icmp ne i32 %sdiv1000000, %sdiv1000000.ref
+    %sdiv1000000.err = zext i1 %sdiv1000000.ne to i32
+    %acc21 = add i32 %acc20, %sdiv1000000.err
+    %udiv1000000 = udiv i32 %x, 1000000
+    %udiv1000000.ref = call i32 @ref_udiv_i32(i32 %x, i32 1000000)
+    %udiv1000000.ne = icmp ne i32 %udiv1000000, %udiv1000000.ref
+    %udiv1000000.err = zext i1 %udiv1000000.ne to i32
+    %acc22 = add i32 %acc21, %udiv1000000.err
+    %srem1000000 = srem i32 %x, 1000000
+    %srem1000000.ref = call i32 @ref_srem_i32(i32 %x, i32 1000000)
+    %srem1000000.ne = icmp ne i32 %srem1000000, %srem1000000.ref
+    %srem1000000.err = zext i1 %srem1000000.ne to i32
+    %acc23 = add i32 %acc22, %srem1000000.err
+    %urem1000000 = urem i32 %x, 1000000
+    %urem1000000.ref = call i32 @ref_urem_i32(i32 %x, i32 1000000)
+    %urem1000000.ne = icmp ne i32 %urem1000000, %urem1000000.ref
+    %urem1000000.err = zext i1 %urem1000000.ne to i32
+    %acc24 = add i32 %acc23, %urem1000000.err
+    %sdiv8 = sdiv i32 %x, 8
+    %sdiv8.ref = call i32 @ref_sdiv_i32(i32 %x, i32 8)
+    %sdiv8.ne = icmp ne i32 %sdiv8, %sdiv8.ref
+    %sdiv8.err = zext i1 %sdiv8.ne to i32
+    %acc25 = add i32 %acc24, %sdiv8.err
+    %udiv8 = udiv i32 %x, 8
+    %udiv8.ref = call i32 @ref_udiv_i32(i32 %x, i32 8)
+    %udiv8.ne = icmp ne i32 %udiv8, %udiv8.ref
+    %udiv8.err = zext i1 %udiv8.ne to i32
+    %acc26 = add i32 %acc25, %udiv8.err
+    %srem8 = srem i32 %x, 8
+    %srem8.ref = call i32 @ref_srem_i32(i32 %x, i32 8)
+    %srem8.ne = icmp ne i32 %srem8, %srem8.ref
+    %srem8.err = zext i1 %srem8.ne to i32
+    %acc27 = add i32 %acc26, %srem8.err
+    %urem8 = urem i32 %x, 8
+    %urem8.ref = call i32 @ref_urem_i32(i32 %x, i32 8)
+    %urem8.ne = icmp ne i32 %urem8, %urem8.ref
+    %urem8.err = zext i1 %urem8.ne to i32
+    %acc28 = add i32 %acc27, %urem8.err
+    %sdivm10 = sdiv i32 %x, -10
+    %sdivm10.ref = call i32 @ref_sdiv_i32(i32 %x, i32 -10)
+    %sdivm10.ne = icmp ne i32 %sdivm10, %sdivm10.ref
+    %sdivm10.err = zext i1 %sdivm10.ne to i32
+    %acc29 = add i32 %acc28, %sdivm10.err
+    %udivm10 = udiv i32 %x, -10
+    %udivm10.ref = call i32 @ref_udiv_i32(i32 %x, i32 -10)
+    %udivm10.ne = icmp ne i32 %udivm10, %udivm10.ref
+    %udivm10.err = zext i1 %udivm10.ne to i32
+    %acc30 = add i32 %acc29, %udivm10.err
+    %sremm10 = srem i32 %x, -10
+    %sremm10.ref = call i32 @ref_srem_i32(i32 %x, i32 -10)
+    %sremm10.ne = icmp ne i32 %sremm10, %sremm10.ref
+    %sremm10.err = zext i1 %sremm10.ne to i32
+    %acc31 = add i32 %acc30, %sremm10.err
+    %uremm10 = urem i32 %x, -10
+    %uremm10.ref = call i32 @ref_urem_i32(i32 %x, i32 -10)
+    %uremm10.ne = icmp ne i32 %uremm10, %uremm10.ref
+    %uremm10.err = zext i1 %uremm10.ne to i32
+    %acc32 = add i32 %acc31, %uremm10.err
+    %sdivm1000 = sdiv i32 %x, -1000
+    %sdivm1000.ref = call i32 @ref_sdiv_i32(i32 %x, i32 -1000)
+    %sdivm1000.ne = icmp ne i32 %sdivm1000, %sdivm1000.ref
+    %sdivm1000.err = zext i1 %sdivm1000.ne to i32
+    %acc33 = add i32 %acc32, %sdivm1000.err
+    %udivm1000 = udiv i32 %x, -1000
+    %udivm1000.ref = call i32 @ref_udiv_i32(i32 %x, i32 -1000)
+    %udivm1000.ne = icmp ne i32 %udivm1000, %udivm1000.ref
+    %udivm1000.err = zext i1 %udivm1000.ne to i32
+    %acc34 = add i32 %acc33, %udivm1000.err
+    %sremm1000 = srem i32 %x, -1000
+    %sremm1000.ref = call i32 @ref_srem_i32(i32 %x, i32 -1000)
+    %sremm1000.ne = icmp ne i32 %sremm1000, %sremm1000.ref
+    %sremm1000.err = zext i1 %sremm1000.ne to i32
+    %acc35 = add i32 %acc34, %sremm1000.err
+    %uremm1000 = urem i32 %x, -1000
+    %uremm1000.ref = call i32 @ref_urem_i32(i32 %x, i32 -1000)
+    %uremm1000.ne = icmp ne i32 %uremm1000, %uremm1000.ref
+    %uremm1000.err = zext i1 %uremm1000.ne to i32
+    %acc36 = add i32 %acc35, %uremm1000.err
+    %sdiv2147483647 = sdiv i32 %x, 2147483647
+    %sdiv2147483647.ref = call i32 @ref_sdiv_i32(i32 %x, i32 2147483647)
+    %sdiv2147483647.ne = icmp ne i32 %sdiv2147483647, %sdiv2147483647.ref
+    %sdiv2147483647.err = zext i1 %sdiv2147483647.ne to i32
+    %acc37 = add i32 %acc36, %sdiv2147483647.err
+    %udiv2147483647 = udiv i32 %x, 2147483647
+    %udiv2147483647.ref = call i32 @ref_udiv_i32(i32 %x, i32 2147483647)
+    %udiv2147483647.ne = icmp ne i32 %udiv2147483647, %udiv2147483647.ref
+    %udiv2147483647.err = zext i1 %udiv2147483647.ne to i32
+    %acc38 = add i32 %acc37, %udiv2147483647.err
+    %srem2147483647 = srem i32 %x, 2147483647
+    %srem2147483647.ref = call i32 @ref_srem_i32(i32 %x, i32 2147483647)
+    %srem2147483647.ne = icmp ne i32 %srem2147483647, %srem2147483647.ref
+    %srem2147483647.err = zext i1 %srem2147483647.ne to i32
+    %acc39 = add i32 %acc38, %srem2147483647.err
+    %urem2147483647 = urem i32 %x, 2147483647
+    %urem2147483647.ref = call i32 @ref_urem_i32(i32 %x, i32 2147483647)
+    %urem2147483647.ne = icmp ne i32 %urem2147483647, %urem2147483647.ref
+    %urem2147483647.err = zext i1 %urem2147483647.ne to i32
+    %acc40 = add i32 %acc39, %urem2147483647.err
+    ret i32 %acc40
+}
+
+define internal i64 @ref_sdiv_i64(i64 %x, i64 %d) noinline {
+entry:
+    %q = sdiv i64 %x, %d
+    ret i64 %q
+}
+
+define internal i64 @ref_udiv_i64(i64 %x, i64 %d) noinline {
+entry:
+    %q = udiv i64 %x, %d
+    ret i64 %q
+}
+
+define internal i64 @ref_srem_i64(i64 %x, i64 %d) noinline {
+entry:
+    %q = srem i64 %x, %d
+    ret i64 %q
+}
+
+define internal i64 @ref_urem_i64(i64 %x, i64 %d) noinline {
+entry:
+    %q = urem i64 %x, %d
+    ret i64 %q
+}
+
+; Numero di risultati diversi tra divisione per costante e divisione vera
+define internal i32 @check_i64(i64 %x) noinline {
+entry:
+    %sdiv3 = sdiv i64 %x, 3
+    %sdiv3.ref = call i64 @ref_sdiv_i64(i64 %x, i64 3)
+    %sdiv3.ne = icmp ne i64 %sdiv3, %sdiv3.ref
+    %sdiv3.err = zext i1 %sdiv3.ne to i32
+    %acc1 = add i32 0, %sdiv3.err
+    %udiv3 = udiv i64 %x, 3
+    %udiv3.ref = call i64 @ref_udiv_i64(i64 %x, i64 3)
+    %udiv3.ne = icmp ne i64 %udiv3, %udiv3.ref
+    %udiv3.err = zext i1 %udiv3.ne to i32
+    %acc2 = add i32 %acc1, %udiv3.err
+    %srem3 = srem i64 %x, 3
+    %srem3.ref = call i64 @ref_srem_i64(i64 %x, i64 3)
+    %srem3.ne = icmp ne i64 %srem3, %srem3.ref
+    %srem3.err = zext i1 %srem3.ne to i32
+    %acc3 = add i32 %acc2, %srem3.err
+    %urem3 = urem i64 %x, 3
+    %urem3.ref = call i64 @ref_urem_i64(i64 %x, i64 3)
+    %urem3.ne = icmp ne i64 %urem3, %urem3.ref
+    %urem3.err = zext i1 %urem3.ne to i32
+    %acc4 = add i32 %acc3, %urem3.err
+    %sdiv7 = sdiv i64 %x, 7
+    %sdiv7.ref = call i64 @ref_sdiv_i64(i64 %x, i64 7)
+    %sdiv7.ne = icmp ne i64 %sdiv7, %sdiv7.ref
+    %sdiv7.err = zext i1 %sdiv7.ne to i32
+    %acc5 = add i32 %acc4, %sdiv7.err
+    %udiv7 = udiv i64 %x, 7
+    %udiv7.ref = call i64 @ref_udiv_i64(i64 %x, i64 7)
+    %udiv7.ne = icmp ne i64 %udiv7, %udiv7.ref
+    %udiv7.err = zext i1 %udiv7.ne to i32
+    %acc6 = add i32 %acc5, %udiv7.err
+    %srem7 = srem i64 %x, 7
+    %srem7.ref = call i64 @ref_srem_i64(i64 %x, i64 7)
+    %srem7.ne = icmp ne i64 %srem7, %srem7.ref
+    %srem7.err = zext i1 %srem7.ne to i32
+    %acc7 = add i32 %acc6, %srem7.err
+    %urem7 = urem i64 %x, 7
+    %urem7.ref = call i64 @ref_urem_i64(i64 %x, i64 7)
+    %urem7.ne = icmp ne i64 %urem7, %urem7.ref
+    %urem7.err = zext i1 %urem7.ne to i32
+    %acc8 = add i32 %acc7, %urem7.err
+    %sdiv10 = sdiv i64 %x, 10
+    %sdiv10.ref = call i64 @ref_sdiv_i64(i64 %x, i64 10)
+    %sdiv10.ne = icmp ne i64 %sdiv10, %sdiv10.ref
+    %sdiv10.err = zext i1 %sdiv10.ne to i32
+    %acc9 = add i32 %acc8, %sdiv10.err
+    %udiv10 = udiv i64 %x, 10
+    %udiv10.ref = call i64 @ref_udiv_i64(i64 %x, i64 10)
+    %udiv10.ne = icmp ne i64 %udiv10, %udiv10.ref
+    %udiv10.err = zext i1 %udiv10.ne to i32
+    %acc10 = add i32 %acc9, %udiv10.err
+    %srem10 = srem i64 %x, 10
+    %srem10.ref = call i64 @ref_srem_i64(i64 %x, i64 10)
+    %srem10.ne = icmp ne i64 %srem10, %srem10.ref
+    %srem10.err = zext i1 %srem10.ne to i32
+    %acc11 = add i32 %acc10, %srem10.err
+    %urem10 = urem i64 %x, 10
+    %urem10.ref = call i64 @ref_urem_i64(i64 %x, i64 10)
+    %urem10.ne = icmp ne i64 %urem10, %urem10.ref
+    %urem10.err = zext i1 %urem10.ne to i32
+    %acc12 = add i32 %acc11, %urem10.err
+    %sdiv1000 = sdiv i64 %x, 1000
+    %sdiv1000.ref = call i64 @ref_sdiv_i64(i64 %x, i64 1000)
+    %sdiv1000.ne = icmp ne i64 %sdiv1000, %sdiv1000.ref
+    %sdiv1000.err = zext i1 %sdiv1000.ne to i32
+    %acc13 = add i32 %acc12, %sdiv1000.err
+    %udiv1000 = udiv i64 %x, 1000
+    %udiv1000.ref = call i64 @ref_udiv_i64(i64 %x, i64 1000)
+    %udiv1000.ne = icmp ne i64 %udiv1000, %udiv1000.ref
+    %udiv1000.err = zext i1 %udiv1000.ne to i32
+    %acc14 = add i32 %acc13, %udiv1000.err
+    %srem1000 = srem i64 %x, 1000
+    %srem1000.ref = call i64 @ref_srem_i64(i64 %x, i64 1000)
+    %srem1000.ne = icmp ne i64 %srem1000, %srem1000.ref
+    %srem1000.err = zext i1 %srem1000.ne to i32
+    %acc15 = add i32 %acc14, %srem1000.err
+    %urem1000 = urem i64 %x, 1000
+    %urem1000.ref = call i64 @ref_urem_i64(i64 %x, i64 1000)
+    %urem1000.ne = icmp ne i64 %urem1000, %urem1000.ref
+    %urem1000.err = zext i1 %urem1000.ne to i32
+    %acc16 = add i32 %acc15, %urem1000.err
+    %sdiv641 = sdiv i64 %x, 641
+    %sdiv641.ref = call i64 @ref_sdiv_i64(i64 %x, i64 641)
+    %sdiv641.ne = icmp ne i64 %sdiv641, %sdiv641.ref
+    %sdiv641.err = zext i1 %sdiv641.ne to i32
+    %acc17 = add i32 %acc16, %sdiv641.err
+    %udiv641 = udiv i64 %x, 641
+    %udiv641.ref = call i64 @ref_udiv_i64(i64 %x, i64 641)
+    %udiv641.ne = icmp ne i64 %udiv641, %udiv641.ref
+    %udiv641.err = zext i1 %udiv641.ne to i32
+    %acc18 = add i32 %acc17, %udiv641.err
+    %srem641 = srem i64 %x, 641
+    %srem641.ref = call i64 @ref_srem_i64(i64 %x, i64 641)
+    %srem641.ne = icmp ne i64 %srem641, %srem641.ref
+    %srem641.err = zext i1 %srem641.ne to i32
+    %acc19 = add i32 %acc18, %srem641.err
+    %urem641 = urem i64 %x, 641
+    %urem641.ref = call i64 @ref_urem_i64(i64 %x, i64 641)
+    %urem641.ne = icmp ne i64 %urem641, %urem641.ref
+    %urem641.err = zext i1 %urem641.ne to i32
+    %acc20 = add i32 %acc19, %urem641.err
+    %sdiv1000000007 = sdiv i64 %x, 1000000007
+    %sdiv1000000007.ref = call i64 @ref_sdiv_i64(i64 %x, i64 1000000007)
+    %sdiv1000000007.ne = icmp ne i64 %sdiv1000000007, %sdiv1000000007.ref
+    %sdiv1000000007.err = zext i1 %sdiv1000000007.ne to i32
+    %acc21 = add i32 %acc20, %sdiv1000000007.err
+    %udiv1000000007 = udiv i64 %x, 1000000007
+    %udiv1000000007.ref = call i64 @ref_udiv_i64(i64 %x, i64 1000000007)
+    %udiv1000000007.ne = icmp ne i64 %udiv1000000007, %udiv1000000007.ref
+    %udiv1000000007.err = zext i1 %udiv1000000007.ne to i32
+    %acc22 = add i32 %acc21, %udiv1000000007.err
+    %srem1000000007 = srem i64 %x, 1000000007
+    %srem1000000007.ref = call i64 @ref_srem_i64(i64 %x, i64 1000000007)
+    %srem1000000007.ne = icmp ne i64 %srem1000000007, %srem1000000007.ref
+    %srem1000000007.err = zext i1 %srem1000000007.ne to i32
+    %acc23 = add i32 %acc22, %srem1000000007.err
+    %urem1000000007 = urem i64 %x, 1000000007
+    %urem1000000007.ref = call i64 @ref_urem_i64(i64 %x, i64 1000000007)
+    %urem1000000007.ne = icmp ne i64 %urem1000000007, %urem1000000007.ref
+    %urem1000000007.err = zext i1 %urem1000000007.ne to i32
+    %acc24 = add i32 %acc23, %urem1000000007.err
+    %sdiv32 = sdiv i64 %x, 32
+    %sdiv32.ref = call i64 @ref_sdiv_i64(i64 %x, i64 32)
+    %sdiv32.ne = icmp ne i64 %sdiv32, %sdiv32.ref
+    %sdiv32.err = zext i1 %sdiv32.ne to i32
+    %acc25 = add i32 %acc24, %sdiv32.err
+    %udiv32 = udiv i64 %x, 32
+    %udiv32.ref = call i64 @ref_udiv_i64(i64 %x, i64 32)
+    %udiv32.ne = icmp ne i64 %udiv32, %udiv32.ref
+    %udiv32.err = zext i1 %udiv32.ne to i32
+    %acc26 = add i32 %acc25, %udiv32.err
+    %srem32 = srem i64 %x, 32
+    %srem32.ref = call i64 @ref_srem_i64(i64 %x, i64 32)
+    %srem32.ne = icmp ne i64 %srem32, %srem32.ref
+    %srem32.err = zext i1 %srem32.ne to i32
+    %acc27 = add i32 %acc26, %srem32.err
+    %urem32 = urem i64 %x, 32
+    %urem32.ref = call i64 @ref_urem_i64(i64 %x, i64 32)
+    %urem32.ne = icmp ne i64 %urem32, %urem32.ref
+    %urem32.err = zext i1 %urem32.ne to i32
+    %acc28 = add i32 %acc27, %urem32.err
+    %sdivm7 = sdiv i64 %x, -7
+    %sdivm7.ref = call i64 @ref_sdiv_i64(i64 %x, i64 -7)
+    %sdivm7.ne = icmp ne i64 %sdivm7, %sdivm7.ref
+    %sdivm7.err = zext i1 %sdivm7.ne to i32
+    %acc29 = add i32 %acc28, %sdivm7.err
+    %udivm7 = udiv i64 %x, -7
+    %udivm7.ref = call i64 @ref_udiv_i64(i64 %x, i64 -7)
+    %udivm7.ne = icmp ne i64 %udivm7, %udivm7.ref
+    %udivm7.err = zext i1 %udivm7.ne to i32
+    %acc30 = add i32 %acc29, %udivm7.err
+    %sremm7 = srem i64 %x, -7
+    %sremm7.ref = call i64 @ref_srem_i64(i64 %x, i64 -7)
+    %sremm7.ne = icmp ne i64 %sremm7, %sremm7.ref
+    %sremm7.err = zext i1 %sremm7.ne to i32
+    %acc31 = add i32 %acc30, %sremm7.err
+    %uremm7 = urem i64 %x, -7
+    %uremm7.ref = call i64 @ref_urem_i64(i64 %x, i64 -7)
+    %uremm7.ne = icmp ne i64 %uremm7, %uremm7.ref
+    %uremm7.err = zext i1 %uremm7.ne to i32
+    %acc32 = add i32 %acc31, %uremm7.err
+    %sdivm1000 = sdiv i64 %x, -1000
+    %sdivm1000.ref = call i64 @ref_sdiv_i64(i64 %x, i64 -1000)
+    %sdivm1000.ne = icmp ne i64 %sdivm1000, %sdivm1000.ref
+    %sdivm1000.err = zext i1 %sdivm1000.ne to i32
+    %acc33 = add i32 %acc32, %sdivm1000.err
+    %udivm1000 = udiv i64 %x, -1000
+    %udivm1000.ref = call i64 @ref_udiv_i64(i64 %x, i64 -1000)
+    %udivm1000.ne = icmp ne i64 %udivm1000, %udivm1000.ref
+    %udivm1000.err = zext i1 %udivm1000.ne to i32
+    %acc34 = add i32 %acc33, %udivm1000.err
+    %sremm1000 = srem i64 %x, -1000
+    %sremm1000.ref = call i64 @ref_srem_i64(i64 %x, i64 -1000)
+    %sremm1000.ne = icmp ne i64 %sremm1000, %sremm1000.ref
+    %sremm1000.err = zext i1 %sremm1000.ne to i32
+    %acc35 = add i32 %acc34, %sremm1000.err
+    %uremm1000 = urem i64 %x, -1000
+    %uremm1000.ref = call i64 @ref_urem_i64(i64 %x, i64 -1000)
+    %uremm1000.ne = icmp ne i64 %uremm1000, %uremm1000.ref
+    %uremm1000.err = zext i1 %uremm1000.ne to i32
+    %acc36 = add i32 %acc35, %uremm1000.err
+    ret i32 %acc36
+}
+
+; Tutti i valori a 8 bit
+define internal i32 @exhaustive_i8() noinline {
+entry:
+    br label %loop
+loop:
+    %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+    %err = phi i32 [ 0, %entry ], [ %err.next, %loop ]
+    %x = trunc i32 %i to i8
+    %e = call i32 @check_i8(i8 %x)
+    %err.next = add i32 %err, %e
+    %i.next = add i32 %i, 1
+    %done = icmp eq i32 %i.next, 256
+    br i1 %done, label %exit, label %loop
+exit:
+    %tests = mul i32 256, 40
+    call i32 (ptr, ...) @printf(ptr @fmt, i32 8, i32 %err.next, i32 %tests)
+    ret i32 %err.next
+}
+
+; Tutti i valori a 16 bit
+define internal i32 @exhaustive_i16() noinline {
+entry:
+    br label %loop
+loop:
+    %i = phi i32 [ 0, %entry ], [ %i.next, %loop ]
+    %err = phi i32 [ 0, %entry ], [ %err.next, %loop ]
+    %x = trunc i32 %i to i16
+    %e = call i32 @check_i16(i16 %x)
+    %err.next = add i32 %err, %e
+    %i.next = add i32 %i, 1
+    %done = icmp eq i32 %i.next, 65536
+    br i1 %done, label %exit, label %loop
+exit:
+    %tests = mul i32 65536, 36
+    call i32 (ptr, ...) @printf(ptr @fmt, i32 16, i32 %err.next, i32 %tests)
+    ret i32 %err.next
+}
+
+; Valori ai bordi, poi 1000000 valori casuali (xorshift64)
+define internal i32 @random_i32() noinline {
+entry:
+    br label %bounds
+bounds:
+    %b = phi i32 [ 0, %entry ], [ %b.next, %bounds ]
+    %berr = phi i32 [ 0, %entry ], [ %berr.next, %bounds ]
+    %bp = getelementptr inbounds [35 x i32], ptr @bounds_i32, i32 0, i32 %b
+    %bx = load i32, ptr %bp
+    %be = call i32 @check_i32(i32 %bx)
+    %berr.next = add i32 %berr, %be
+    %b.next = add i32 %b, 1
+    %bdone = icmp eq i32 %b.next, 35
+    br i1 %bdone, label %loop, label %bounds
+loop:
+    %i = phi i32 [ 0, %bounds ], [ %i.next, %loop ]
+    %err = phi i32 [ %berr.next, %bounds ], [ %err.next, %loop ]
+    %s = phi i64 [ 88172645463325252, %bounds ], [ %s3, %loop ]
+    %t1 = shl i64 %s, 13
+    %s1 = xor i64 %s, %t1
+    %t2 = lshr i64 %s1, 7
+    %s2 = xor i64 %s1, %t2
+    %t3 = shl i64 %s2, 17
+    %s3 = xor i64 %s2, %t3
+    %x = trunc i64 %s3 to i32
+    %e = call i32 @check_i32(i32 %x)
+    %err.next = add i32 %err, %e
+    %i.next = add i32 %i, 1
+    %done = icmp eq i32 %i.next, 1000000
+    br i1 %done, label %exit, label %loop
+exit:
+    %values = add i32 1000000, 35
+    %tests = mul i32 %values, 40
+    call i32 (ptr, ...) @printf(ptr @fmt, i32 32, i32 %err.next, i32 %tests)
+    ret i32 %err.next
+}
+
+; Valori ai bordi, poi 1000000 valori casuali (xorshift64)
+define internal i32 @random_i64() noinline {
+entry:
+    br label %bounds
+bounds:
+    %b = phi i32 [ 0, %entry ], [ %b.next, %bounds ]
+    %berr = phi i32 [ 0, %entry ], [ %berr.next, %bounds ]
+    %bp = getelementptr inbounds [33 x i64], ptr @bounds_i64, i32 0, i32 %b
+    %bx = load i64, ptr %bp
+    %be = call i32 @check_i64(i64 %bx)
+    %berr.next = add i32 %berr, %be
+    %b.next = add i32 %b, 1
+    %bdone = icmp eq i32 %b.next, 33
+    br i1 %bdone, label %loop, label %bounds
+loop:
+    %i = phi i32 [ 0, %bounds ], [ %i.next, %loop ]
+    %err = phi i32 [ %berr.next, %bounds ], [ %err.next, %loop ]
+    %s = phi i64 [ 88172645463325252, %bounds ], [ %s3, %loop ]
+    %t1 = shl i64 %s, 13
+    %s1 = xor i64 %s, %t1
+    %t2 = lshr i64 %s1, 7
+    %s2 = xor i64 %s1, %t2
+    %t3 = shl i64 %s2, 17
+    %s3 = xor i64 %s2, %t3
+    %e = call i32 @check_i64(i64 %s3)
+    %err.next = add i32 %err, %e
+    %i.next = add i32 %i, 1
+    %done = icmp eq i32 %i.next, 1000000
+    br i1 %done, label %exit, label %loop
+exit:
+    %values = add i32 1000000, 33
+    %tests = mul i32 %values, 36
+    call i32 (ptr, ...) @printf(ptr @fmt, i32 64, i32 %err.next, i32 %tests)
+    ret i32 %err.next
+}
+
+define i32 @main() {
+entry:
+    %e8 = call i32 @exhaustive_i8()
+    %e16 = call i32 @exhaustive_i16()
+    %e32 = call i32 @random_i32()
+    %e64 = call i32 @random_i64()
+    %a = add i32 %e8, %e16
+    %b = add i32 %a, %e32
+    %c = add i32 %b, %e64
+    %fail = icmp ne i32 %c, 0
+    %ret = zext i1 %fail to i32
+    ret i32 %ret
+}
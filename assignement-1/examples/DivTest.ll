@@ -0,0 +1,34 @@
+; Divisioni e resti per costante: vengono trasformati in moltiplicazione per
+; il magic number e shift
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define i32 @div_pow2(i32 %x) {
+entry:
+    %s = sdiv i32 %x, 4       ; Shift with rounding fix-up for negative %x
+    %u = udiv i32 %x, 4       ; Should optimize to %x >> 2
+    %r = urem i32 %x, 8       ; Should optimize to %x & 7
+    %a = add i32 %s, %u
+    %b = add i32 %a, %r
+    ret i32 %b
+}
+
+define i32 @div_const(i32 %x) {
+entry:
+    %d3 = sdiv i32 %x, 3      ; mulhs(%x, 0x55555556) + sign bit
+    %d7 = udiv i32 %x, 7      ; Magic number needs 33 bits: add sequence
+    %d10 = sdiv i32 %x, -10   ; Negative divisor
+    %r1000 = urem i32 %x, 1000
+    %a = add i32 %d3, %d7
+    %b = add i32 %a, %d10
+    %c = add i32 %b, %r1000
+    ret i32 %c
+}
+
+define i64 @div_i64(i64 %x) {
+entry:
+    %q = sdiv i64 %x, 1000
+    %r = srem i64 %x, 7
+    %s = add i64 %q, %r
+    ret i64 %s
+}
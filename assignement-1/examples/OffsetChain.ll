@@ -0,0 +1,24 @@
+; Catene di add/sub con costanti: vengono ridotte a un unico offset
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+define i32 @chain(i32 %x) {
+entry:
+    %a = add i32 %x, 5      ; x + 5
+    %b = sub i32 %a, 5      ; Should optimize to %x
+    %c = add i32 %b, 10     ; x + 10
+    %d = sub i32 %c, 3      ; Should optimize to x + 7
+    %e = add i32 2, %d      ; Should optimize to x + 9
+    %f = sub i32 %e, 9      ; Should optimize to %x
+    %g = mul i32 %f, %c
+    ret i32 %g
+}
+
+define i32 @shared(i32 %x) {
+entry:
+    %a = sub i32 %x, 4      ; x - 4
+    %b = add i32 %a, 4      ; Should optimize to %x
+    %c = add i32 %a, 1      ; Should optimize to x - 3
+    %r = add i32 %b, %c
+    ret i32 %r
+}
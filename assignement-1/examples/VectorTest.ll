@@ -0,0 +1,57 @@
+; Identità algebriche e strength reduction su vettori da 128, 256 e 512 bit,
+; con costanti splat e costanti diverse per ogni lane
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+; 128 bit
+define <4 x i32> @v128(<4 x i32> %x) {
+entry:
+    %a = add <4 x i32> %x, zeroinitializer                  ; Should optimize to %x
+    %m = mul <4 x i32> %a, <i32 4, i32 4, i32 4, i32 4>     ; Should optimize to %x << 2
+    %l = mul <4 x i32> %m, <i32 1, i32 2, i32 8, i32 16>    ; Per-lane shift
+    %d = udiv <4 x i32> %l, <i32 2, i32 4, i32 8, i32 16>   ; Per-lane lshr
+    %r = urem <4 x i32> %d, <i32 8, i32 8, i32 8, i32 8>    ; Should optimize to %d & 7
+    ret <4 x i32> %r
+}
+
+define <16 x i8> @v128_i8(<16 x i8> %x) {
+entry:
+    %m = mul <16 x i8> %x, <i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10, i8 10>
+    %d = sdiv <16 x i8> %m, <i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3, i8 3>
+    ret <16 x i8> %d
+}
+
+; 256 bit
+define <8 x i32> @v256(<8 x i32> %x) {
+entry:
+    %s = sub <8 x i32> %x, zeroinitializer                  ; Should optimize to %x
+    %m = mul <8 x i32> %s, <i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1>
+    %t = mul <8 x i32> %m, <i32 7, i32 7, i32 7, i32 7, i32 7, i32 7, i32 7, i32 7>
+    %a = add <8 x i32> %t, <i32 5, i32 5, i32 5, i32 5, i32 5, i32 5, i32 5, i32 5>
+    %b = sub <8 x i32> %a, <i32 5, i32 5, i32 5, i32 5, i32 5, i32 5, i32 5, i32 5>  ; Should optimize to %t
+    %d = udiv <8 x i32> %b, <i32 10, i32 10, i32 10, i32 10, i32 10, i32 10, i32 10, i32 10>
+    ret <8 x i32> %d
+}
+
+define <4 x i64> @v256_i64(<4 x i64> %x) {
+entry:
+    %m = mul <4 x i64> %x, <i64 45, i64 45, i64 45, i64 45>
+    %d = sdiv <4 x i64> %m, <i64 -8, i64 -8, i64 -8, i64 -8>
+    ret <4 x i64> %d
+}
+
+; 512 bit
+define <16 x i32> @v512(<16 x i32> %x) {
+entry:
+    %m = mul <16 x i32> %x, <i32 2, i32 4, i32 8, i32 16, i32 32, i32 64, i32 128, i32 256, i32 2, i32 4, i32 8, i32 16, i32 32, i32 64, i32 128, i32 256>
+    %d = sdiv <16 x i32> %m, <i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1, i32 1>
+    %r = srem <16 x i32> %d, <i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000, i32 1000>
+    ret <16 x i32> %r
+}
+
+define <8 x i64> @v512_i64(<8 x i64> %x) {
+entry:
+    %m = mul <8 x i64> %x, <i64 12, i64 12, i64 12, i64 12, i64 12, i64 12, i64 12, i64 12>
+    %d = udiv <8 x i64> %m, <i64 1, i64 2, i64 4, i64 8, i64 16, i64 32, i64 64, i64 128>
+    ret <8 x i64> %d
+}
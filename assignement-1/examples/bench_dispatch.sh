@@ -0,0 +1,49 @@
+#!/bin/bash
+# Microbenchmark del dispatch delle regole: replica gli esempi *.ll di questa
+# cartella in un unico modulo grande (ogni copia con i simboli rinominati) e
+# misura -passes=all con l'indice per opcode e con -combiner-linear-dispatch,
+# che prova tutte le regole in sequenza come la vecchia catena di dyn_cast.
+#
+#   ./bench_dispatch.sh [copie] [plugin]
+#
+# OPT e LLVM_LINK scelgono gli strumenti di LLVM da usare.
+set -e
+COPIES=${1:-200}
+PLUGIN=${2:-../build/libAssignement1.so}
+OPT=${OPT:-opt}
+LLVM_LINK=${LLVM_LINK:-llvm-link}
+
+cd "$(dirname "$0")"
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Ogni copia aggiunge .F.K ai nomi delle funzioni definite e delle globali
+# (F è l'indice del file, K quello della copia)
+i=0
+for f in *.ll; do
+  i=$((i + 1))
+  syms=$(sed -nE 's/^define [^@]*@([-A-Za-z$._0-9]+)\(.*/\1/p; s/^@([-A-Za-z$._0-9]+) =.*/\1/p' "$f")
+  script=""
+  for s in $syms; do
+    script+="s/@$s([^-A-Za-z\$._0-9])/@$s.$i.__K__\\1/g;"
+  done
+  sed -E "$script" "$f" > "$TMP/${f%.ll}.tpl"
+done
+for ((k = 0; k < COPIES; k++)); do
+  for t in "$TMP"/*.tpl; do
+    sed "s/__K__/$k/g" "$t" > "${t%.tpl}.$k.ll"
+  done
+done
+"$LLVM_LINK" --suppress-warnings "$TMP"/*.*.ll -o "$TMP/corpus.bc"
+echo "Modulo: $(cat "$TMP"/*.*.ll | grep -c '^define') funzioni ($COPIES copie)"
+
+# Tempo reale del pass secondo -time-passes (quarta colonna senza
+# percentuali), il minimo su 5 esecuzioni
+for mode in "indice per opcode:" "catena di regole:-combiner-linear-dispatch"; do
+  t=$(for r in 1 2 3 4 5; do
+        "$OPT" -load="$PLUGIN" -load-pass-plugin="$PLUGIN" -passes=all ${mode#*:} \
+          -time-passes "$TMP/corpus.bc" -o /dev/null 2>&1 |
+        grep AllOpts | sed -E 's/\( *[0-9.]+%\)//g' | awk '{print $4}'
+      done | sort -n | head -1)
+  echo "${mode%%:*} $t s"
+done
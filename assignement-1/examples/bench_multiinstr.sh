@@ -0,0 +1,41 @@
+#!/bin/bash
+# Benchmark di scalabilità di multi-instruction: genera funzioni con un solo
+# blocco di 1000, 10000 e 100000 istruzioni e misura il tempo del pass. Il
+# blocco alterna add/sub con costante usate da una mul (nessuna coppia da
+# semplificare: con la vecchia scansione del resto del blocco erano il caso
+# quadratico), coppie che si annullano e catene di offset da unire. Con la
+# ricerca lungo gli utilizzatori il tempo per istruzione resta costante.
+#
+#   ./bench_multiinstr.sh [plugin]
+#
+# OPT sceglie l'opt di LLVM da usare.
+set -e
+PLUGIN=${1:-../build/libAssignement1.so}
+OPT=${OPT:-opt}
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+for n in 1000 10000 100000; do
+  # Ogni gruppo di 5 istruzioni: add e mul senza inversa, coppia add/sub
+  # che si annulla, sub che si unisce all'offset della add precedente
+  awk -v n="$n" 'BEGIN {
+    print "define i32 @f(i32 %x) {"
+    print "entry:"
+    acc = "%x"
+    for (i = 0; i < n / 5; i++) {
+      c = i % 100 + 1
+      printf "  %%a%d = add i32 %%x, %d\n", i, c
+      printf "  %%m%d = mul i32 %%a%d, %s\n", i, i, acc
+      printf "  %%p%d = add i32 %%m%d, %d\n", i, i, c
+      printf "  %%q%d = sub i32 %%p%d, %d\n", i, i, c
+      printf "  %%r%d = sub i32 %%q%d, %d\n", i, i, c + 1
+      acc = "%r" i
+    }
+    printf "  ret i32 %s\n}\n", acc
+  }' > "$TMP/block$n.ll"
+  t=$("$OPT" -load-pass-plugin="$PLUGIN" -passes=multi-instruction -time-passes \
+        "$TMP/block$n.ll" -o /dev/null 2>&1 |
+      grep MultiInstr | sed -E 's/\( *[0-9.]+%\)//g' | awk '{print $4}')
+  echo "$n istruzioni: $t s ($(awk -v t="$t" -v n="$n" 'BEGIN { printf "%.2f", t * 1e6 / n }') us per istruzione)"
+done
@@ -20,8 +20,23 @@
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/PassPlugin.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Analysis/AliasAnalysis.h"
 #include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/LoopIterator.h"
+#include "llvm/Analysis/MemorySSA.h"
+#include "llvm/Analysis/CFG.h"
+#include "llvm/Analysis/DomTreeUpdater.h"
+#include "llvm/Analysis/MustExecute.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ValueTracking.h"
 #include "llvm/IR/Dominators.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Transforms/Scalar/LoopPassManager.h"
+#include "llvm/Transforms/Utils/BasicBlockUtils.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/LoopUtils.h"
+#include "llvm/Transforms/Utils/SSAUpdater.h"
 
 using namespace llvm;
 
@@ -32,46 +47,117 @@ using namespace llvm;
 // everything in an anonymous namespace.
 namespace
 {
+  cl::opt<unsigned> UnswitchThreshold(
+      "licm-unswitch-threshold",
+      cl::desc("Numero massimo di istruzioni che l'unswitching può generare "
+               "per un loop, contando tutte le sue versioni"),
+      cl::init(128));
+
+  // Numero di unswitching già applicati al loop (e alle sue copie)
+  const char* UnswitchCountMD = "loop-invariant.unswitch.count";
+
+  // Promozione di una locazione di memoria a valore SSA: LoadAndStorePromoter
+  // sostituisce le load del loop con il valore corrente e cancella le store,
+  // noi aggiungiamo nelle uscite la store del valore finale (passando per
+  // una phi LCSSA, dato che il valore è definito nel loop)
+  class LoopPromoter : public LoadAndStorePromoter {
+    Value* Ptr;
+    Type* Ty;
+    Align Alignment;
+    ArrayRef<BasicBlock*> ExitBlocks;
+    SSAUpdater &SSA;
+
+  public:
+    LoopPromoter(Value* Ptr, Type* Ty, Align Alignment, ArrayRef<const Instruction*> Insts,
+                 SSAUpdater &SSA, ArrayRef<BasicBlock*> ExitBlocks)
+        : LoadAndStorePromoter(Insts, SSA), Ptr(Ptr), Ty(Ty), Alignment(Alignment),
+          ExitBlocks(ExitBlocks), SSA(SSA) {}
+
+    void doExtraRewritesBeforeFinalDeletion() override {
+      for(BasicBlock* Exit : ExitBlocks) {
+        IRBuilder<> PhiBuilder(&Exit->front());
+        PHINode* Final = PhiBuilder.CreatePHI(Ty, pred_size(Exit), Ptr->getName() + ".lcssa");
+        for(BasicBlock* Pred : predecessors(Exit)) {
+          Final->addIncoming(SSA.GetValueAtEndOfBlock(Pred), Pred);
+        }
+        IRBuilder<> Builder(Exit, Exit->getFirstInsertionPt());
+        Builder.CreateAlignedStore(Final, Ptr, Alignment);
+      }
+    }
+  };
+
   // New PM implementation
   struct LoopInvariant : PassInfoMixin<LoopInvariant>
   {
-    bool isLoopInv(BinaryOperator &I, Loop &L) {
-      Value* firstOp = I.getOperand(0);
-      Value* secondOp = I.getOperand(1);
-      
-      bool firstOpLI = false;
-      bool secondOpLI = false;
-
-      if(dyn_cast<Constant>(firstOp)) firstOpLI = true;
-      if(Instruction* inst = dyn_cast<Instruction>(firstOp)) {
-        if(!L.contains(inst->getParent())) firstOpLI = true;
-        if(BinaryOperator* binOp = dyn_cast<BinaryOperator>(inst)) firstOpLI = isLoopInv(*binOp, L);
+    // Tipi di istruzione senza effetti collaterali: il risultato dipende solo
+    // dagli operandi, quindi se questi sono invarianti lo è anche l'istruzione
+    bool isInvariantKind(Instruction &I) {
+      if(isa<BinaryOperator>(I) || isa<CastInst>(I) || isa<GetElementPtrInst>(I) ||
+         isa<CmpInst>(I) || isa<SelectInst>(I)) {
+        return true;
       }
-      
-      if(dyn_cast<Constant>(secondOp)) secondOpLI = true;
-      if(Instruction* inst = dyn_cast<Instruction>(secondOp)) {
-        if(!L.contains(inst->getParent())) secondOpLI = true;
-        if(BinaryOperator* binOp = dyn_cast<BinaryOperator>(inst)) secondOpLI = isLoopInv(*binOp, L);
+      // Chiamate a funzioni che non accedono alla memoria e terminano sempre
+      if(CallInst* call = dyn_cast<CallInst>(&I)) {
+        return call->doesNotAccessMemory() && !call->mayHaveSideEffects();
+      }
+      return false;
+    }
+
+    // Un operando è invariante se è una costante, un argomento della funzione,
+    // è definito fuori dal loop oppure è già stato marcato come invariante
+    bool isInvariantOperand(Value* Op, Loop &L, const SmallPtrSetImpl<Instruction*> &Invariant) {
+      if(isa<Constant>(Op) || isa<Argument>(Op)) return true;
+      if(Instruction* inst = dyn_cast<Instruction>(Op)) {
+        return !L.contains(inst) || Invariant.count(inst);
       }
+      return false;
+    }
 
-      return firstOpLI && secondOpLI;
+    // Una load da un indirizzo invariante è invariante se nessuna istruzione
+    // del loop può scrivere nella locazione letta
+    bool isInvariantLoad(LoadInst &Load, ArrayRef<Instruction*> Writers, AAResults &AA) {
+      if(!Load.isSimple()) return false;
+      MemoryLocation Loc = MemoryLocation::get(&Load);
+      return none_of(Writers, [&](Instruction* W) {
+        return isModSet(AA.getModRefInfo(W, Loc));
+      });
     }
 
-    std::vector<Instruction*> getLoopInvInstr(Loop &L) {
+    std::vector<Instruction*> getLoopInvInstr(Loop &L, LoopInfo &LI, AAResults* AA) {
       // LoopInvInst is the vector of loop invariant instructions
       std::vector<Instruction*> LoopInvInst = {};
-      // TODO ragionare se l'istruzione è una phi function cosa sta succedendo
-      // L'istruzione per controllare se un'istruzione è una phi function è: 
-      //llvm::<Instruction*> I;
-      //isa<PHINode>(I) 
+      SmallPtrSet<Instruction*, 32> Invariant;
 
-      for(Loop::block_iterator BI = L.block_begin(); BI != L.block_end(); ++BI) {
-        llvm::BasicBlock *BB = *BI;
+      // Istruzioni del loop che scrivono in memoria, per decidere sulle load
+      SmallVector<Instruction*, 16> Writers;
+      if(AA) {
+        for(BasicBlock* BB : L.blocks()) {
+          for(auto &I : *BB) {
+            if(I.mayWriteToMemory()) Writers.push_back(&I);
+          }
+        }
+      }
+
+      // In reverse post-order la definizione di un operando viene visitata prima
+      // dei suoi usi (le phi sono le uniche eccezioni, e non sono mai invarianti):
+      // basta una sola passata sul corpo del loop e ogni controllo costa O(1),
+      // invece di ripercorrere ricorsivamente le catene di operandi
+      LoopBlocksRPO RPO(&L);
+      RPO.perform(&LI);
+      for(BasicBlock* BB : RPO) {
         for(auto &I : *BB) {
-          if(BinaryOperator *binOp = dyn_cast<BinaryOperator>(&I)) {
-            if(isLoopInv(*binOp, L)) {
-              LoopInvInst.push_back(&I);
-            }
+          LoadInst* Load = dyn_cast<LoadInst>(&I);
+          if(Load) {
+            if(!AA || !isInvariantLoad(*Load, Writers, *AA)) continue;
+          } else if(!isInvariantKind(I)) {
+            continue;
+          }
+          bool allInvariant = all_of(I.operands(), [&](Value* Op) {
+            return isInvariantOperand(Op, L, Invariant);
+          });
+          if(allInvariant) {
+            Invariant.insert(&I);
+            LoopInvInst.push_back(&I);
           }
         }
       }
@@ -79,20 +165,41 @@ namespace
     } 
 
 
-    bool isInstrDead(Instruction* I, BasicBlock* ExitBlock) {
-      // Scorro su i successori del blocco d'uscita
-      for (BasicBlock *Succ : successors(ExitBlock)) {
-        for (User* U : I->users()) {
-          // Casto l'uso a un'istruzione
-          if (Instruction* UseInst = dyn_cast<Instruction>(U)) {
-            // Se hanno la stessa reaching definition allora sono la stessa istruzione, dunque non è morta.
-            if (UseInst->getParent() == Succ) {
-                return false;
-            }
-          }
+    // Un'istruzione è viva in un'uscita del loop se almeno un suo uso fuori dal
+    // loop si trova in un blocco raggiungibile a partire dall'uscita (le phi
+    // LCSSA nell'uscita stessa contano come uso)
+    bool isLiveAtExit(Instruction* I, BasicBlock* ExitBlock, Loop &L, DominatorTree &DT, LoopInfo &LI) {
+      for (User* U : I->users()) {
+        Instruction* UseInst = dyn_cast<Instruction>(U);
+        if (!UseInst || L.contains(UseInst)) continue;
+        BasicBlock* UseBB = UseInst->getParent();
+        if (UseBB == ExitBlock || isPotentiallyReachable(ExitBlock, UseBB, nullptr, &DT, &LI)) {
+          return true;
         }
       }
-      return true;
+      return false;
+    }
+
+    // Un'istruzione può essere eseguita anche quando il loop originale non
+    // l'avrebbe eseguita se non può sollevare eccezioni. Per divisioni e resti
+    // con divisore variabile proviamo con SCEV che il divisore non sia mai zero
+    // (e, per quelle con segno, che non si arrivi a INT_MIN / -1)
+    bool canSpeculate(Instruction* I, ScalarEvolution &SE) {
+      if (isSafeToSpeculativelyExecute(I)) return true;
+
+      unsigned Opcode = I->getOpcode();
+      if (Opcode != Instruction::UDiv && Opcode != Instruction::URem &&
+          Opcode != Instruction::SDiv && Opcode != Instruction::SRem) {
+        return false;
+      }
+      const SCEV* Divisor = SE.getSCEV(I->getOperand(1));
+      if (!SE.isKnownNonZero(Divisor)) return false;
+      if (Opcode == Instruction::UDiv || Opcode == Instruction::URem) return true;
+
+      unsigned BitWidth = I->getType()->getScalarSizeInBits();
+      if (!SE.getSignedRange(Divisor).contains(APInt::getAllOnes(BitWidth))) return true;
+      const SCEV* Dividend = SE.getSCEV(I->getOperand(0));
+      return !SE.getSignedRange(Dividend).contains(APInt::getSignedMinValue(BitWidth));
     }
 
     void moveInstruction(Instruction &I, Loop &L) {
@@ -104,17 +211,13 @@ namespace
       }
       BasicBlock* PH = L.getLoopPreheader();
       
-      if(Instruction* op0 = dyn_cast<Instruction>(I.getOperand(0))) {
-        if(L.contains(op0->getParent())) {
-          // Nel caso in cui l'istruzione che analizziamo dipenda da un suo operando
-          // chiamiamo ricorsivamente la funzione sull'operando per spostarlo prima.
-          moveInstruction(*op0, L);
-        }
-      }
-
-      if(Instruction* op1 = dyn_cast<Instruction>(I.getOperand(1))) {
-        if(L.contains(op1->getParent())) {
-          moveInstruction(*op1, L);
+      for(Value* Op : I.operands()) {
+        if(Instruction* opInst = dyn_cast<Instruction>(Op)) {
+          if(L.contains(opInst->getParent())) {
+            // Nel caso in cui l'istruzione che analizziamo dipenda da un suo operando
+            // chiamiamo ricorsivamente la funzione sull'operando per spostarlo prima.
+            moveInstruction(*opInst, L);
+          }
         }
       }
       // Qualora si possa procedere senza conflitti di dipendenze da altre istruzioni andiamo a spostare prima del termine del pre header 
@@ -123,53 +226,412 @@ namespace
       return;
     }
 
-    void codeMotion(Loop &L, std::vector<Instruction*> &loopInv, DominatorTree &DT) {
+    bool codeMotion(Loop &L, std::vector<Instruction*> &loopInv, LoopInfo &LI, DominatorTree &DT, ScalarEvolution &SE) {
+      bool Changed = false;
+      llvm::SmallVector<BasicBlock*> ExitBlocks;
+      L.getExitBlocks(ExitBlocks);
+
+      // Blocchi che, una volta entrati nel loop, vengono sicuramente eseguiti
+      SimpleLoopSafetyInfo SafetyInfo;
+      SafetyInfo.computeLoopSafetyInfo(&L);
+
       for(auto &I : loopInv) {
         outs()<< "Sto analizzando l'istruzione: " << *I << '\n';
+
+        // Gli operandi definiti nel loop devono essere già stati spostati:
+        // loopInv è in reverse post-order, quindi li abbiamo già considerati
+        bool operandsHoisted = all_of(I->operands(), [&](Value* Op) {
+          Instruction* opInst = dyn_cast<Instruction>(Op);
+          return !opInst || !L.contains(opInst);
+        });
+        if(!operandsHoisted) {
+          outs() << "Un operando è rimasto nel loop\n";
+          continue;
+        }
+
+        // Condizione sulle uscite: l'istruzione domina l'uscita oppure il suo
+        // valore non è vivo in quell'uscita
         bool candidate = true;
-        llvm::SmallVector<BasicBlock*> ExitBlocks;
-        L.getExitBlocks(ExitBlocks);
         for(auto &Exit : ExitBlocks) {
-          if(!DT.dominates(I->getParent(), Exit)) outs() << "L'istruzione non domina l'uscita del loop\n";
-          if(!isInstrDead(I,Exit)) outs() << "L'istruzione non è dead\n";
-          if(!DT.dominates(I->getParent(), Exit) && !isInstrDead(I, Exit)) {
+          if(DT.dominates(I->getParent(), Exit)) continue;
+          outs() << "L'istruzione non domina l'uscita del loop\n";
+          if(isLiveAtExit(I, Exit, L, DT, LI)) {
+            outs() << "L'istruzione è viva nell'uscita che non domina\n";
             candidate = false;
             break;
           }
         }
+        if(!candidate) continue;
 
-        if(candidate) {
-          moveInstruction(*I, L);
-          outs() << "Moved instruction: " << *I << "\n";
+        // Condizione di sicurezza: nel preheader l'istruzione viene eseguita
+        // anche nei cammini in cui il loop non la eseguiva (corpo condizionale),
+        // quindi deve essere eseguita comunque oppure non poter sollevare eccezioni
+        if(!SafetyInfo.isGuaranteedToExecute(*I, &DT, &L) && !canSpeculate(I, SE)) {
+          outs() << "L'istruzione non è eseguita sempre e non è speculabile\n";
+          continue;
         }
+
+        moveInstruction(*I, L);
+        // SCEV potrebbe avere in cache l'istruzione come variante nel loop
+        SE.forgetValue(I);
+        outs() << "Moved instruction: " << *I << "\n";
+        Changed = true;
       }
+      return Changed;
     }
 
-    void runOnLoop(Loop &L, DominatorTree &DT) {
+    // Scalar replacement: le load e store del loop verso lo stesso indirizzo
+    // invariante diventano un valore SSA portato da una phi, caricato nel
+    // preheader e salvato nelle uscite. Serve che:
+    //  - ogni altro accesso in memoria del loop non tocchi la locazione (AA)
+    //  - tutti gli accessi alla locazione usino lo stesso puntatore e tipo
+    //  - almeno una store sia eseguita sicuramente a ogni ingresso nel loop:
+    //    la load nel preheader è quindi valida e la store nelle uscite non
+    //    introduce scritture che il programma originale non faceva
+    //    (nei loop non ruotati l'header è l'uscita e questo non vale mai:
+    //    conviene eseguire prima loop-rotate)
+    // Gli accessi dei sotto-loop vengono promossi insieme a quelli del loop:
+    // i nuovi valori definiti nei sotto-loop e usati fuori richiedono le loro
+    // phi LCSSA, che ricostruiamo alla fine
+    bool promoteMemory(Loop &L, LoopInfo &LI, DominatorTree &DT, ScalarEvolution &SE, AAResults &AA) {
+      BasicBlock* PH = L.getLoopPreheader();
+      if(!L.hasDedicatedExits()) return false;
+      SmallVector<BasicBlock*, 4> ExitBlocks;
+      L.getUniqueExitBlocks(ExitBlocks);
+      for(BasicBlock* Exit : ExitBlocks) {
+        if(Exit->isEHPad()) return false;
+      }
+
+      SimpleLoopSafetyInfo SafetyInfo;
+      SafetyInfo.computeLoopSafetyInfo(&L);
 
-      std::vector<llvm::Instruction*> loopInv = getLoopInvInstr(L);
+      // Indirizzi invarianti su cui il loop scrive
+      SmallSetVector<Value*, 8> Pointers;
+      for(BasicBlock* BB : L.blocks()) {
+        for(auto &I : *BB) {
+          StoreInst* Store = dyn_cast<StoreInst>(&I);
+          if(!Store || !Store->isSimple()) continue;
+          Instruction* PtrInst = dyn_cast<Instruction>(Store->getPointerOperand());
+          if(!PtrInst || !L.contains(PtrInst)) Pointers.insert(Store->getPointerOperand());
+        }
+      }
+
+      bool Changed = false;
+      for(Value* Ptr : Pointers) {
+        SmallVector<Instruction*, 8> Uses;
+        StoreInst* Guaranteed = nullptr;
+        Type* Ty = nullptr;
+        bool Promotable = true;
+
+        for(BasicBlock* BB : L.blocks()) {
+          for(auto &I : *BB) {
+            if(!I.mayReadOrWriteMemory()) continue;
+            if(getLoadStorePointerOperand(&I) == Ptr) {
+              Type* AccessTy = isa<LoadInst>(I) ? I.getType()
+                                                : cast<StoreInst>(I).getValueOperand()->getType();
+              bool Simple = isa<LoadInst>(I) ? cast<LoadInst>(I).isSimple() : cast<StoreInst>(I).isSimple();
+              if(!Simple || (Ty && Ty != AccessTy)) {
+                Promotable = false;
+                break;
+              }
+              Ty = AccessTy;
+              Uses.push_back(&I);
+              StoreInst* Store = dyn_cast<StoreInst>(&I);
+              if(Store && !Guaranteed && SafetyInfo.isGuaranteedToExecute(I, &DT, &L)) {
+                Guaranteed = Store;
+              }
+            }
+          }
+          if(!Promotable) break;
+        }
+        if(!Promotable || !Guaranteed) continue;
 
-      codeMotion(L, loopInv, DT);
+        // Nessun altro accesso del loop può leggere o scrivere la locazione
+        MemoryLocation Loc = MemoryLocation::get(Guaranteed);
+        for(BasicBlock* BB : L.blocks()) {
+          for(auto &I : *BB) {
+            if(!I.mayReadOrWriteMemory() || getLoadStorePointerOperand(&I) == Ptr) continue;
+            if(isModOrRefSet(AA.getModRefInfo(&I, Loc))) {
+              Promotable = false;
+              break;
+            }
+          }
+          if(!Promotable) break;
+        }
+        if(!Promotable) continue;
+
+        outs() << "Promuovo in un registro la locazione ";
+        Ptr->printAsOperand(outs(), false);
+        outs() << "\n";
+        Align Alignment = Guaranteed->getAlign();
+        IRBuilder<> Builder(PH->getTerminator());
+        LoadInst* Initial = Builder.CreateAlignedLoad(Ty, Ptr, Alignment, Ptr->getName() + ".promoted");
+
+        SmallVector<PHINode*, 16> NewPHIs;
+        SSAUpdater SSA(&NewPHIs);
+        SmallVector<const Instruction*, 8> ConstUses(Uses.begin(), Uses.end());
+        LoopPromoter Promoter(Ptr, Ty, Alignment, ConstUses, SSA, ExitBlocks);
+        SSA.AddAvailableValue(PH, Initial);
+        Promoter.run(Uses);
+        Changed = true;
+      }
+      if(Changed) formLCSSARecursively(L, DT, &LI, &SE);
+      return Changed;
+    }
+
+    // In forma LCSSA gli usi fuori dal loop passano per le phi delle uscite.
+    // Se un'istruzione senza effetti collaterali è usata solo da phi LCSSA
+    // che ricevono lei su tutti gli archi, il suo valore serve solo dopo il
+    // loop: la ricalcoliamo in ogni uscita che la usa e togliamo l'originale.
+    // Nell'uscita gli operandi definiti nel loop arrivano tramite nuove phi
+    // LCSSA, che hanno il valore dell'ultima iterazione: dato che l'operando
+    // domina l'istruzione e l'istruzione domina i blocchi da cui si esce,
+    // tra l'ultima esecuzione dell'operando e l'uscita c'è sempre anche
+    // l'esecuzione dell'istruzione, quindi il risultato è lo stesso
+    bool isSinkable(Instruction &I, Loop &L) {
+      if(I.use_empty() || !isInvariantKind(I)) return false;
+      for(User* U : I.users()) {
+        PHINode* PN = dyn_cast<PHINode>(U);
+        if(!PN || L.contains(PN)) return false;
+        for(Value* Incoming : PN->incoming_values()) {
+          if(Incoming != &I) return false;
+        }
+      }
+      return true;
+    }
+
+    // Phi LCSSA nell'uscita per un valore definito nel loop (riusa quella
+    // esistente se c'è)
+    PHINode* getLCSSAPhi(Instruction* Def, BasicBlock* Exit) {
+      for(PHINode &PN : Exit->phis()) {
+        if(all_of(PN.incoming_values(), [&](Value* V) { return V == Def; })) return &PN;
+      }
+      IRBuilder<> Builder(&Exit->front());
+      PHINode* PN = Builder.CreatePHI(Def->getType(), pred_size(Exit), Def->getName() + ".lcssa");
+      for(BasicBlock* Pred : predecessors(Exit)) PN->addIncoming(Def, Pred);
+      return PN;
+    }
+
+    bool sinkToExits(Loop &L, LoopInfo &LI, ScalarEvolution &SE) {
+      if(!L.hasDedicatedExits()) return false;
+
+      // Visitiamo il loop in post-order e ogni blocco al contrario: gli usi
+      // vengono spostati prima delle definizioni, così una catena di istruzioni
+      // usate solo dopo il loop esce tutta insieme
+      LoopBlocksRPO RPO(&L);
+      RPO.perform(&LI);
+      std::vector<Instruction*> Worklist;
+      for(BasicBlock* BB : RPO) {
+        // Le istruzioni dei sotto-loop sono già state gestite quando è toccato a loro
+        if(LI.getLoopFor(BB) != &L) continue;
+        for(auto &I : *BB) Worklist.push_back(&I);
+      }
+
+      bool Changed = false;
+      for(auto It = Worklist.rbegin(); It != Worklist.rend(); ++It) {
+        Instruction* I = *It;
+        if(!isSinkable(*I, L)) continue;
+
+        SmallVector<PHINode*, 4> Users;
+        for(User* U : I->users()) Users.push_back(cast<PHINode>(U));
+        for(PHINode* PN : Users) {
+          BasicBlock* Exit = PN->getParent();
+          Instruction* Clone = I->clone();
+          Clone->setName(I->getName());
+          Clone->insertBefore(&*Exit->getFirstInsertionPt());
+          for(Use &Op : Clone->operands()) {
+            Instruction* OpInst = dyn_cast<Instruction>(Op.get());
+            if(OpInst && L.contains(OpInst)) Op.set(getLCSSAPhi(OpInst, Exit));
+          }
+          PN->replaceAllUsesWith(Clone);
+          PN->eraseFromParent();
+        }
+        outs() << "Sunk instruction: " << *I << "\n";
+        SE.forgetValue(I);
+        I->eraseFromParent();
+        Changed = true;
+      }
+      return Changed;
+    }
+
+    bool runOnLoop(Loop &L, LoopInfo &LI, DominatorTree &DT, ScalarEvolution &SE, AAResults* AA) {
+
+      std::vector<llvm::Instruction*> loopInv = getLoopInvInstr(L, LI, AA);
+
+      bool Changed = codeMotion(L, loopInv, LI, DT, SE);
+      if(AA) Changed |= promoteMemory(L, LI, DT, SE, *AA);
+      Changed |= sinkToExits(L, LI, SE);
 
       // Print the loop invariant instructions
       errs() << "Loop invariant instructions in loop: \n";
       for(auto &I : loopInv) {
         errs() << *I << "\n";
       }
+      return Changed;
     }
 
-    // Main entry point, takes IR unit to run the pass on (&F) and the
-    // corresponding pass manager (to be queried if need be)
-    PreservedAnalyses run(Function &F, FunctionAnalysisManager &AM)
-    {
-      LoopInfo &LI = AM.getResult<LoopAnalysis>(F);
-      DominatorTree &DT = AM.getResult<DominatorTreeAnalysis>(F);
+    unsigned loopSize(Loop &L) {
+      unsigned Size = 0;
+      for(BasicBlock* BB : L.blocks()) Size += BB->size();
+      return Size;
+    }
 
-      for(auto *L : LI) {
-        runOnLoop(*L, DT);
+    // Un branch condizionale o uno switch del loop su un valore invariante.
+    // codeMotion ha già spostato nel preheader i confronti invarianti, quindi
+    // basta che la condizione sia definita fuori dal loop. Consideriamo solo i
+    // blocchi del loop stesso: i sotto-loop hanno già avuto il loro turno
+    Instruction* findUnswitchCandidate(Loop &L, LoopInfo &LI) {
+      for(BasicBlock* BB : L.blocks()) {
+        if(LI.getLoopFor(BB) != &L) continue;
+        Instruction* Term = BB->getTerminator();
+        if(BranchInst* BI = dyn_cast<BranchInst>(Term)) {
+          if(BI->isConditional() && BI->getSuccessor(0) != BI->getSuccessor(1) &&
+             !isa<Constant>(BI->getCondition()) && L.isLoopInvariant(BI->getCondition())) {
+            return BI;
+          }
+        }
+        if(SwitchInst* SI = dyn_cast<SwitchInst>(Term)) {
+          if(SI->getNumCases() > 0 && !isa<Constant>(SI->getCondition()) &&
+             L.isLoopInvariant(SI->getCondition())) {
+            return SI;
+          }
+        }
       }
+      return nullptr;
+    }
+
+    // Unswitching: il loop viene duplicato e un test nel preheader sceglie la
+    // versione. Nella copia la condizione è vera (per uno switch: vale il
+    // primo case, unswitching parziale), nell'originale è falsa (per uno
+    // switch l'originale resta com'è e gestisce gli altri case). La condizione
+    // viene sostituita da una costante e il branch diventa un salto fisso:
+    // i blocchi che non vengono più eseguiti li elimina simplifycfg.
+    // Ogni unswitching raddoppia il codice del loop, quindi il budget conta
+    // tutte le versioni già create
+    bool unswitchLoop(Loop &L, LoopStandardAnalysisResults &AR, LPMUpdater &U) {
+      Instruction* Term = findUnswitchCandidate(L, AR.LI);
+      if(!Term || !L.isSafeToClone() || !L.hasDedicatedExits()) return false;
+
+      int Done = getIntLoopAttribute(&L, UnswitchCountMD, 0);
+      uint64_t Size = (uint64_t)loopSize(L) << (Done + 1);
+      if(Size > UnswitchThreshold) {
+        outs() << "Unswitching oltre il budget: " << Size << " istruzioni\n";
+        return false;
+      }
+
+      BranchInst* BI = dyn_cast<BranchInst>(Term);
+      SwitchInst* SI = dyn_cast<SwitchInst>(Term);
+      Value* Cond = BI ? BI->getCondition() : SI->getCondition();
+      Constant* CloneValue = BI ? ConstantInt::getTrue(Cond->getContext())
+                                : cast<Constant>(SI->case_begin()->getCaseValue());
+      outs() << "Unswitching su: " << *Term << "\n";
+
+      // Il conteggio va nei metadati prima della copia, così lo ereditano entrambe
+      addStringMetadataToLoop(&L, UnswitchCountMD, Done + 1);
+
+      SmallVector<BasicBlock*, 4> ExitBlocks;
+      L.getUniqueExitBlocks(ExitBlocks);
+
+      // Il preheader diventa il blocco del test, seguito da un nuovo preheader
+      BasicBlock* CheckBB = L.getLoopPreheader();
+      BasicBlock* NewPH = SplitBlock(CheckBB, CheckBB->getTerminator(), &AR.DT, &AR.LI);
+
+      ValueToValueMapTy VMap;
+      SmallVector<BasicBlock*, 16> ClonedBlocks;
+      Loop* Clone = cloneLoopWithPreheader(NewPH, CheckBB, &L, VMap, ".us", &AR.LI, &AR.DT, ClonedBlocks);
+      remapInstructionsInBlocks(ClonedBlocks, VMap);
+
+      // Test nel preheader. Nel loop originale la condizione era valutata solo
+      // se si arrivava al branch: se può essere poison la congeliamo
+      IRBuilder<> Builder(CheckBB->getTerminator());
+      Value* Test = Cond;
+      if(!isGuaranteedNotToBeUndefOrPoison(Cond, nullptr, CheckBB->getTerminator(), &AR.DT)) {
+        Test = Builder.CreateFreeze(Cond, Cond->getName() + ".fr");
+      }
+      if(SI) Test = Builder.CreateICmpEQ(Test, CloneValue);
+      Builder.CreateCondBr(Test, cast<BasicBlock>(VMap[NewPH]), NewPH);
+      CheckBB->getTerminator()->eraseFromParent();
+
+      // cloneLoopWithPreheader mette i blocchi della copia nel DominatorTree,
+      // ma non conosce gli archi nuovi: il test verso la copia e le uscite
+      // della copia, che cambiano il dominatore dei blocchi di uscita
+      SmallVector<DominatorTree::UpdateType, 8> Updates;
+      Updates.push_back({DominatorTree::Insert, CheckBB, cast<BasicBlock>(VMap[NewPH])});
+      for(BasicBlock* Exit : ExitBlocks) {
+        for(BasicBlock* Pred : predecessors(Exit)) {
+          if(Clone->contains(Pred)) Updates.push_back({DominatorTree::Insert, Pred, Exit});
+        }
+      }
+      DomTreeUpdater DTU(AR.DT, DomTreeUpdater::UpdateStrategy::Eager);
+      DTU.applyUpdates(Updates);
+
+      // Le uscite ricevono archi anche dalla copia: completiamo le phi LCSSA
+      for(BasicBlock* Exit : ExitBlocks) {
+        for(PHINode &PN : Exit->phis()) {
+          unsigned NumIncoming = PN.getNumIncomingValues();
+          for(unsigned i = 0; i < NumIncoming; i++) {
+            Value* V = PN.getIncomingValue(i);
+            Value* Mapped = VMap.lookup(V);
+            PN.addIncoming(Mapped ? Mapped : V, cast<BasicBlock>(VMap[PN.getIncomingBlock(i)]));
+          }
+        }
+      }
+
+      // Ogni versione deve avere uscite dedicate: separiamo gli archi che
+      // arrivano dai due loop, il blocco di uscita originale li riunisce
+      for(BasicBlock* Exit : ExitBlocks) {
+        SmallVector<BasicBlock*, 4> OrigPreds, ClonePreds;
+        for(BasicBlock* Pred : predecessors(Exit)) {
+          if(L.contains(Pred)) OrigPreds.push_back(Pred);
+          else ClonePreds.push_back(Pred);
+        }
+        SplitBlockPredecessors(Exit, OrigPreds, ".split", &AR.DT, &AR.LI, nullptr, true);
+        SplitBlockPredecessors(Exit, ClonePreds, ".us", &AR.DT, &AR.LI, nullptr, true);
+      }
+
+      // La condizione ora è nota in ciascuna versione
+      Cond->replaceUsesWithIf(CloneValue, [&](Use &Use) {
+        Instruction* User = dyn_cast<Instruction>(Use.getUser());
+        return User && Clone->contains(User);
+      });
+      if(BI) {
+        Cond->replaceUsesWithIf(ConstantInt::getFalse(Cond->getContext()), [&](Use &Use) {
+          Instruction* User = dyn_cast<Instruction>(Use.getUser());
+          return User && L.contains(User);
+        });
+      }
+
+      AR.SE.forgetLoop(&L);
+      U.addSiblingLoops({Clone});
+      return true;
+    }
+
+    // Main entry point: il LoopPassManager ci chiama su ogni loop del nido
+    // partendo dal più interno, quindi un'istruzione spostata nel preheader
+    // del loop interno (che sta nel corpo del loop esterno) viene riconsiderata
+    // quando tocca al loop esterno e può risalire di un altro livello.
+    // DominatorTree e LoopInfo arrivano già calcolati in AR.
+    PreservedAnalyses run(Loop &L, LoopAnalysisManager &,
+                          LoopStandardAnalysisResults &AR, LPMUpdater &U)
+    {
+      // Il loop pass adaptor esegue loop-simplify prima di noi, ma un loop
+      // senza preheader non ha dove ricevere le istruzioni spostate
+      if(!L.getLoopPreheader()) return PreservedAnalyses::all();
 
-      return PreservedAnalyses::all();
+      // Spostare o eliminare load e store richiederebbe di aggiornare MemorySSA:
+      // se la pipeline la usa (loop-mssa) ci limitiamo alle istruzioni senza
+      // accessi in memoria
+      AAResults* AA = AR.MSSA ? nullptr : &AR.AA;
+      bool Changed = runOnLoop(L, AR.LI, AR.DT, AR.SE, AA);
+      // Anche duplicare il loop richiederebbe di aggiornare MemorySSA
+      if(!AR.MSSA) Changed |= unswitchLoop(L, AR, U);
+      if(!Changed) return PreservedAnalyses::all();
+      // Le trasformazioni aggiornano DominatorTree, LoopInfo e ScalarEvolution.
+      // Con MemorySSA spostiamo solo istruzioni senza accessi in memoria, che
+      // non compaiono in MemorySSA
+      PreservedAnalyses PA = getLoopPassPreservedAnalyses();
+      if(AR.MSSA) PA.preserve<MemorySSAAnalysis>();
+      return PA;
     }
     
     // Without isRequired returning true, this pass will be skipped for functions
@@ -182,18 +644,20 @@ namespace
 //-----------------------------------------------------------------------------
 // New PM Registration
 //-----------------------------------------------------------------------------
-llvm::PassPluginLibraryInfo getTestPassPluginInfo()
+// static: con più plugin caricati nello stesso opt, un simbolo globale con
+// lo stesso nome verrebbe risolto nel primo plugin caricato
+static llvm::PassPluginLibraryInfo getTestPassPluginInfo()
 {
   return {LLVM_PLUGIN_API_VERSION, "LoopInvariant", LLVM_VERSION_STRING,
           [](PassBuilder &PB)
           {
             PB.registerPipelineParsingCallback(
-                [](StringRef Name, FunctionPassManager &FPM,
+                [](StringRef Name, LoopPassManager &LPM,
                    ArrayRef<PassBuilder::PipelineElement>)
                 {
                   if (Name == "loop-invariant")
                   {
-                    FPM.addPass(LoopInvariant());
+                    LPM.addPass(LoopInvariant());
                     return true;
                   }
                   return false;
@@ -0,0 +1,32 @@
+// Stress test per l'analisi di invarianza: ogni passo di S usa due volte
+// il valore precedente, quindi il corpo del loop contiene un DAG profondo
+// 48 livelli. Rivisitare ricorsivamente gli operandi costerebbe 2^48 visite,
+// la passata in reverse post-order visita ogni istruzione una volta sola.
+// In fondo al DAG compaiono anche cast, GEP, confronti e select invarianti.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm DeepDag.c -o DeepDag.ll
+//	opt -passes=mem2reg -S DeepDag.ll -o DeepDag.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so -passes=loop-invariant \
+//	    -S DeepDag.m2r.ll -o DeepDagOpt.m2r.ll
+
+#define S(t)  t = t * a + t;
+#define S8(t) S(t) S(t) S(t) S(t) S(t) S(t) S(t) S(t)
+
+int tab[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+int deep(int *v, int a, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    int t = a;
+    S8(t) S8(t) S8(t) S8(t) S8(t) S8(t)
+    long idx = t & 15;          // cast invariante
+    int *p = &v[idx];           // GEP invariante
+    int m = t > a ? t : a;      // confronto e select invarianti
+    sum += *p + m + i;
+  }
+  return sum;
+}
+
+int main() {
+  return deep(tab, 3, 100) & 0xff;
+}
@@ -0,0 +1,151 @@
+; ModuleID = 'DeepDag.ll'
+source_filename = "DeepDag.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@tab = dso_local global [16 x i32] [i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8, i32 9, i32 10, i32 11, i32 12, i32 13, i32 14, i32 15, i32 16], align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @deep(ptr noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  br label %4
+
+4:                                                ; preds = %112, %3
+  %.01 = phi i32 [ 0, %3 ], [ %111, %112 ]
+  %.0 = phi i32 [ 0, %3 ], [ %113, %112 ]
+  %5 = icmp slt i32 %.0, %2
+  br i1 %5, label %6, label %114
+
+6:                                                ; preds = %4
+  %7 = mul nsw i32 %1, %1
+  %8 = add nsw i32 %7, %1
+  %9 = mul nsw i32 %8, %1
+  %10 = add nsw i32 %9, %8
+  %11 = mul nsw i32 %10, %1
+  %12 = add nsw i32 %11, %10
+  %13 = mul nsw i32 %12, %1
+  %14 = add nsw i32 %13, %12
+  %15 = mul nsw i32 %14, %1
+  %16 = add nsw i32 %15, %14
+  %17 = mul nsw i32 %16, %1
+  %18 = add nsw i32 %17, %16
+  %19 = mul nsw i32 %18, %1
+  %20 = add nsw i32 %19, %18
+  %21 = mul nsw i32 %20, %1
+  %22 = add nsw i32 %21, %20
+  %23 = mul nsw i32 %22, %1
+  %24 = add nsw i32 %23, %22
+  %25 = mul nsw i32 %24, %1
+  %26 = add nsw i32 %25, %24
+  %27 = mul nsw i32 %26, %1
+  %28 = add nsw i32 %27, %26
+  %29 = mul nsw i32 %28, %1
+  %30 = add nsw i32 %29, %28
+  %31 = mul nsw i32 %30, %1
+  %32 = add nsw i32 %31, %30
+  %33 = mul nsw i32 %32, %1
+  %34 = add nsw i32 %33, %32
+  %35 = mul nsw i32 %34, %1
+  %36 = add nsw i32 %35, %34
+  %37 = mul nsw i32 %36, %1
+  %38 = add nsw i32 %37, %36
+  %39 = mul nsw i32 %38, %1
+  %40 = add nsw i32 %39, %38
+  %41 = mul nsw i32 %40, %1
+  %42 = add nsw i32 %41, %40
+  %43 = mul nsw i32 %42, %1
+  %44 = add nsw i32 %43, %42
+  %45 = mul nsw i32 %44, %1
+  %46 = add nsw i32 %45, %44
+  %47 = mul nsw i32 %46, %1
+  %48 = add nsw i32 %47, %46
+  %49 = mul nsw i32 %48, %1
+  %50 = add nsw i32 %49, %48
+  %51 = mul nsw i32 %50, %1
+  %52 = add nsw i32 %51, %50
+  %53 = mul nsw i32 %52, %1
+  %54 = add nsw i32 %53, %52
+  %55 = mul nsw i32 %54, %1
+  %56 = add nsw i32 %55, %54
+  %57 = mul nsw i32 %56, %1
+  %58 = add nsw i32 %57, %56
+  %59 = mul nsw i32 %58, %1
+  %60 = add nsw i32 %59, %58
+  %61 = mul nsw i32 %60, %1
+  %62 = add nsw i32 %61, %60
+  %63 = mul nsw i32 %62, %1
+  %64 = add nsw i32 %63, %62
+  %65 = mul nsw i32 %64, %1
+  %66 = add nsw i32 %65, %64
+  %67 = mul nsw i32 %66, %1
+  %68 = add nsw i32 %67, %66
+  %69 = mul nsw i32 %68, %1
+  %70 = add nsw i32 %69, %68
+  %71 = mul nsw i32 %70, %1
+  %72 = add nsw i32 %71, %70
+  %73 = mul nsw i32 %72, %1
+  %74 = add nsw i32 %73, %72
+  %75 = mul nsw i32 %74, %1
+  %76 = add nsw i32 %75, %74
+  %77 = mul nsw i32 %76, %1
+  %78 = add nsw i32 %77, %76
+  %79 = mul nsw i32 %78, %1
+  %80 = add nsw i32 %79, %78
+  %81 = mul nsw i32 %80, %1
+  %82 = add nsw i32 %81, %80
+  %83 = mul nsw i32 %82, %1
+  %84 = add nsw i32 %83, %82
+  %85 = mul nsw i32 %84, %1
+  %86 = add nsw i32 %85, %84
+  %87 = mul nsw i32 %86, %1
+  %88 = add nsw i32 %87, %86
+  %89 = mul nsw i32 %88, %1
+  %90 = add nsw i32 %89, %88
+  %91 = mul nsw i32 %90, %1
+  %92 = add nsw i32 %91, %90
+  %93 = mul nsw i32 %92, %1
+  %94 = add nsw i32 %93, %92
+  %95 = mul nsw i32 %94, %1
+  %96 = add nsw i32 %95, %94
+  %97 = mul nsw i32 %96, %1
+  %98 = add nsw i32 %97, %96
+  %99 = mul nsw i32 %98, %1
+  %100 = add nsw i32 %99, %98
+  %101 = mul nsw i32 %100, %1
+  %102 = add nsw i32 %101, %100
+  %103 = and i32 %102, 15
+  %104 = sext i32 %103 to i64
+  %105 = getelementptr inbounds i32, ptr %0, i64 %104
+  %106 = icmp sgt i32 %102, %1
+  %107 = select i1 %106, i32 %102, i32 %1
+  %108 = load i32, ptr %105, align 4
+  %109 = add nsw i32 %108, %107
+  %110 = add nsw i32 %109, %.0
+  %111 = add nsw i32 %.01, %110
+  br label %112
+
+112:                                              ; preds = %6
+  %113 = add nsw i32 %.0, 1
+  br label %4
+
+114:                                              ; preds = %4
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @deep(ptr noundef @tab, i32 noundef 3, i32 noundef 100)
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,152 @@
+; ModuleID = 'DeepDag.m2r.ll'
+source_filename = "DeepDag.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@tab = dso_local global [16 x i32] [i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8, i32 9, i32 10, i32 11, i32 12, i32 13, i32 14, i32 15, i32 16], align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @deep(ptr noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  %4 = mul nsw i32 %1, %1
+  %5 = add nsw i32 %4, %1
+  %6 = mul nsw i32 %5, %1
+  %7 = add nsw i32 %6, %5
+  %8 = mul nsw i32 %7, %1
+  %9 = add nsw i32 %8, %7
+  %10 = mul nsw i32 %9, %1
+  %11 = add nsw i32 %10, %9
+  %12 = mul nsw i32 %11, %1
+  %13 = add nsw i32 %12, %11
+  %14 = mul nsw i32 %13, %1
+  %15 = add nsw i32 %14, %13
+  %16 = mul nsw i32 %15, %1
+  %17 = add nsw i32 %16, %15
+  %18 = mul nsw i32 %17, %1
+  %19 = add nsw i32 %18, %17
+  %20 = mul nsw i32 %19, %1
+  %21 = add nsw i32 %20, %19
+  %22 = mul nsw i32 %21, %1
+  %23 = add nsw i32 %22, %21
+  %24 = mul nsw i32 %23, %1
+  %25 = add nsw i32 %24, %23
+  %26 = mul nsw i32 %25, %1
+  %27 = add nsw i32 %26, %25
+  %28 = mul nsw i32 %27, %1
+  %29 = add nsw i32 %28, %27
+  %30 = mul nsw i32 %29, %1
+  %31 = add nsw i32 %30, %29
+  %32 = mul nsw i32 %31, %1
+  %33 = add nsw i32 %32, %31
+  %34 = mul nsw i32 %33, %1
+  %35 = add nsw i32 %34, %33
+  %36 = mul nsw i32 %35, %1
+  %37 = add nsw i32 %36, %35
+  %38 = mul nsw i32 %37, %1
+  %39 = add nsw i32 %38, %37
+  %40 = mul nsw i32 %39, %1
+  %41 = add nsw i32 %40, %39
+  %42 = mul nsw i32 %41, %1
+  %43 = add nsw i32 %42, %41
+  %44 = mul nsw i32 %43, %1
+  %45 = add nsw i32 %44, %43
+  %46 = mul nsw i32 %45, %1
+  %47 = add nsw i32 %46, %45
+  %48 = mul nsw i32 %47, %1
+  %49 = add nsw i32 %48, %47
+  %50 = mul nsw i32 %49, %1
+  %51 = add nsw i32 %50, %49
+  %52 = mul nsw i32 %51, %1
+  %53 = add nsw i32 %52, %51
+  %54 = mul nsw i32 %53, %1
+  %55 = add nsw i32 %54, %53
+  %56 = mul nsw i32 %55, %1
+  %57 = add nsw i32 %56, %55
+  %58 = mul nsw i32 %57, %1
+  %59 = add nsw i32 %58, %57
+  %60 = mul nsw i32 %59, %1
+  %61 = add nsw i32 %60, %59
+  %62 = mul nsw i32 %61, %1
+  %63 = add nsw i32 %62, %61
+  %64 = mul nsw i32 %63, %1
+  %65 = add nsw i32 %64, %63
+  %66 = mul nsw i32 %65, %1
+  %67 = add nsw i32 %66, %65
+  %68 = mul nsw i32 %67, %1
+  %69 = add nsw i32 %68, %67
+  %70 = mul nsw i32 %69, %1
+  %71 = add nsw i32 %70, %69
+  %72 = mul nsw i32 %71, %1
+  %73 = add nsw i32 %72, %71
+  %74 = mul nsw i32 %73, %1
+  %75 = add nsw i32 %74, %73
+  %76 = mul nsw i32 %75, %1
+  %77 = add nsw i32 %76, %75
+  %78 = mul nsw i32 %77, %1
+  %79 = add nsw i32 %78, %77
+  %80 = mul nsw i32 %79, %1
+  %81 = add nsw i32 %80, %79
+  %82 = mul nsw i32 %81, %1
+  %83 = add nsw i32 %82, %81
+  %84 = mul nsw i32 %83, %1
+  %85 = add nsw i32 %84, %83
+  %86 = mul nsw i32 %85, %1
+  %87 = add nsw i32 %86, %85
+  %88 = mul nsw i32 %87, %1
+  %89 = add nsw i32 %88, %87
+  %90 = mul nsw i32 %89, %1
+  %91 = add nsw i32 %90, %89
+  %92 = mul nsw i32 %91, %1
+  %93 = add nsw i32 %92, %91
+  %94 = mul nsw i32 %93, %1
+  %95 = add nsw i32 %94, %93
+  %96 = mul nsw i32 %95, %1
+  %97 = add nsw i32 %96, %95
+  %98 = mul nsw i32 %97, %1
+  %99 = add nsw i32 %98, %97
+  %100 = and i32 %99, 15
+  %101 = sext i32 %100 to i64
+  %102 = getelementptr inbounds i32, ptr %0, i64 %101
+  %103 = icmp sgt i32 %99, %1
+  %104 = select i1 %103, i32 %99, i32 %1
+  br label %105
+
+105:                                              ; preds = %112, %3
+  %.01 = phi i32 [ 0, %3 ], [ %111, %112 ]
+  %.0 = phi i32 [ 0, %3 ], [ %113, %112 ]
+  %106 = icmp slt i32 %.0, %2
+  br i1 %106, label %107, label %114
+
+107:                                              ; preds = %105
+  %108 = load i32, ptr %102, align 4
+  %109 = add nsw i32 %108, %104
+  %110 = add nsw i32 %109, %.0
+  %111 = add nsw i32 %.01, %110
+  br label %112
+
+112:                                              ; preds = %107
+  %113 = add nsw i32 %.0, 1
+  br label %105
+
+114:                                              ; preds = %105
+  %.01.lcssa = phi i32 [ %.01, %105 ]
+  ret i32 %.01.lcssa
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @deep(ptr noundef @tab, i32 noundef 3, i32 noundef 100)
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,30 @@
+// Nido di 4 loop con invarianti a livelli diversi: LoopInvariant lavora
+// dal loop più interno verso l'esterno, quindi ogni istruzione risale
+// fino al preheader del loop più esterno rispetto al quale è invariante.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm NestedLoop.c -o NestedLoop.ll
+//	opt -passes=mem2reg -S NestedLoop.ll -o NestedLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so -passes=loop-invariant \
+//	    -S NestedLoop.m2r.ll -o NestedLoopOpt.m2r.ll
+
+int nested(int a, int b, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      for (int k = 0; k < n; k++) {
+        for (int l = 0; l < n; l++) {
+          int t1 = a * b;  // invariante in tutto il nido
+          int t2 = t1 + i; // invariante nei loop j, k, l
+          int t3 = t2 * j; // invariante nei loop k, l
+          int t4 = t3 + k; // invariante nel loop l
+          sum += t4 + l;
+        }
+      }
+    }
+  }
+  return sum;
+}
+
+int main() {
+  return nested(3, 4, 10) & 0xff;
+}
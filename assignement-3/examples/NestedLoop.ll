@@ -0,0 +1,145 @@
+; ModuleID = 'NestedLoop.c'
+source_filename = "NestedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @nested(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  %6 = alloca i32, align 4
+  %7 = alloca i32, align 4
+  %8 = alloca i32, align 4
+  %9 = alloca i32, align 4
+  %10 = alloca i32, align 4
+  %11 = alloca i32, align 4
+  %12 = alloca i32, align 4
+  %13 = alloca i32, align 4
+  %14 = alloca i32, align 4
+  %15 = alloca i32, align 4
+  store i32 %0, ptr %4, align 4
+  store i32 %1, ptr %5, align 4
+  store i32 %2, ptr %6, align 4
+  store i32 0, ptr %7, align 4
+  store i32 0, ptr %8, align 4
+  br label %16
+
+16:                                               ; preds = %65, %3
+  %17 = load i32, ptr %8, align 4
+  %18 = load i32, ptr %6, align 4
+  %19 = icmp slt i32 %17, %18
+  br i1 %19, label %20, label %68
+
+20:                                               ; preds = %16
+  store i32 0, ptr %9, align 4
+  br label %21
+
+21:                                               ; preds = %61, %20
+  %22 = load i32, ptr %9, align 4
+  %23 = load i32, ptr %6, align 4
+  %24 = icmp slt i32 %22, %23
+  br i1 %24, label %25, label %64
+
+25:                                               ; preds = %21
+  store i32 0, ptr %10, align 4
+  br label %26
+
+26:                                               ; preds = %57, %25
+  %27 = load i32, ptr %10, align 4
+  %28 = load i32, ptr %6, align 4
+  %29 = icmp slt i32 %27, %28
+  br i1 %29, label %30, label %60
+
+30:                                               ; preds = %26
+  store i32 0, ptr %11, align 4
+  br label %31
+
+31:                                               ; preds = %53, %30
+  %32 = load i32, ptr %11, align 4
+  %33 = load i32, ptr %6, align 4
+  %34 = icmp slt i32 %32, %33
+  br i1 %34, label %35, label %56
+
+35:                                               ; preds = %31
+  %36 = load i32, ptr %4, align 4
+  %37 = load i32, ptr %5, align 4
+  %38 = mul nsw i32 %36, %37
+  store i32 %38, ptr %12, align 4
+  %39 = load i32, ptr %12, align 4
+  %40 = load i32, ptr %8, align 4
+  %41 = add nsw i32 %39, %40
+  store i32 %41, ptr %13, align 4
+  %42 = load i32, ptr %13, align 4
+  %43 = load i32, ptr %9, align 4
+  %44 = mul nsw i32 %42, %43
+  store i32 %44, ptr %14, align 4
+  %45 = load i32, ptr %14, align 4
+  %46 = load i32, ptr %10, align 4
+  %47 = add nsw i32 %45, %46
+  store i32 %47, ptr %15, align 4
+  %48 = load i32, ptr %15, align 4
+  %49 = load i32, ptr %11, align 4
+  %50 = add nsw i32 %48, %49
+  %51 = load i32, ptr %7, align 4
+  %52 = add nsw i32 %51, %50
+  store i32 %52, ptr %7, align 4
+  br label %53
+
+53:                                               ; preds = %35
+  %54 = load i32, ptr %11, align 4
+  %55 = add nsw i32 %54, 1
+  store i32 %55, ptr %11, align 4
+  br label %31
+
+56:                                               ; preds = %31
+  br label %57
+
+57:                                               ; preds = %56
+  %58 = load i32, ptr %10, align 4
+  %59 = add nsw i32 %58, 1
+  store i32 %59, ptr %10, align 4
+  br label %26
+
+60:                                               ; preds = %26
+  br label %61
+
+61:                                               ; preds = %60
+  %62 = load i32, ptr %9, align 4
+  %63 = add nsw i32 %62, 1
+  store i32 %63, ptr %9, align 4
+  br label %21
+
+64:                                               ; preds = %21
+  br label %65
+
+65:                                               ; preds = %64
+  %66 = load i32, ptr %8, align 4
+  %67 = add nsw i32 %66, 1
+  store i32 %67, ptr %8, align 4
+  br label %16
+
+68:                                               ; preds = %16
+  %69 = load i32, ptr %7, align 4
+  ret i32 %69
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  %2 = call i32 @nested(i32 noundef 3, i32 noundef 4, i32 noundef 10)
+  %3 = and i32 %2, 255
+  ret i32 %3
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,98 @@
+; ModuleID = 'NestedLoop.ll'
+source_filename = "NestedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @nested(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  br label %4
+
+4:                                                ; preds = %31, %3
+  %.04 = phi i32 [ 0, %3 ], [ %32, %31 ]
+  %.03 = phi i32 [ 0, %3 ], [ %.1, %31 ]
+  %5 = icmp slt i32 %.04, %2
+  br i1 %5, label %6, label %33
+
+6:                                                ; preds = %4
+  br label %7
+
+7:                                                ; preds = %28, %6
+  %.1 = phi i32 [ %.03, %6 ], [ %.2, %28 ]
+  %.02 = phi i32 [ 0, %6 ], [ %29, %28 ]
+  %8 = icmp slt i32 %.02, %2
+  br i1 %8, label %9, label %30
+
+9:                                                ; preds = %7
+  br label %10
+
+10:                                               ; preds = %25, %9
+  %.2 = phi i32 [ %.1, %9 ], [ %.3, %25 ]
+  %.01 = phi i32 [ 0, %9 ], [ %26, %25 ]
+  %11 = icmp slt i32 %.01, %2
+  br i1 %11, label %12, label %27
+
+12:                                               ; preds = %10
+  br label %13
+
+13:                                               ; preds = %22, %12
+  %.3 = phi i32 [ %.2, %12 ], [ %21, %22 ]
+  %.0 = phi i32 [ 0, %12 ], [ %23, %22 ]
+  %14 = icmp slt i32 %.0, %2
+  br i1 %14, label %15, label %24
+
+15:                                               ; preds = %13
+  %16 = mul nsw i32 %0, %1
+  %17 = add nsw i32 %16, %.04
+  %18 = mul nsw i32 %17, %.02
+  %19 = add nsw i32 %18, %.01
+  %20 = add nsw i32 %19, %.0
+  %21 = add nsw i32 %.3, %20
+  br label %22
+
+22:                                               ; preds = %15
+  %23 = add nsw i32 %.0, 1
+  br label %13
+
+24:                                               ; preds = %13
+  br label %25
+
+25:                                               ; preds = %24
+  %26 = add nsw i32 %.01, 1
+  br label %10
+
+27:                                               ; preds = %10
+  br label %28
+
+28:                                               ; preds = %27
+  %29 = add nsw i32 %.02, 1
+  br label %7
+
+30:                                               ; preds = %7
+  br label %31
+
+31:                                               ; preds = %30
+  %32 = add nsw i32 %.04, 1
+  br label %4
+
+33:                                               ; preds = %4
+  ret i32 %.03
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @nested(i32 noundef 3, i32 noundef 4, i32 noundef 10)
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,102 @@
+; ModuleID = 'NestedLoop.m2r.ll'
+source_filename = "NestedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @nested(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  %4 = mul nsw i32 %0, %1
+  br label %5
+
+5:                                                ; preds = %31, %3
+  %.04 = phi i32 [ 0, %3 ], [ %32, %31 ]
+  %.03 = phi i32 [ 0, %3 ], [ %.1.lcssa, %31 ]
+  %6 = icmp slt i32 %.04, %2
+  br i1 %6, label %7, label %33
+
+7:                                                ; preds = %5
+  %8 = add nsw i32 %4, %.04
+  br label %9
+
+9:                                                ; preds = %28, %7
+  %.1 = phi i32 [ %.03, %7 ], [ %.2.lcssa, %28 ]
+  %.02 = phi i32 [ 0, %7 ], [ %29, %28 ]
+  %10 = icmp slt i32 %.02, %2
+  br i1 %10, label %11, label %30
+
+11:                                               ; preds = %9
+  %12 = mul nsw i32 %8, %.02
+  br label %13
+
+13:                                               ; preds = %25, %11
+  %.2 = phi i32 [ %.1, %11 ], [ %.3.lcssa, %25 ]
+  %.01 = phi i32 [ 0, %11 ], [ %26, %25 ]
+  %14 = icmp slt i32 %.01, %2
+  br i1 %14, label %15, label %27
+
+15:                                               ; preds = %13
+  %16 = add nsw i32 %12, %.01
+  br label %17
+
+17:                                               ; preds = %22, %15
+  %.3 = phi i32 [ %.2, %15 ], [ %21, %22 ]
+  %.0 = phi i32 [ 0, %15 ], [ %23, %22 ]
+  %18 = icmp slt i32 %.0, %2
+  br i1 %18, label %19, label %24
+
+19:                                               ; preds = %17
+  %20 = add nsw i32 %16, %.0
+  %21 = add nsw i32 %.3, %20
+  br label %22
+
+22:                                               ; preds = %19
+  %23 = add nsw i32 %.0, 1
+  br label %17
+
+24:                                               ; preds = %17
+  %.3.lcssa = phi i32 [ %.3, %17 ]
+  br label %25
+
+25:                                               ; preds = %24
+  %26 = add nsw i32 %.01, 1
+  br label %13
+
+27:                                               ; preds = %13
+  %.2.lcssa = phi i32 [ %.2, %13 ]
+  br label %28
+
+28:                                               ; preds = %27
+  %29 = add nsw i32 %.02, 1
+  br label %9
+
+30:                                               ; preds = %9
+  %.1.lcssa = phi i32 [ %.1, %9 ]
+  br label %31
+
+31:                                               ; preds = %30
+  %32 = add nsw i32 %.04, 1
+  br label %5
+
+33:                                               ; preds = %5
+  %.03.lcssa = phi i32 [ %.03, %5 ]
+  ret i32 %.03.lcssa
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @nested(i32 noundef 3, i32 noundef 4, i32 noundef 10)
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,38 @@
+// Accessi in memoria a indirizzi invarianti. In accumulate le load e store
+// di total e hist[k & 7] diventano un valore SSA: si carica nel preheader e
+// si salva all'uscita. In scale total viene solo letto, quindi la load esce
+// dal loop. La promozione richiede che le store siano eseguite a ogni
+// ingresso nel loop, quindi i loop vanno prima ruotati.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm PromoteLoop.c -o PromoteLoop.ll
+//	opt -passes=mem2reg -S PromoteLoop.ll -o PromoteLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so \
+//	    -passes="loop(loop-rotate,loop-invariant)" \
+//	    -S PromoteLoop.m2r.ll -o PromoteLoopOpt.m2r.ll
+
+int data[64];
+int total;
+int hist[8];
+
+void accumulate(int n, int k) {
+  for (int i = 0; i < n; i++) {
+    total += data[i];
+    hist[k & 7] += 1;
+  }
+}
+
+int scale(int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++) {
+    s += data[i] * total;
+  }
+  return s;
+}
+
+int main() {
+  for (int i = 0; i < 64; i++) {
+    data[i] = i;
+  }
+  accumulate(64, 3);
+  return (scale(64) + total + hist[3]) & 0xff;
+}
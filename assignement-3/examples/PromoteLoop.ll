@@ -0,0 +1,140 @@
+; ModuleID = 'PromoteLoop.c'
+source_filename = "PromoteLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [64 x i32] zeroinitializer, align 16
+@total = dso_local global i32 0, align 4
+@hist = dso_local global [8 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @accumulate(i32 noundef %0, i32 noundef %1) #0 {
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  store i32 %0, ptr %3, align 4
+  store i32 %1, ptr %4, align 4
+  store i32 0, ptr %5, align 4
+  br label %6
+
+6:                                                ; preds = %23, %2
+  %7 = load i32, ptr %5, align 4
+  %8 = load i32, ptr %3, align 4
+  %9 = icmp slt i32 %7, %8
+  br i1 %9, label %10, label %26
+
+10:                                               ; preds = %6
+  %11 = load i32, ptr %5, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = load i32, ptr @total, align 4
+  %16 = add nsw i32 %15, %14
+  store i32 %16, ptr @total, align 4
+  %17 = load i32, ptr %4, align 4
+  %18 = and i32 %17, 7
+  %19 = sext i32 %18 to i64
+  %20 = getelementptr inbounds [8 x i32], ptr @hist, i64 0, i64 %19
+  %21 = load i32, ptr %20, align 4
+  %22 = add nsw i32 %21, 1
+  store i32 %22, ptr %20, align 4
+  br label %23
+
+23:                                               ; preds = %10
+  %24 = load i32, ptr %5, align 4
+  %25 = add nsw i32 %24, 1
+  store i32 %25, ptr %5, align 4
+  br label %6
+
+26:                                               ; preds = %6
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @scale(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  store i32 0, ptr %4, align 4
+  br label %5
+
+5:                                                ; preds = %18, %1
+  %6 = load i32, ptr %4, align 4
+  %7 = load i32, ptr %2, align 4
+  %8 = icmp slt i32 %6, %7
+  br i1 %8, label %9, label %21
+
+9:                                                ; preds = %5
+  %10 = load i32, ptr %4, align 4
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = load i32, ptr @total, align 4
+  %15 = mul nsw i32 %13, %14
+  %16 = load i32, ptr %3, align 4
+  %17 = add nsw i32 %16, %15
+  store i32 %17, ptr %3, align 4
+  br label %18
+
+18:                                               ; preds = %9
+  %19 = load i32, ptr %4, align 4
+  %20 = add nsw i32 %19, 1
+  store i32 %20, ptr %4, align 4
+  br label %5
+
+21:                                               ; preds = %5
+  %22 = load i32, ptr %3, align 4
+  ret i32 %22
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %11, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 64
+  br i1 %5, label %6, label %14
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %2, align 4
+  %8 = load i32, ptr %2, align 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %9
+  store i32 %7, ptr %10, align 4
+  br label %11
+
+11:                                               ; preds = %6
+  %12 = load i32, ptr %2, align 4
+  %13 = add nsw i32 %12, 1
+  store i32 %13, ptr %2, align 4
+  br label %3
+
+14:                                               ; preds = %3
+  call void @accumulate(i32 noundef 64, i32 noundef 3)
+  %15 = call i32 @scale(i32 noundef 64)
+  %16 = load i32, ptr @total, align 4
+  %17 = add nsw i32 %15, %16
+  %18 = load i32, ptr getelementptr inbounds ([8 x i32], ptr @hist, i64 0, i64 3), align 4
+  %19 = add nsw i32 %17, %18
+  %20 = and i32 %19, 255
+  ret i32 %20
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,109 @@
+; ModuleID = 'PromoteLoop.ll'
+source_filename = "PromoteLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [64 x i32] zeroinitializer, align 16
+@total = dso_local global i32 0, align 4
+@hist = dso_local global [8 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @accumulate(i32 noundef %0, i32 noundef %1) #0 {
+  br label %3
+
+3:                                                ; preds = %16, %2
+  %.0 = phi i32 [ 0, %2 ], [ %17, %16 ]
+  %4 = icmp slt i32 %.0, %0
+  br i1 %4, label %5, label %18
+
+5:                                                ; preds = %3
+  %6 = sext i32 %.0 to i64
+  %7 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = load i32, ptr @total, align 4
+  %10 = add nsw i32 %9, %8
+  store i32 %10, ptr @total, align 4
+  %11 = and i32 %1, 7
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [8 x i32], ptr @hist, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = add nsw i32 %14, 1
+  store i32 %15, ptr %13, align 4
+  br label %16
+
+16:                                               ; preds = %5
+  %17 = add nsw i32 %.0, 1
+  br label %3
+
+18:                                               ; preds = %3
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @scale(i32 noundef %0) #0 {
+  br label %2
+
+2:                                                ; preds = %11, %1
+  %.01 = phi i32 [ 0, %1 ], [ %10, %11 ]
+  %.0 = phi i32 [ 0, %1 ], [ %12, %11 ]
+  %3 = icmp slt i32 %.0, %0
+  br i1 %3, label %4, label %13
+
+4:                                                ; preds = %2
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %5
+  %7 = load i32, ptr %6, align 4
+  %8 = load i32, ptr @total, align 4
+  %9 = mul nsw i32 %7, %8
+  %10 = add nsw i32 %.01, %9
+  br label %11
+
+11:                                               ; preds = %4
+  %12 = add nsw i32 %.0, 1
+  br label %2
+
+13:                                               ; preds = %2
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %6, %0
+  %.0 = phi i32 [ 0, %0 ], [ %7, %6 ]
+  %2 = icmp slt i32 %.0, 64
+  br i1 %2, label %3, label %8
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  br label %6
+
+6:                                                ; preds = %3
+  %7 = add nsw i32 %.0, 1
+  br label %1
+
+8:                                                ; preds = %1
+  call void @accumulate(i32 noundef 64, i32 noundef 3)
+  %9 = call i32 @scale(i32 noundef 64)
+  %10 = load i32, ptr @total, align 4
+  %11 = add nsw i32 %9, %10
+  %12 = load i32, ptr getelementptr inbounds ([8 x i32], ptr @hist, i64 0, i64 3), align 4
+  %13 = add nsw i32 %11, %12
+  %14 = and i32 %13, 255
+  ret i32 %14
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
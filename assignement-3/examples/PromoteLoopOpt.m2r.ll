@@ -0,0 +1,120 @@
+; ModuleID = 'PromoteLoop.m2r.ll'
+source_filename = "PromoteLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [64 x i32] zeroinitializer, align 16
+@total = dso_local global i32 0, align 4
+@hist = dso_local global [8 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @accumulate(i32 noundef %0, i32 noundef %1) #0 {
+  %3 = icmp slt i32 0, %0
+  br i1 %3, label %.lr.ph, label %18
+
+.lr.ph:                                           ; preds = %2
+  %4 = and i32 %1, 7
+  %5 = sext i32 %4 to i64
+  %6 = getelementptr inbounds [8 x i32], ptr @hist, i64 0, i64 %5
+  %total.promoted = load i32, ptr @total, align 4
+  %.promoted = load i32, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %.lr.ph, %15
+  %8 = phi i32 [ %.promoted, %.lr.ph ], [ %14, %15 ]
+  %9 = phi i32 [ %total.promoted, %.lr.ph ], [ %13, %15 ]
+  %.01 = phi i32 [ 0, %.lr.ph ], [ %16, %15 ]
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %9, %12
+  %14 = add nsw i32 %8, 1
+  br label %15
+
+15:                                               ; preds = %7
+  %16 = add nsw i32 %.01, 1
+  %17 = icmp slt i32 %16, %0
+  br i1 %17, label %7, label %._crit_edge
+
+._crit_edge:                                      ; preds = %15
+  %.lcssa = phi i32 [ %14, %15 ]
+  %total.lcssa = phi i32 [ %13, %15 ]
+  store i32 %.lcssa, ptr %6, align 4
+  store i32 %total.lcssa, ptr @total, align 4
+  br label %18
+
+18:                                               ; preds = %._crit_edge, %2
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @scale(i32 noundef %0) #0 {
+  %2 = icmp slt i32 0, %0
+  br i1 %2, label %.lr.ph, label %13
+
+.lr.ph:                                           ; preds = %1
+  %3 = load i32, ptr @total, align 4
+  br label %4
+
+4:                                                ; preds = %.lr.ph, %10
+  %.02 = phi i32 [ 0, %.lr.ph ], [ %11, %10 ]
+  %.011 = phi i32 [ 0, %.lr.ph ], [ %9, %10 ]
+  %5 = sext i32 %.02 to i64
+  %6 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %5
+  %7 = load i32, ptr %6, align 4
+  %8 = mul nsw i32 %7, %3
+  %9 = add nsw i32 %.011, %8
+  br label %10
+
+10:                                               ; preds = %4
+  %11 = add nsw i32 %.02, 1
+  %12 = icmp slt i32 %11, %0
+  br i1 %12, label %4, label %._crit_edge
+
+._crit_edge:                                      ; preds = %10
+  %split = phi i32 [ %9, %10 ]
+  br label %13
+
+13:                                               ; preds = %._crit_edge, %1
+  %.01.lcssa = phi i32 [ %split, %._crit_edge ], [ 0, %1 ]
+  ret i32 %.01.lcssa
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %0, %4
+  %.01 = phi i32 [ 0, %0 ], [ %5, %4 ]
+  %2 = sext i32 %.01 to i64
+  %3 = getelementptr inbounds [64 x i32], ptr @data, i64 0, i64 %2
+  store i32 %.01, ptr %3, align 4
+  br label %4
+
+4:                                                ; preds = %1
+  %5 = add nsw i32 %.01, 1
+  %6 = icmp slt i32 %5, 64
+  br i1 %6, label %1, label %7
+
+7:                                                ; preds = %4
+  call void @accumulate(i32 noundef 64, i32 noundef 3)
+  %8 = call i32 @scale(i32 noundef 64)
+  %9 = load i32, ptr @total, align 4
+  %10 = add nsw i32 %8, %9
+  %11 = load i32, ptr getelementptr inbounds ([8 x i32], ptr @hist, i64 0, i64 3), align 4
+  %12 = add nsw i32 %10, %11
+  %13 = and i32 %12, 255
+  ret i32 %13
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,29 @@
+// Valori calcolati a ogni iterazione ma usati solo dopo il loop: in forma
+// LCSSA arrivano all'uscita tramite phi, quindi LoopInvariant li ricalcola
+// nel blocco di uscita a partire dagli ultimi valori degli operandi e li
+// toglie dal corpo del loop.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm SinkLoop.c -o SinkLoop.ll
+//	opt -passes=mem2reg -S SinkLoop.ll -o SinkLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so -passes=loop-invariant \
+//	    -S SinkLoop.m2r.ll -o SinkLoopOpt.m2r.ll
+
+int data[32];
+
+int last(int n, int a) {
+  int i = 0, sum = 0, t, u;
+  do {
+    t = i * a + 3;          // usata solo dopo il loop
+    u = (t << 2) ^ data[i]; // dipende da t, anche lei solo dopo il loop
+    sum += data[i];
+    i++;
+  } while (i < n);
+  return sum + t + u;
+}
+
+int main() {
+  for (int i = 0; i < 32; i++) {
+    data[i] = i * 7;
+  }
+  return last(32, 5) & 0xff;
+}
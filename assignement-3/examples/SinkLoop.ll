@@ -0,0 +1,107 @@
+; ModuleID = 'SinkLoop.c'
+source_filename = "SinkLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [32 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @last(i32 noundef %0, i32 noundef %1) #0 {
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  %6 = alloca i32, align 4
+  %7 = alloca i32, align 4
+  %8 = alloca i32, align 4
+  store i32 %0, ptr %3, align 4
+  store i32 %1, ptr %4, align 4
+  store i32 0, ptr %5, align 4
+  store i32 0, ptr %6, align 4
+  br label %9
+
+9:                                                ; preds = %29, %2
+  %10 = load i32, ptr %5, align 4
+  %11 = load i32, ptr %4, align 4
+  %12 = mul nsw i32 %10, %11
+  %13 = add nsw i32 %12, 3
+  store i32 %13, ptr %7, align 4
+  %14 = load i32, ptr %7, align 4
+  %15 = shl i32 %14, 2
+  %16 = load i32, ptr %5, align 4
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = xor i32 %15, %19
+  store i32 %20, ptr %8, align 4
+  %21 = load i32, ptr %5, align 4
+  %22 = sext i32 %21 to i64
+  %23 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %22
+  %24 = load i32, ptr %23, align 4
+  %25 = load i32, ptr %6, align 4
+  %26 = add nsw i32 %25, %24
+  store i32 %26, ptr %6, align 4
+  %27 = load i32, ptr %5, align 4
+  %28 = add nsw i32 %27, 1
+  store i32 %28, ptr %5, align 4
+  br label %29
+
+29:                                               ; preds = %9
+  %30 = load i32, ptr %5, align 4
+  %31 = load i32, ptr %3, align 4
+  %32 = icmp slt i32 %30, %31
+  br i1 %32, label %9, label %33
+
+33:                                               ; preds = %29
+  %34 = load i32, ptr %6, align 4
+  %35 = load i32, ptr %7, align 4
+  %36 = add nsw i32 %34, %35
+  %37 = load i32, ptr %8, align 4
+  %38 = add nsw i32 %36, %37
+  ret i32 %38
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %12, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 32
+  br i1 %5, label %6, label %15
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %2, align 4
+  %8 = mul nsw i32 %7, 7
+  %9 = load i32, ptr %2, align 4
+  %10 = sext i32 %9 to i64
+  %11 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %10
+  store i32 %8, ptr %11, align 4
+  br label %12
+
+12:                                               ; preds = %6
+  %13 = load i32, ptr %2, align 4
+  %14 = add nsw i32 %13, 1
+  store i32 %14, ptr %2, align 4
+  br label %3
+
+15:                                               ; preds = %3
+  %16 = call i32 @last(i32 noundef 32, i32 noundef 5)
+  %17 = and i32 %16, 255
+  ret i32 %17
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,75 @@
+; ModuleID = 'SinkLoop.ll'
+source_filename = "SinkLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [32 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @last(i32 noundef %0, i32 noundef %1) #0 {
+  br label %3
+
+3:                                                ; preds = %16, %2
+  %.01 = phi i32 [ 0, %2 ], [ %15, %16 ]
+  %.0 = phi i32 [ 0, %2 ], [ %14, %16 ]
+  %4 = mul nsw i32 %.01, %1
+  %5 = add nsw i32 %4, 3
+  %6 = shl i32 %5, 2
+  %7 = sext i32 %.01 to i64
+  %8 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = xor i32 %6, %9
+  %11 = sext i32 %.01 to i64
+  %12 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %.0, %13
+  %15 = add nsw i32 %.01, 1
+  br label %16
+
+16:                                               ; preds = %3
+  %17 = icmp slt i32 %15, %0
+  br i1 %17, label %3, label %18
+
+18:                                               ; preds = %16
+  %19 = add nsw i32 %14, %5
+  %20 = add nsw i32 %19, %10
+  ret i32 %20
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %7, %0
+  %.0 = phi i32 [ 0, %0 ], [ %8, %7 ]
+  %2 = icmp slt i32 %.0, 32
+  br i1 %2, label %3, label %9
+
+3:                                                ; preds = %1
+  %4 = mul nsw i32 %.0, 7
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %5
+  store i32 %4, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %3
+  %8 = add nsw i32 %.0, 1
+  br label %1
+
+9:                                                ; preds = %1
+  %10 = call i32 @last(i32 noundef 32, i32 noundef 5)
+  %11 = and i32 %10, 255
+  ret i32 %11
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
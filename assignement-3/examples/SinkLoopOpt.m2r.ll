@@ -0,0 +1,78 @@
+; ModuleID = 'SinkLoop.m2r.ll'
+source_filename = "SinkLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@data = dso_local global [32 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @last(i32 noundef %0, i32 noundef %1) #0 {
+  br label %3
+
+3:                                                ; preds = %12, %2
+  %.01 = phi i32 [ 0, %2 ], [ %11, %12 ]
+  %.0 = phi i32 [ 0, %2 ], [ %10, %12 ]
+  %4 = sext i32 %.01 to i64
+  %5 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = sext i32 %.01 to i64
+  %8 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = add nsw i32 %.0, %9
+  %11 = add nsw i32 %.01, 1
+  br label %12
+
+12:                                               ; preds = %3
+  %13 = icmp slt i32 %11, %0
+  br i1 %13, label %3, label %14
+
+14:                                               ; preds = %12
+  %.01.lcssa = phi i32 [ %.01, %12 ]
+  %.lcssa4 = phi i32 [ %6, %12 ]
+  %.lcssa = phi i32 [ %10, %12 ]
+  %15 = mul nsw i32 %.01.lcssa, %1
+  %16 = add nsw i32 %15, 3
+  %17 = shl i32 %16, 2
+  %18 = xor i32 %17, %.lcssa4
+  %19 = add nsw i32 %.lcssa, %16
+  %20 = add nsw i32 %19, %18
+  ret i32 %20
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %7, %0
+  %.0 = phi i32 [ 0, %0 ], [ %8, %7 ]
+  %2 = icmp slt i32 %.0, 32
+  br i1 %2, label %3, label %9
+
+3:                                                ; preds = %1
+  %4 = mul nsw i32 %.0, 7
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [32 x i32], ptr @data, i64 0, i64 %5
+  store i32 %4, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %3
+  %8 = add nsw i32 %.0, 1
+  br label %1
+
+9:                                                ; preds = %1
+  %10 = call i32 @last(i32 noundef 32, i32 noundef 5)
+  %11 = and i32 %10, 255
+  ret i32 %11
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,29 @@
+// Corpo del loop eseguito sotto condizione: le istruzioni invarianti non
+// dominano l'uscita, quindi possono essere spostate solo se è sicuro
+// eseguirle anche quando la condizione è falsa.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm SpecLoop.c -o SpecLoop.ll
+//	opt -passes=mem2reg -S SpecLoop.ll -o SpecLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so -passes=loop-invariant \
+//	    -S SpecLoop.m2r.ll -o SpecLoopOpt.m2r.ll
+
+int v[8] = {-1, -2, -3, -4, -5, -6, -7, -8};
+
+int spec(int *v, int a, int b, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    if (v[i] > 0) {
+      int k = a * b + 7;         // non può sollevare eccezioni: spostata
+      int q = a / ((b & 7) | 1); // divisore in [1, 7]: spostata
+      int r = a / b;             // b può essere 0: resta nel loop
+      sum += k + q + r;
+    }
+  }
+  return sum;
+}
+
+int main() {
+  // Nessun elemento è positivo: spostare a / b nel preheader
+  // causerebbe una divisione per zero
+  return spec(v, 100, 0, 8);
+}
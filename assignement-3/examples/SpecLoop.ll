@@ -0,0 +1,100 @@
+; ModuleID = 'SpecLoop.c'
+source_filename = "SpecLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [8 x i32] [i32 -1, i32 -2, i32 -3, i32 -4, i32 -5, i32 -6, i32 -7, i32 -8], align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @spec(ptr noundef %0, i32 noundef %1, i32 noundef %2, i32 noundef %3) #0 {
+  %5 = alloca ptr, align 8
+  %6 = alloca i32, align 4
+  %7 = alloca i32, align 4
+  %8 = alloca i32, align 4
+  %9 = alloca i32, align 4
+  %10 = alloca i32, align 4
+  %11 = alloca i32, align 4
+  %12 = alloca i32, align 4
+  %13 = alloca i32, align 4
+  store ptr %0, ptr %5, align 8
+  store i32 %1, ptr %6, align 4
+  store i32 %2, ptr %7, align 4
+  store i32 %3, ptr %8, align 4
+  store i32 0, ptr %9, align 4
+  store i32 0, ptr %10, align 4
+  br label %14
+
+14:                                               ; preds = %46, %4
+  %15 = load i32, ptr %10, align 4
+  %16 = load i32, ptr %8, align 4
+  %17 = icmp slt i32 %15, %16
+  br i1 %17, label %18, label %49
+
+18:                                               ; preds = %14
+  %19 = load ptr, ptr %5, align 8
+  %20 = load i32, ptr %10, align 4
+  %21 = sext i32 %20 to i64
+  %22 = getelementptr inbounds i32, ptr %19, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = icmp sgt i32 %23, 0
+  br i1 %24, label %25, label %45
+
+25:                                               ; preds = %18
+  %26 = load i32, ptr %6, align 4
+  %27 = load i32, ptr %7, align 4
+  %28 = mul nsw i32 %26, %27
+  %29 = add nsw i32 %28, 7
+  store i32 %29, ptr %11, align 4
+  %30 = load i32, ptr %6, align 4
+  %31 = load i32, ptr %7, align 4
+  %32 = and i32 %31, 7
+  %33 = or i32 %32, 1
+  %34 = sdiv i32 %30, %33
+  store i32 %34, ptr %12, align 4
+  %35 = load i32, ptr %6, align 4
+  %36 = load i32, ptr %7, align 4
+  %37 = sdiv i32 %35, %36
+  store i32 %37, ptr %13, align 4
+  %38 = load i32, ptr %11, align 4
+  %39 = load i32, ptr %12, align 4
+  %40 = add nsw i32 %38, %39
+  %41 = load i32, ptr %13, align 4
+  %42 = add nsw i32 %40, %41
+  %43 = load i32, ptr %9, align 4
+  %44 = add nsw i32 %43, %42
+  store i32 %44, ptr %9, align 4
+  br label %45
+
+45:                                               ; preds = %25, %18
+  br label %46
+
+46:                                               ; preds = %45
+  %47 = load i32, ptr %10, align 4
+  %48 = add nsw i32 %47, 1
+  store i32 %48, ptr %10, align 4
+  br label %14
+
+49:                                               ; preds = %14
+  %50 = load i32, ptr %9, align 4
+  ret i32 %50
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  %2 = call i32 @spec(ptr noundef @v, i32 noundef 100, i32 noundef 0, i32 noundef 8)
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,65 @@
+; ModuleID = 'SpecLoop.ll'
+source_filename = "SpecLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [8 x i32] [i32 -1, i32 -2, i32 -3, i32 -4, i32 -5, i32 -6, i32 -7, i32 -8], align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @spec(ptr noundef %0, i32 noundef %1, i32 noundef %2, i32 noundef %3) #0 {
+  br label %5
+
+5:                                                ; preds = %23, %4
+  %.01 = phi i32 [ 0, %4 ], [ %.1, %23 ]
+  %.0 = phi i32 [ 0, %4 ], [ %24, %23 ]
+  %6 = icmp slt i32 %.0, %3
+  br i1 %6, label %7, label %25
+
+7:                                                ; preds = %5
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds i32, ptr %0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = icmp sgt i32 %10, 0
+  br i1 %11, label %12, label %22
+
+12:                                               ; preds = %7
+  %13 = mul nsw i32 %1, %2
+  %14 = add nsw i32 %13, 7
+  %15 = and i32 %2, 7
+  %16 = or i32 %15, 1
+  %17 = sdiv i32 %1, %16
+  %18 = sdiv i32 %1, %2
+  %19 = add nsw i32 %14, %17
+  %20 = add nsw i32 %19, %18
+  %21 = add nsw i32 %.01, %20
+  br label %22
+
+22:                                               ; preds = %12, %7
+  %.1 = phi i32 [ %21, %12 ], [ %.01, %7 ]
+  br label %23
+
+23:                                               ; preds = %22
+  %24 = add nsw i32 %.0, 1
+  br label %5
+
+25:                                               ; preds = %5
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @spec(ptr noundef @v, i32 noundef 100, i32 noundef 0, i32 noundef 8)
+  ret i32 %1
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
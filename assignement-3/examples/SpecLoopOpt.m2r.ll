@@ -0,0 +1,66 @@
+; ModuleID = 'SpecLoop.m2r.ll'
+source_filename = "SpecLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [8 x i32] [i32 -1, i32 -2, i32 -3, i32 -4, i32 -5, i32 -6, i32 -7, i32 -8], align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @spec(ptr noundef %0, i32 noundef %1, i32 noundef %2, i32 noundef %3) #0 {
+  %5 = mul nsw i32 %1, %2
+  %6 = add nsw i32 %5, 7
+  %7 = and i32 %2, 7
+  %8 = or i32 %7, 1
+  %9 = sdiv i32 %1, %8
+  %10 = add nsw i32 %6, %9
+  br label %11
+
+11:                                               ; preds = %23, %4
+  %.01 = phi i32 [ 0, %4 ], [ %.1, %23 ]
+  %.0 = phi i32 [ 0, %4 ], [ %24, %23 ]
+  %12 = icmp slt i32 %.0, %3
+  br i1 %12, label %13, label %25
+
+13:                                               ; preds = %11
+  %14 = sext i32 %.0 to i64
+  %15 = getelementptr inbounds i32, ptr %0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = icmp sgt i32 %16, 0
+  br i1 %17, label %18, label %22
+
+18:                                               ; preds = %13
+  %19 = sdiv i32 %1, %2
+  %20 = add nsw i32 %10, %19
+  %21 = add nsw i32 %.01, %20
+  br label %22
+
+22:                                               ; preds = %18, %13
+  %.1 = phi i32 [ %21, %18 ], [ %.01, %13 ]
+  br label %23
+
+23:                                               ; preds = %22
+  %24 = add nsw i32 %.0, 1
+  br label %11
+
+25:                                               ; preds = %11
+  %.01.lcssa = phi i32 [ %.01, %11 ]
+  ret i32 %.01.lcssa
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @spec(ptr noundef @v, i32 noundef 100, i32 noundef 0, i32 noundef 8)
+  ret i32 %1
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,41 @@
+// Condizioni invarianti dentro il loop: il flag e la modalità non cambiano
+// durante il loop, ma il branch e lo switch vengono rivalutati a ogni
+// iterazione. LoopInvariant duplica il loop (unswitching): prima sul flag,
+// poi, nella copia, sul primo case dello switch. simplifycfg elimina poi i
+// rami che in ciascuna versione non vengono più eseguiti.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm UnswitchLoop.c -o UnswitchLoop.ll
+//	opt -passes=mem2reg -S UnswitchLoop.ll -o UnswitchLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement3.so \
+//	    -passes='loop(loop-invariant),simplifycfg' \
+//	    -S UnswitchLoop.m2r.ll -o UnswitchLoopOpt.m2r.ll
+
+int v[1000];
+
+int kernel(int n, int flag, int mode) {
+  int s = 0;
+  for (int i = 0; i < n; i++) {
+    if (flag) // invariante: unswitching
+      s += v[i] * 3;
+    else
+      s -= v[i];
+    switch (mode) { // invariante: unswitching parziale del case 0
+    case 0:
+      s ^= i;
+      break;
+    case 1:
+      s += i;
+      break;
+    default:
+      s -= 1;
+    }
+  }
+  return s;
+}
+
+int main() {
+  for (int i = 0; i < 1000; i++) {
+    v[i] = i;
+  }
+  return kernel(1000, 1, 0) & 0xff;
+}
@@ -0,0 +1,138 @@
+; ModuleID = 'UnswitchLoop.c'
+source_filename = "UnswitchLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @kernel(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  %6 = alloca i32, align 4
+  %7 = alloca i32, align 4
+  %8 = alloca i32, align 4
+  store i32 %0, ptr %4, align 4
+  store i32 %1, ptr %5, align 4
+  store i32 %2, ptr %6, align 4
+  store i32 0, ptr %7, align 4
+  store i32 0, ptr %8, align 4
+  br label %9
+
+9:                                                ; preds = %45, %3
+  %10 = load i32, ptr %8, align 4
+  %11 = load i32, ptr %4, align 4
+  %12 = icmp slt i32 %10, %11
+  br i1 %12, label %13, label %48
+
+13:                                               ; preds = %9
+  %14 = load i32, ptr %5, align 4
+  %15 = icmp ne i32 %14, 0
+  br i1 %15, label %16, label %24
+
+16:                                               ; preds = %13
+  %17 = load i32, ptr %8, align 4
+  %18 = sext i32 %17 to i64
+  %19 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %18
+  %20 = load i32, ptr %19, align 4
+  %21 = mul nsw i32 %20, 3
+  %22 = load i32, ptr %7, align 4
+  %23 = add nsw i32 %22, %21
+  store i32 %23, ptr %7, align 4
+  br label %31
+
+24:                                               ; preds = %13
+  %25 = load i32, ptr %8, align 4
+  %26 = sext i32 %25 to i64
+  %27 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %26
+  %28 = load i32, ptr %27, align 4
+  %29 = load i32, ptr %7, align 4
+  %30 = sub nsw i32 %29, %28
+  store i32 %30, ptr %7, align 4
+  br label %31
+
+31:                                               ; preds = %24, %16
+  %32 = load i32, ptr %6, align 4
+  switch i32 %32, label %41 [
+    i32 0, label %33
+    i32 1, label %37
+  ]
+
+33:                                               ; preds = %31
+  %34 = load i32, ptr %8, align 4
+  %35 = load i32, ptr %7, align 4
+  %36 = xor i32 %35, %34
+  store i32 %36, ptr %7, align 4
+  br label %44
+
+37:                                               ; preds = %31
+  %38 = load i32, ptr %8, align 4
+  %39 = load i32, ptr %7, align 4
+  %40 = add nsw i32 %39, %38
+  store i32 %40, ptr %7, align 4
+  br label %44
+
+41:                                               ; preds = %31
+  %42 = load i32, ptr %7, align 4
+  %43 = sub nsw i32 %42, 1
+  store i32 %43, ptr %7, align 4
+  br label %44
+
+44:                                               ; preds = %41, %37, %33
+  br label %45
+
+45:                                               ; preds = %44
+  %46 = load i32, ptr %8, align 4
+  %47 = add nsw i32 %46, 1
+  store i32 %47, ptr %8, align 4
+  br label %9
+
+48:                                               ; preds = %9
+  %49 = load i32, ptr %7, align 4
+  ret i32 %49
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %11, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %14
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %2, align 4
+  %8 = load i32, ptr %2, align 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %9
+  store i32 %7, ptr %10, align 4
+  br label %11
+
+11:                                               ; preds = %6
+  %12 = load i32, ptr %2, align 4
+  %13 = add nsw i32 %12, 1
+  store i32 %13, ptr %2, align 4
+  br label %3
+
+14:                                               ; preds = %3
+  %15 = call i32 @kernel(i32 noundef 1000, i32 noundef 1, i32 noundef 0)
+  %16 = and i32 %15, 255
+  ret i32 %16
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
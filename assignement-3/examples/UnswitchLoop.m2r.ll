@@ -0,0 +1,103 @@
+; ModuleID = 'UnswitchLoop.ll'
+source_filename = "UnswitchLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @kernel(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  br label %4
+
+4:                                                ; preds = %27, %3
+  %.01 = phi i32 [ 0, %3 ], [ %.2, %27 ]
+  %.0 = phi i32 [ 0, %3 ], [ %28, %27 ]
+  %5 = icmp slt i32 %.0, %0
+  br i1 %5, label %6, label %29
+
+6:                                                ; preds = %4
+  %7 = icmp ne i32 %1, 0
+  br i1 %7, label %8, label %14
+
+8:                                                ; preds = %6
+  %9 = sext i32 %.0 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %9
+  %11 = load i32, ptr %10, align 4
+  %12 = mul nsw i32 %11, 3
+  %13 = add nsw i32 %.01, %12
+  br label %19
+
+14:                                               ; preds = %6
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = sub nsw i32 %.01, %17
+  br label %19
+
+19:                                               ; preds = %14, %8
+  %.1 = phi i32 [ %13, %8 ], [ %18, %14 ]
+  switch i32 %2, label %24 [
+    i32 0, label %20
+    i32 1, label %22
+  ]
+
+20:                                               ; preds = %19
+  %21 = xor i32 %.1, %.0
+  br label %26
+
+22:                                               ; preds = %19
+  %23 = add nsw i32 %.1, %.0
+  br label %26
+
+24:                                               ; preds = %19
+  %25 = sub nsw i32 %.1, 1
+  br label %26
+
+26:                                               ; preds = %24, %22, %20
+  %.2 = phi i32 [ %25, %24 ], [ %23, %22 ], [ %21, %20 ]
+  br label %27
+
+27:                                               ; preds = %26
+  %28 = add nsw i32 %.0, 1
+  br label %4
+
+29:                                               ; preds = %4
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %6, %0
+  %.0 = phi i32 [ 0, %0 ], [ %7, %6 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %8
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  br label %6
+
+6:                                                ; preds = %3
+  %7 = add nsw i32 %.0, 1
+  br label %1
+
+8:                                                ; preds = %1
+  %9 = call i32 @kernel(i32 noundef 1000, i32 noundef 1, i32 noundef 0)
+  %10 = and i32 %9, 255
+  ret i32 %10
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
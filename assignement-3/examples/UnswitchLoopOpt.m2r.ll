@@ -0,0 +1,141 @@
+; ModuleID = 'UnswitchLoop.m2r.ll'
+source_filename = "UnswitchLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@v = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @kernel(i32 noundef %0, i32 noundef %1, i32 noundef %2) #0 {
+  %4 = icmp ne i32 %1, 0
+  br i1 %4, label %.split.us, label %.split
+
+.split.us:                                        ; preds = %3
+  %5 = icmp eq i32 %2, 0
+  br i1 %5, label %.split.us.split.us, label %.split.us.split
+
+.split.us.split.us:                               ; preds = %.split.us, %7
+  %.01.us.us = phi i32 [ %13, %7 ], [ 0, %.split.us ]
+  %.0.us.us = phi i32 [ %14, %7 ], [ 0, %.split.us ]
+  %6 = icmp slt i32 %.0.us.us, %0
+  br i1 %6, label %7, label %.split1
+
+7:                                                ; preds = %.split.us.split.us
+  %8 = sext i32 %.0.us.us to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = mul nsw i32 %10, 3
+  %12 = add nsw i32 %.01.us.us, %11
+  %13 = xor i32 %12, %.0.us.us
+  %14 = add nsw i32 %.0.us.us, 1
+  br label %.split.us.split.us, !llvm.loop !6
+
+.split.us.split:                                  ; preds = %.split.us, %28
+  %.01.us = phi i32 [ %.2.us, %28 ], [ 0, %.split.us ]
+  %.0.us = phi i32 [ %29, %28 ], [ 0, %.split.us ]
+  %15 = icmp slt i32 %.0.us, %0
+  br i1 %15, label %16, label %.split1
+
+16:                                               ; preds = %.split.us.split
+  %17 = sext i32 %.0.us to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = mul nsw i32 %19, 3
+  %21 = add nsw i32 %.01.us, %20
+  switch i32 %2, label %26 [
+    i32 0, label %24
+    i32 1, label %22
+  ]
+
+22:                                               ; preds = %16
+  %23 = add nsw i32 %21, %.0.us
+  br label %28
+
+24:                                               ; preds = %16
+  %25 = xor i32 %21, %.0.us
+  br label %28
+
+26:                                               ; preds = %16
+  %27 = sub nsw i32 %21, 1
+  br label %28
+
+28:                                               ; preds = %22, %24, %26
+  %.2.us = phi i32 [ %27, %26 ], [ %23, %22 ], [ %25, %24 ]
+  %29 = add nsw i32 %.0.us, 1
+  br label %.split.us.split, !llvm.loop !6
+
+.split:                                           ; preds = %3, %42
+  %.01 = phi i32 [ %.2, %42 ], [ 0, %3 ]
+  %.0 = phi i32 [ %43, %42 ], [ 0, %3 ]
+  %30 = icmp slt i32 %.0, %0
+  br i1 %30, label %31, label %.split1
+
+31:                                               ; preds = %.split
+  %32 = sext i32 %.0 to i64
+  %33 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %32
+  %34 = load i32, ptr %33, align 4
+  %35 = sub nsw i32 %.01, %34
+  switch i32 %2, label %40 [
+    i32 0, label %36
+    i32 1, label %38
+  ]
+
+36:                                               ; preds = %31
+  %37 = xor i32 %35, %.0
+  br label %42
+
+38:                                               ; preds = %31
+  %39 = add nsw i32 %35, %.0
+  br label %42
+
+40:                                               ; preds = %31
+  %41 = sub nsw i32 %35, 1
+  br label %42
+
+42:                                               ; preds = %36, %38, %40
+  %.2 = phi i32 [ %41, %40 ], [ %39, %38 ], [ %37, %36 ]
+  %43 = add nsw i32 %.0, 1
+  br label %.split, !llvm.loop !8
+
+.split1:                                          ; preds = %.split.us.split, %.split.us.split.us, %.split
+  %.01.lcssa = phi i32 [ %.01, %.split ], [ %.01.us, %.split.us.split ], [ %.01.us.us, %.split.us.split.us ]
+  ret i32 %.01.lcssa
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %3, %0
+  %.0 = phi i32 [ 0, %0 ], [ %6, %3 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %7
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @v, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  %6 = add nsw i32 %.0, 1
+  br label %1
+
+7:                                                ; preds = %1
+  %8 = call i32 @kernel(i32 noundef 1000, i32 noundef 1, i32 noundef 0)
+  %9 = and i32 %8, 255
+  ret i32 %9
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
+!6 = distinct !{!6, !7}
+!7 = !{!"loop-invariant.unswitch.count", i32 2}
+!8 = distinct !{!8, !9}
+!9 = !{!"loop-invariant.unswitch.count", i32 1}
@@ -11,6 +11,26 @@
 //      opt -load-pass-plugin=<path-to>libTestPass.so -passes="loop-fusion1" `\`
 //        -disable-output <input-llvm-file>
 //
+//    Con -fusion-versioning (richiede anche -load=<path-to>libTestPass.so)
+//    vengono fusi anche loop con trip count uguali solo a runtime
+//
+//    Le decisioni del modello di profittabilità vengono riportate come
+//    remark: -pass-remarks=loop-fusion1 -pass-remarks-missed=loop-fusion1
+//
+//    Il pass inverso, la distribuzione, divide un loop in più loop quando
+//    permette di vettorizzarne una parte o di usare meno cache:
+//      opt -load-pass-plugin=<path-to>libTestPass.so -passes="loop-distribution1" `\`
+//        -disable-output <input-llvm-file>
+//
+//    L'interchange scambia i loop di un nido perfetto quando il loop interno
+//    accede alla memoria a passi lunghi (remark: -pass-remarks=loop-interchange1):
+//      opt -load-pass-plugin=<path-to>libTestPass.so -passes="loop-interchange1" `\`
+//        -disable-output <input-llvm-file>
+//
+//    Il tiling divide un nido perfetto in blocchi che stanno nella cache
+//    (-tiling-cache-size, richiede anche -load=<path-to>libTestPass.so):
+//      opt -load-pass-plugin=<path-to>libTestPass.so -passes="loop-tiling1" `\`
+//        -disable-output <input-llvm-file>
 //
 // License: MIT
 //=============================================================================
@@ -18,11 +38,35 @@
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Passes/PassPlugin.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Analysis/AliasAnalysis.h" // Per confrontare le load delle guardie
 #include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/LoopIterator.h" // Per visitare il corpo in reverse post-order
 #include "llvm/IR/Dominators.h"
 #include "llvm/Analysis/PostDominators.h"
 #include "llvm/Analysis/ScalarEvolution.h" // Per analisi matematica delle espressioni
+#include "llvm/Analysis/ScalarEvolutionExpressions.h" // Per SCEVAddRecExpr e SCEVConstant
+#include "llvm/Analysis/DomTreeUpdater.h" // Per aggiornare DT e PDT in modo incrementale
+#include "llvm/ADT/SetVector.h"
 #include "llvm/Analysis/DependenceAnalysis.h" // Per rilevare dipendenze tra accessi memoria
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
+#include "llvm/Analysis/TargetTransformInfo.h" // Per il numero di registri del target
+#include "llvm/Analysis/ValueTracking.h" // Per isSafeToSpeculativelyExecute
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Verifier.h" // Per controllare il risultato della fusione
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/MathExtras.h" // Per i prodotti saturati nel modello della cache
+#include "llvm/Transforms/Utils/BasicBlockUtils.h"
+#include "llvm/Transforms/Utils/Cloning.h" // Per duplicare i loop nel versioning
+#include "llvm/Transforms/Utils/Local.h" // Per eliminare le istruzioni morte
+#include "llvm/Transforms/Utils/LoopUtils.h"
+#include "llvm/Transforms/Utils/ScalarEvolutionExpander.h" // Per generare il test a runtime
+#include "llvm/Transforms/Utils/SSAUpdater.h"
+#include <chrono> // Per misurare il tempo di ogni tentativo di fusione
+
+// Dopo gli header: PassBuilder.h ridefinisce DEBUG_TYPE e poi lo annulla
+#define DEBUG_TYPE "assignement4"
 
 using namespace llvm;
 
@@ -31,6 +75,103 @@ using namespace llvm;
 //-----------------------------------------------------------------------------
 namespace
 {
+  // Con trip count non dimostrabilmente uguali, fonde comunque i loop
+  // proteggendo la versione fusa con un test a runtime
+  cl::opt<bool> FusionVersioning(
+      "fusion-versioning",
+      cl::desc("Fonde loop con trip count uguali solo a runtime, mantenendo "
+               "una copia non fusa come fallback"),
+      cl::init(false));
+
+  // Oltre questo numero di oggetti acceduti due loop non vengono fusi (e
+  // due gruppi senza dati in comune vengono distribuiti): in cache si
+  // contenderebbero le stesse linee
+  cl::opt<unsigned> FusionMaxStreams(
+      "fusion-max-streams",
+      cl::desc("Numero massimo di oggetti acceduti da due loop fusi o da due "
+               "gruppi senza dati in comune lasciati nello stesso loop"),
+      cl::init(8));
+
+  // Il tiling sceglie il lato delle tile in modo che i dati usati da una
+  // tile stiano in una cache di questa dimensione (di default la L1)
+  cl::opt<unsigned> TilingCacheSize(
+      "tiling-cache-size",
+      cl::desc("Dimensione in byte della cache che deve contenere il working "
+               "set di una tile"),
+      cl::init(32768));
+
+  // Lato massimo di una tile (in iterazioni di ogni loop)
+  const uint64_t MaxTile = 1024;
+
+  // Metadato delle copie create da versioning e peeling: non vanno più fuse
+  const char* NoFusionMD = "loop-fusion1.nofuse";
+
+  // Come rendere uguali i trip count dei due loop prima della fusione
+  enum TripCountFix {
+    NoFix = 0,        // Trip count già uguali
+    RuntimeCheck = 1, // Uguali solo a runtime: versioning
+    PeelFirst = 2,    // L1 può avere più iterazioni: le ultime vengono eseguite dopo L2
+    PeelSecond = 4,   // L2 può avere più iterazioni
+    PeelBoth = PeelFirst | PeelSecond
+  };
+
+  // Loop CFG equivalenti dello stesso livello, in ordine di programma
+  typedef SmallVector<Loop*, 4> FusionCandidateSet;
+
+  /**
+   * Accessi in memoria del loop (load, store, chiamate), nell'ordine dei
+   * blocchi del loop
+   */
+  void collectMemoryAccesses(Loop* L, SmallVectorImpl<Instruction*> &Accesses) {
+    for(BasicBlock* BB : L->blocks()) {
+      for(Instruction &I : *BB) {
+        if(I.mayReadOrWriteMemory()) Accesses.push_back(&I);
+      }
+    }
+  }
+
+  /**
+   * Oggetti in memoria acceduti da un gruppo di istruzioni: la base SCEV
+   * del puntatore di ogni load e store. Ogni base è un flusso di dati che
+   * il loop porta in cache
+   */
+  template <typename RangeT>
+  void collectStreams(const RangeT &Insts, ScalarEvolution &SE, SmallPtrSetImpl<const SCEV*> &Streams) {
+    for(Instruction* I : Insts) {
+      if(Value* Ptr = getLoadStorePointerOperand(I)) {
+        Streams.insert(SE.getPointerBase(SE.getSCEV(Ptr)));
+      }
+    }
+  }
+
+  /**
+   * Conta gli oggetti acceduti da entrambi i gruppi di accessi (Shared) e
+   * quelli acceduti in totale (Total)
+   */
+  void countStreams(const SmallPtrSetImpl<const SCEV*> &Streams1,
+                    const SmallPtrSetImpl<const SCEV*> &Streams2,
+                    unsigned &Shared, unsigned &Total) {
+    Shared = 0;
+    for(const SCEV* S : Streams2) {
+      if(Streams1.count(S)) Shared++;
+    }
+    Total = Streams1.size() + Streams2.size() - Shared;
+  }
+
+  /**
+   * Conviene lasciare nello stesso loop due gruppi di accessi se
+   * condividono almeno un oggetto (riuso in cache alla stessa iterazione)
+   * oppure se in totale accedono a pochi oggetti. È il criterio della
+   * distribuzione: separare gruppi piccoli e indipendenti costerebbe solo
+   * un loop in più
+   */
+  bool shareCacheProfitably(const SmallPtrSetImpl<const SCEV*> &Streams1,
+                            const SmallPtrSetImpl<const SCEV*> &Streams2,
+                            unsigned &Shared, unsigned &Total) {
+    countStreams(Streams1, Streams2, Shared, Total);
+    return Shared > 0 || Total <= FusionMaxStreams;
+  }
+
   // Struttura principale del pass per la fusione di loop
   // Eredita da PassInfoMixin per integrarsi nel nuovo Pass Manager di LLVM
   struct LoopFusion1 : PassInfoMixin<LoopFusion1>
@@ -41,27 +182,182 @@ namespace
      * Un loop è adiacente se l'uscita del primo coincide con l'ingresso del secondo
      * Questa è una condizione necessaria per la fusione sicura dei loop
      */
-    bool areAdjacent(Loop* L1, Loop* L2) {
+    bool areAdjacent(Loop* L1, Loop* L2, DominatorTree &DT) {
       outs() << "Controllo se i loop sono adiacenti\n";
-      
+
+      // I loop ruotati (do/while, for dopo loop-rotate) escono dal latch e
+      // vengono fusi da fuseRotatedLoops, gli altri da fuseLoops
+      if(L1->isRotatedForm() != L2->isRotatedForm()) {
+        outs() << "Solo uno dei loop è ruotato\n";
+        return false;
+      }
+      if(L1->isRotatedForm()) return areRotatedAdjacent(L1, L2, DT);
+
       // getExitBlock() ritorna null se ci sono multiple uscite
       // Per la fusione, è necessario che ogni loop abbia una sola uscita
       BasicBlock* ExitL1 = L1->getExitBlock();
-      BasicBlock* EntryL2;
-
-      // Gestione dei loop con guard: alcuni loop hanno una condizione di guardia
-      // che precede il loop vero e proprio per ottimizzazioni del compilatore
-      if(L2->isGuarded()){ 
-        // Se il loop ha una guardia, consideriamo il blocco precedente al guard
-        // come punto di ingresso effettivo
-        EntryL2 = L2->getLoopGuardBranch()->getParent()->getPrevNode();
-      } else {
-        // Altrimenti usiamo il preheader standard (blocco che precede l'header del loop)
-        EntryL2 = L2->getLoopPreheader();  
+
+      // Due loop sono adiacenti se l'uscita del primo è il preheader del secondo
+      return ExitL1 && ExitL1 == L2->getLoopPreheader();
+    }
+
+    /**
+     * Blocco vuoto: solo il terminatore ed eventualmente phi senza usi
+     * (LCSSA di valori che dopo il loop non servono)
+     */
+    bool isEmptyBlock(BasicBlock* BB) {
+      for(Instruction &I : *BB) {
+        if(!I.isTerminator() && !(isa<PHINode>(I) && I.use_empty())) return false;
       }
-      
-      // Due loop sono adiacenti se l'uscita del primo è l'ingresso del secondo
-      return EntryL2 == ExitL1;
+      return true;
+    }
+
+    /**
+     * Adiacenza di due loop ruotati, che escono solo dal latch. Senza
+     * guardie l'uscita di L1 deve essere il preheader di L2; con le guardie
+     * la guardia di L1, se falsa, salta alla guardia di L2 e L1 esce verso
+     * la stessa guardia passando solo per blocchi vuoti:
+     *
+     *   G1: br c1, ph1, G2        G1: br c1, ph1, end
+     *   ph1 -> L1 -> G2           ph1 -> L1 + L2 -> exit2 -> end
+     *   G2: br c2, ph2, end
+     *   ph2 -> L2 -> exit2 -> end
+     *
+     * Tra i due loop c'è solo il calcolo della condizione c2, che dopo la
+     * fusione non serve più: nessun effetto collaterale e nessun uso fuori
+     * da G2. I valori iniziali delle phi di L2 devono essere già
+     * disponibili nel preheader di L1 e L2 non può usare valori di L1
+     */
+    bool areRotatedAdjacent(Loop* L1, Loop* L2, DominatorTree &DT) {
+      BasicBlock* PreHead1 = L1->getLoopPreheader();
+      BasicBlock* PreHead2 = L2->getLoopPreheader();
+      BasicBlock* Exit1 = L1->getExitBlock();
+      if(!PreHead1 || !PreHead2 || !Exit1 || !L2->getExitBlock()) return false;
+      if(L1->getExitingBlock() != L1->getLoopLatch() || L2->getExitingBlock() != L2->getLoopLatch()) {
+        outs() << "I loop ruotati devono uscire solo dal latch\n";
+        return false;
+      }
+
+      if(L1->isGuarded() != L2->isGuarded()) {
+        outs() << "Solo uno dei loop è guarded\n";
+        return false;
+      }
+      if(L1->isGuarded()) {
+        BranchInst* Guard1 = L1->getLoopGuardBranch();
+        BasicBlock* GuardBB2 = L2->getLoopGuardBranch()->getParent();
+        BasicBlock* Skip1 = Guard1->getSuccessor(0) == PreHead1 ? Guard1->getSuccessor(1) : Guard1->getSuccessor(0);
+        if(Skip1 != GuardBB2) {
+          outs() << "La guardia di L1 non salta alla guardia di L2\n";
+          return false;
+        }
+        // isGuarded garantisce che da Exit1 si arrivi a G2 per blocchi vuoti
+        // con un solo successore
+        for(BasicBlock* BB = Exit1; BB != GuardBB2; BB = BB->getSingleSuccessor()) {
+          if(!isEmptyBlock(BB)) {
+            outs() << "Tra L1 e la guardia di L2 c'è del codice\n";
+            return false;
+          }
+        }
+        for(Instruction &I : *GuardBB2) {
+          if(I.isTerminator()) continue;
+          if(isa<PHINode>(I) || I.mayHaveSideEffects()) {
+            outs() << "La guardia di L2 non si può eliminare:" << I << "\n";
+            return false;
+          }
+          for(User* U : I.users()) {
+            if(cast<Instruction>(U)->getParent() != GuardBB2) {
+              outs() << "Valore della guardia di L2 usato altrove:" << I << "\n";
+              return false;
+            }
+          }
+        }
+        if(!isEmptyBlock(PreHead2)) {
+          outs() << "Il preheader di L2 contiene codice\n";
+          return false;
+        }
+      } else if(Exit1 != PreHead2 || !isEmptyBlock(PreHead2)) {
+        return false;
+      }
+
+      for(PHINode &PN : L2->getHeader()->phis()) {
+        Instruction* Start = dyn_cast<Instruction>(PN.getIncomingValueForBlock(PreHead2));
+        if(Start && !DT.dominates(Start, PreHead1->getTerminator())) {
+          outs() << "Valore iniziale non disponibile prima di L1:" << PN << "\n";
+          return false;
+        }
+      }
+      for(BasicBlock* BB : L1->blocks()) {
+        for(Instruction &I : *BB) {
+          for(User* U : I.users()) {
+            if(L2->contains(cast<Instruction>(U))) {
+              outs() << "L2 usa un valore calcolato in L1:" << I << "\n";
+              return false;
+            }
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Due valori delle condizioni delle guardie sono uguali se sono lo
+     * stesso valore, se SCEV dà la stessa espressione oppure se sono load
+     * dallo stesso indirizzo e tra le due load nessuna istruzione può
+     * scrivere nella locazione. Le istruzioni eseguite tra le due load sono
+     * quelle dei blocchi dominati dalla prima e post-dominati dalla seconda
+     */
+    bool areSameGuardValues(Value* V1, Value* V2, ScalarEvolution &SE, AAResults &AA,
+                            DominatorTree &DT, PostDominatorTree &PDT) {
+      if(V1 == V2) return true;
+      if(V1->getType() != V2->getType()) return false;
+      if(SE.isSCEVable(V1->getType()) && SE.getSCEV(V1) == SE.getSCEV(V2)) return true;
+
+      LoadInst* Load1 = dyn_cast<LoadInst>(V1);
+      LoadInst* Load2 = dyn_cast<LoadInst>(V2);
+      if(!Load1 || !Load2 || !Load1->isSimple() || !Load2->isSimple()) return false;
+      if(SE.getSCEV(Load1->getPointerOperand()) != SE.getSCEV(Load2->getPointerOperand())) return false;
+      if(DT.dominates(Load2, Load1)) std::swap(Load1, Load2);
+      BasicBlock* From = Load1->getParent();
+      BasicBlock* To = Load2->getParent();
+      if(!DT.dominates(Load1, Load2) || !PDT.dominates(To, From)) return false;
+
+      MemoryLocation Loc = MemoryLocation::get(Load1);
+      for(BasicBlock &BB : *From->getParent()) {
+        if(!DT.dominates(From, &BB) || !PDT.dominates(To, &BB)) continue;
+        for(Instruction &I : BB) {
+          if(isModSet(AA.getModRefInfo(&I, Loc))) {
+            outs() << "La locazione letta dalle guardie può cambiare:" << I << "\n";
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Le due guardie entrano nel loop nelle stesse condizioni. Il predicato
+     * viene invertito se il preheader è sul ramo falso e scambiato se gli
+     * operandi sono in ordine inverso (n > 0 e 0 < n)
+     */
+    bool areGuardsEquivalent(BranchInst* Guard1, BranchInst* Guard2, Loop* L1, Loop* L2,
+                             ScalarEvolution &SE, AAResults &AA, DominatorTree &DT, PostDominatorTree &PDT) {
+      bool Inverted1 = Guard1->getSuccessor(1) == L1->getLoopPreheader();
+      bool Inverted2 = Guard2->getSuccessor(1) == L2->getLoopPreheader();
+      if(Guard1->getCondition() == Guard2->getCondition()) return Inverted1 == Inverted2;
+
+      ICmpInst* Cmp1 = dyn_cast<ICmpInst>(Guard1->getCondition());
+      ICmpInst* Cmp2 = dyn_cast<ICmpInst>(Guard2->getCondition());
+      if(!Cmp1 || !Cmp2) return false;
+      ICmpInst::Predicate Pred1 = Inverted1 ? Cmp1->getInversePredicate() : Cmp1->getPredicate();
+      ICmpInst::Predicate Pred2 = Inverted2 ? Cmp2->getInversePredicate() : Cmp2->getPredicate();
+      Value* LHS2 = Cmp2->getOperand(0);
+      Value* RHS2 = Cmp2->getOperand(1);
+      if(Pred1 != Pred2) {
+        if(Pred1 != ICmpInst::getSwappedPredicate(Pred2)) return false;
+        std::swap(LHS2, RHS2);
+      }
+      return areSameGuardValues(Cmp1->getOperand(0), LHS2, SE, AA, DT, PDT) &&
+             areSameGuardValues(Cmp1->getOperand(1), RHS2, SE, AA, DT, PDT);
     }
 
     /**
@@ -70,21 +366,20 @@ namespace
      * Usa dominanza diretta e post-dominanza per garantire equivalenza
      * Due loop sono CFG equivalenti se hanno la stessa struttura di controllo
      */
-    bool areCFGEquivalent(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT) {
+    bool areCFGEquivalent(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                          ScalarEvolution &SE, AAResults &AA) {
 
       // Blocchi di riferimento per il controllo di dominanza
       // Questi saranno i blocchi su cui verificare le relazioni di dominanza
       BasicBlock* BlockL1;
       BasicBlock* BlockL2;
 
-      // Caso 1: entrambi hanno guardie - devono essere identiche
-      // I loop con guardie hanno condizioni di ingresso che devono essere uguali
+      // Caso 1: entrambi hanno guardie - devono entrare nel loop nelle stesse condizioni
       if(L1->isGuarded() && L2->isGuarded()) {
         outs() << "Entrambi i loop sono guarded\n";
         
-        // Le condizioni delle guardie devono essere sintatticamente uguali
-        // isSameOperationAs verifica che le istruzioni siano identiche
-        if(L1->getLoopGuardBranch()->isSameOperationAs(L2->getLoopGuardBranch())) {
+        // Le condizioni possono essere istruzioni diverse con lo stesso valore
+        if(areGuardsEquivalent(L1->getLoopGuardBranch(), L2->getLoopGuardBranch(), L1, L2, SE, AA, DT, PDT)) {
           outs() << "La condizione è uguale\n";
           // Usiamo i blocchi che contengono le guardie per l'analisi di dominanza
           BlockL1 = L1->getLoopGuardBranch()->getParent();
@@ -102,6 +397,11 @@ namespace
         BlockL1 = L1->getHeader();
         BlockL2 = L2->getHeader();
       }
+      // Caso 3: solo uno dei due ha la guardia
+      else {
+        outs() << "Solo uno dei loop è guarded\n";
+        return false;
+      }
       
       // ANALISI DI DOMINANZA:
       // Un blocco A domina B se ogni cammino dall'entrata a B passa per A
@@ -120,171 +420,587 @@ namespace
       return DT.dominates(BlockL1, BlockL2) && PDT.dominates(BlockL2, BlockL1);
     }
 
+    /**
+     * Numero di iterazioni come espressione SCEV: il backedge-taken count
+     * portato al tipo richiesto. Funziona anche con limiti noti solo a
+     * runtime: for (i = 0; i < n; i++) non ruotato dà (0 smax %n)
+     */
+    const SCEV* getBackedgeTakenCount(Loop* L, Type* Ty, ScalarEvolution* SE) {
+      const SCEV* BTC = SE->getBackedgeTakenCount(L);
+      if(isa<SCEVCouldNotCompute>(BTC) || !Ty) return BTC;
+      return SE->getNoopOrZeroExtend(BTC, Ty);
+    }
+
     /**
      * CONDIZIONE 3: STESSO NUMERO DI ITERAZIONI
      * Verifica che i loop abbiano lo stesso numero di iterazioni
      * Necessario per garantire che la fusione mantenga la semantica originale
+     * Fix indica cosa fare prima della fusione se i trip count non sono
+     * uguali: peeling delle iterazioni in più dei loop che possono essere
+     * più lunghi, oppure test a runtime (se il versioning è attivo) quando
+     * il peeling non è possibile
      */
-    bool sameIterationNumber(Loop* L1, Loop* L2, ScalarEvolution* SE) {
+    bool sameIterationNumber(Loop* L1, Loop* L2, ScalarEvolution* SE, TripCountFix &Fix) {
+      Fix = NoFix;
 
-      // Trip count: numero costante di iterazioni calcolato staticamente
-      // ScalarEvolution può determinare il numero di iterazioni per loop semplici
-      // Ritorna 0 se non riesce a calcolare un valore costante
-      unsigned int L1TripCount = SE->getSmallConstantTripCount(L1);
-      unsigned int L2TripCount = SE->getSmallConstantTripCount(L2);
-      
-      outs() << "Trip count L1: " << L1TripCount << "\n";
-      outs() << "Trip count L2: " << L2TripCount << "\n";
+      // Confrontiamo le espressioni simboliche invece dei valori costanti:
+      // due loop limitati dallo stesso %n hanno lo stesso backedge-taken count
+      const SCEV* BTC1 = SE->getBackedgeTakenCount(L1);
+      const SCEV* BTC2 = SE->getBackedgeTakenCount(L2);
+
+      outs() << "Backedge-taken count L1: " << *BTC1 << "\n";
+      outs() << "Backedge-taken count L2: " << *BTC2 << "\n";
 
-      // Se non riusciamo a calcolare almeno uno, fusione non sicura
       // Senza sapere il numero di iterazioni, non possiamo garantire correttezza
-      if(L1TripCount == 0 || L2TripCount == 0) {
+      if(isa<SCEVCouldNotCompute>(BTC1) || isa<SCEVCouldNotCompute>(BTC2)) {
         outs() << "Almeno un trip count non è calcolabile\n";
         return false;
       }
-      
-      // I trip count devono essere identici per una fusione sicura
-      if(L1TripCount == L2TripCount) {
+
+      // isKnownPredicate richiede espressioni dello stesso tipo
+      Type* Ty = SE->getWiderType(BTC1->getType(), BTC2->getType());
+      BTC1 = SE->getNoopOrZeroExtend(BTC1, Ty);
+      BTC2 = SE->getNoopOrZeroExtend(BTC2, Ty);
+
+      if(SE->isKnownPredicate(ICmpInst::ICMP_EQ, BTC1, BTC2)) {
         return true;
       }
 
+      // Trip count diversi (es. i < n e i < n - 1): il loop fuso esegue il
+      // minimo delle iterazioni, quelle in più vengono staccate dal loop più
+      // lungo. Se SCEV non sa quale dei due è più lungo li stacchiamo da
+      // entrambi e una delle due copie non esegue nessuna iterazione
+      if(canRewriteRegion(L1, L2, BTC1, BTC2, SE)) {
+        unsigned Peel = NoFix;
+        if(!SE->isKnownPredicate(ICmpInst::ICMP_ULE, BTC1, BTC2)) Peel |= PeelFirst;
+        if(!SE->isKnownPredicate(ICmpInst::ICMP_ULE, BTC2, BTC1)) Peel |= PeelSecond;
+        if((!(Peel & PeelFirst) || canPeel(L1)) && (!(Peel & PeelSecond) || canPeel(L2))) {
+          outs() << "Trip count diversi: peeling delle iterazioni in più di "
+                 << (Peel == PeelBoth ? "entrambi i loop" : Peel == PeelFirst ? "L1" : "L2") << "\n";
+          Fix = TripCountFix(Peel);
+          return true;
+        }
+      }
+      if(SE->isKnownPredicate(ICmpInst::ICMP_NE, BTC1, BTC2)) {
+        outs() << "I trip count sono sicuramente diversi\n";
+        return false;
+      }
+
+      // Uguaglianza non decidibile staticamente: eventualmente la controlliamo a runtime
+      if(FusionVersioning && canRewriteRegion(L1, L2, BTC1, BTC2, SE)) {
+        outs() << "I trip count sono confrontabili solo a runtime: versioning\n";
+        Fix = RuntimeCheck;
+        return true;
+      }
       return false;
     }
 
     /**
-     * CONDIZIONE 4: ANALISI DIPENDENZE NEGATIVE
-     * Analizza dipendenze negative tra accessi memoria dei due loop
-     * Una dipendenza negativa si verifica quando L2 legge da una locazione
-     * che L1 scriverà in una iterazione futura, violando l'ordine di esecuzione
+     * Versioning e peeling duplicano parte della regione che va dal preheader
+     * di L1 all'uscita di L2 e usano i trip count come valori. Serve che i
+     * loop siano adiacenti, non ruotati, con una sola uscita, e che i trip
+     * count si possano calcolare prima di L1: se il limite di L2 dipende da
+     * valori calcolati in L1 non si può usare nel preheader
      */
-    bool hasDependence(Loop* L1, Loop* L2, ScalarEvolution* SE) {
-      
-      // STRATEGIA: cercare pattern Write-After-Read (WAR) tra i loop
-      // Scorriamo tutte le scritture in L1 e tutte le letture in L2
-      
-      // Scorro tutti i basic block del primo loop
-      for(auto* BB : L1->blocks()) {
-        // Analizzo ogni istruzione cercando store (scritture in memoria)
-        for(auto I = BB->begin(); I != BB->end(); ++I) {
-          if(StoreInst *store = dyn_cast<StoreInst>(I)) {
+    bool canRewriteRegion(Loop* L1, Loop* L2, const SCEV* BTC1, const SCEV* BTC2, ScalarEvolution* SE) {
+      BasicBlock* PreHead1 = L1->getLoopPreheader();
+      if(!PreHead1 || L1->isRotatedForm() || L2->isRotatedForm()) return false;
+      if(!L1->getExitBlock() || L1->getExitBlock() != L2->getLoopPreheader() || !L2->getExitBlock()) return false;
+      if(!L1->isSafeToClone() || !L2->isSafeToClone()) return false;
+      // Inutile duplicare se poi la fusione fallisce
+      if(!canMergeLoopBlocks(L1, L2, *SE)) return false;
 
-            outs() << "trovata una store: " << *store << '\n';
-            
-            // ANALISI DELL'ACCESSO MEMORIA DELLA STORE:
-            // Estraggo l'istruzione GEP (GetElementPtr) per l'indirizzamento
-            // GEP calcola l'indirizzo di un elemento in una struttura dati
-            Instruction* getElemPtrS = dyn_cast<Instruction>(store->getOperand(1));
-            
-            // Base dell'array (primo operando) e offset per l'accesso (terzo operando)
-            // Operando 0: base pointer, Operando 2: indice dell'array
-            Value* baseS = getElemPtrS->getOperand(0);
-            Value* offsetS = getElemPtrS->getOperand(2);
-            outs() << "base: " << *baseS << "\n";
-            outs() << "offset" << *offsetS << "\n";
-            outs() << "-----------------------------------------" << "\n";
-
-            // Scorro il secondo loop cercando load (letture da memoria)
-            for(auto* BB : L2->blocks()) {
-              for(auto I = BB->begin(); I != BB->end(); ++I) {
-                if(LoadInst *load = dyn_cast<LoadInst>(I)) {
-                  outs() << "trovata una load: " << *load << '\n';
-                  
-                  // ANALISI DELL'ACCESSO MEMORIA DELLA LOAD:
-                  // Estraggo base e offset della load con la stessa logica
-                  Instruction* getElemPtrL = dyn_cast<Instruction>(load->getOperand(0));
-                  Value* baseL = getElemPtrL->getOperand(0);
-                  Value* offsetL = getElemPtrL->getOperand(2);
-                  outs() << "base: " << *baseL << "\n";
-                  outs() << "offset" << *offsetL << "\n";
-                  outs() << "-----------------------------------------" << "\n";
-
-                  // CONTROLLO DIPENDENZA: stessi array = possibile conflitto
-                  if(baseS == baseL) {
-                    outs() << "La store e la load si riferiscono allo stesso array\n";
-
-                    // ANALISI SCALAR EVOLUTION:
-                    // SCEV (Scalar Evolution) analizza come cambiano i valori nelle iterazioni
-                    // Permette di capire pattern matematici negli indici degli array
-                    const SCEV* storeSCEV = SE->getSCEV(offsetS);
-                    outs()<< *storeSCEV << "\t calcolo offset store \n";
-                    const SCEV* loadSCEV = SE->getSCEV(offsetL);
-                    outs() << *loadSCEV << "\t calcolo offset load \n";
-                    // CAST A AddRecExpr: pattern ricorsivi del tipo {start, +, step}
-                    // Rappresentano sequenze come start, start+step, start+2*step, ...
-                    const SCEVAddRecExpr* storeARE = dyn_cast<SCEVAddRecExpr>(storeSCEV);
-                    const SCEVAddRecExpr* loadARE = dyn_cast<SCEVAddRecExpr>(loadSCEV);
-
-                    // Se entrambi sono pattern ricorsivi, analizzo la dipendenza matematicamente
-                    if(storeARE && loadARE) {
-                      // ESTRAZIONE PARAMETRI DEL PATTERN:
-                      // Start: valore iniziale della sequenza
-                      const SCEV* storeStart = storeARE->getStart();
-                      const SCEV* loadStart = loadARE->getStart();
-
-                      // Step: incremento ad ogni iterazione
-                      const SCEV* storeStep = storeARE->getStepRecurrence(*SE);
-                      const SCEV* loadStep = loadARE->getStepRecurrence(*SE);
-                      
-                      outs() << "Inizio store: " << *storeStart << "\n";
-                      outs() << "Inizio load: " << *loadStart << "\n";
-
-                      // CONTROLLO DIPENDENZA NEGATIVA:
-                      // Se hanno lo stesso step, gli indici crescono allo stesso ritmo
-                      if(storeStep == loadStep) {
-                        // Calcolo la differenza tra i punti di partenza
-                        const SCEV* diff = SE->getMinusSCEV(storeStart,loadStart);
-
-                        // Se la differenza è una costante, posso valutarla
-                        if(const SCEVConstant * diffConst = dyn_cast<SCEVConstant>(diff)) {
-                          int64_t diffValue = diffConst->getAPInt().getSExtValue();
-                          outs() << "Differenza tra gli start: " << diffValue << "\n";
-                          
-                          // DIPENDENZA NEGATIVA: store_start < load_start
-                          // Significa che L2 legge da posizioni che L1 scriverà dopo
-                          // Questo violerebbe la semantica se i loop fossero fusi
-                          if(diffValue < 0) {
-                            outs() << "Abbiamo una dipendenza negativa tra i due loop!" << "\n";
-                            return true; // Dipendenza trovata = fusione non sicura
-                          }
-                        }
-                      } else {
-                        return true;
-                      }
-                    }
-                    else {
-                      return true;
-                    }
-                  }
-                }
-              }
+      for(const SCEV* BTC : {BTC1, BTC2}) {
+        if(!SE->properlyDominates(BTC, PreHead1)) return false;
+        // Una divisione per un valore non costante potrebbe essere per zero
+        if(SCEVExprContains(BTC, [](const SCEV* S) {
+             const SCEVUDivExpr* Div = dyn_cast<SCEVUDivExpr>(S);
+             return Div && !isa<SCEVConstant>(Div->getRHS());
+           })) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * VERSIONING
+     * Duplica L1, il blocco tra i due loop e L2. Un test nel preheader di L1
+     * confronta i trip count: se sono uguali si eseguono gli originali, che
+     * verranno fusi, altrimenti le copie, che restano separate
+     */
+    void versionLoops(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                      LoopInfo &LI, ScalarEvolution &SE) {
+      BasicBlock* CheckBB = L1->getLoopPreheader();
+      BasicBlock* PreHead2 = L2->getLoopPreheader();
+      BasicBlock* Exit2 = L2->getExitBlock();
+      Function* F = CheckBB->getParent();
+
+      // Il test va calcolato prima di duplicare, nel vecchio preheader
+      Type* Ty = SE.getWiderType(SE.getBackedgeTakenCount(L1)->getType(),
+                                 SE.getBackedgeTakenCount(L2)->getType());
+      SCEVExpander Expander(SE, F->getParent()->getDataLayout(), "fusion");
+      Value* Count1 = Expander.expandCodeFor(getBackedgeTakenCount(L1, Ty, &SE), Ty, CheckBB->getTerminator());
+      Value* Count2 = Expander.expandCodeFor(getBackedgeTakenCount(L2, Ty, &SE), Ty, CheckBB->getTerminator());
+      DomTreeUpdater DTU(DT, PDT, DomTreeUpdater::UpdateStrategy::Lazy);
+      BasicBlock* PreHead1 = SplitBlock(CheckBB, CheckBB->getTerminator(), &DTU, &LI);
+      // cloneLoopWithPreheader legge e aggiorna direttamente DT
+      DTU.flush();
+
+      // Blocchi originali della regione, per riconoscere gli usi esterni
+      SmallVector<BasicBlock*, 16> Region;
+      Region.push_back(PreHead1);
+      Region.append(L1->block_begin(), L1->block_end());
+      Region.push_back(PreHead2);
+      Region.append(L2->block_begin(), L2->block_end());
+
+      // Stessa VMap per le due copie: le uscite della copia di L1 vengono
+      // rimappate sulla copia del preheader di L2
+      ValueToValueMapTy VMap;
+      SmallVector<BasicBlock*, 16> Cloned1, Cloned2;
+      Loop* Copy1 = cloneLoopWithPreheader(PreHead1, CheckBB, L1, VMap, ".nofuse", &LI, &DT, Cloned1);
+      BasicBlock* IDom2 = DT.getNode(PreHead2)->getIDom()->getBlock();
+      Loop* Copy2 = cloneLoopWithPreheader(PreHead1, cast<BasicBlock>(VMap[IDom2]), L2, VMap, ".nofuse", &LI, &DT, Cloned2);
+      Cloned1.append(Cloned2.begin(), Cloned2.end());
+      remapInstructionsInBlocks(Cloned1, VMap);
+      addStringMetadataToLoop(Copy1, NoFusionMD, 1);
+      addStringMetadataToLoop(Copy2, NoFusionMD, 1);
+
+      IRBuilder<> Builder(CheckBB->getTerminator());
+      Value* Same = Builder.CreateICmpEQ(Count1, Count2, "tripcount.eq");
+      Builder.CreateCondBr(Same, PreHead1, cast<BasicBlock>(VMap[PreHead1]));
+      CheckBB->getTerminator()->eraseFromParent();
+
+      // DT conosce già le copie: mancano l'arco dal test e quelli verso Exit2
+      SmallVector<DominatorTree::UpdateType, 4> Updates;
+      Updates.push_back({DominatorTree::Insert, CheckBB, cast<BasicBlock>(VMap[PreHead1])});
+      for(BasicBlock* BB : Cloned2) {
+        if(is_contained(successors(BB), Exit2)) Updates.push_back({DominatorTree::Insert, BB, Exit2});
+      }
+      DTU.applyUpdates(Updates);
+
+      // L'uscita di L2 viene raggiunta anche dalla copia
+      for(PHINode &PN : Exit2->phis()) {
+        unsigned NumIncoming = PN.getNumIncomingValues();
+        for(unsigned i = 0; i < NumIncoming; i++) {
+          // Solo gli archi che arrivano da L2 hanno una copia
+          if(!L2->contains(PN.getIncomingBlock(i))) continue;
+          Value* V = PN.getIncomingValue(i);
+          Value* Mapped = VMap.lookup(V);
+          PN.addIncoming(Mapped ? Mapped : V, cast<BasicBlock>(VMap[PN.getIncomingBlock(i)]));
+        }
+        SE.forgetValue(&PN);
+      }
+
+      // Un valore della regione usato dopo L2 ora ha due definizioni: SSAUpdater
+      // inserisce le phi necessarie
+      SmallPtrSet<BasicBlock*, 32> Inside(Region.begin(), Region.end());
+      Inside.insert(Cloned1.begin(), Cloned1.end());
+      for(BasicBlock* BB : Region) {
+        for(Instruction &I : *BB) {
+          SmallVector<Use*, 4> Outside;
+          for(Use &U : I.uses()) {
+            Instruction* User = cast<Instruction>(U.getUser());
+            BasicBlock* UseBB = User->getParent();
+            if(PHINode* PN = dyn_cast<PHINode>(User)) {
+              // Le phi dell'uscita sono già state completate sopra
+              if(PN->getParent() == Exit2) continue;
+              UseBB = PN->getIncomingBlock(U);
             }
+            if(!Inside.count(UseBB)) Outside.push_back(&U);
+          }
+          if(Outside.empty()) continue;
+
+          Instruction* Copy = cast<Instruction>(VMap[&I]);
+          SSAUpdater SSA;
+          SSA.Initialize(I.getType(), I.getName());
+          SSA.AddAvailableValue(BB, &I);
+          SSA.AddAvailableValue(Copy->getParent(), Copy);
+          for(Use* U : Outside) {
+            SE.forgetValue(U->getUser());
+            SSA.RewriteUse(*U);
           }
         }
       }
-      return false; // Nessuna dipendenza negativa trovata
+
+      DTU.flush();
+      assert(DT.verify(DominatorTree::VerificationLevel::Fast) && "DT non valido dopo il versioning");
+      assert(PDT.verify(PostDominatorTree::VerificationLevel::Fast) && "PDT non valido dopo il versioning");
+      outs() << "Versioning completato: test " << *Same << "\n";
+    }
+
+    /**
+     * Il loop da accorciare esce solo dall'header (la forma che fuseLoops sa
+     * trattare) e non ha sotto-loop. I suoi valori non devono servire fuori
+     * dal loop: dopo il peeling il valore finale verrebbe dalla copia, non
+     * più dal loop
+     */
+    bool canPeel(Loop* L) {
+      BasicBlock* Header = L->getHeader();
+      if(!L->isInnermost() || L->getExitingBlock() != Header) return false;
+      if(!isa<BranchInst>(Header->getTerminator())) return false;
+      for(BasicBlock* BB : L->blocks()) {
+        for(Instruction &I : *BB) {
+          for(User* U : I.users()) {
+            if(!L->contains(cast<Instruction>(U))) return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * PEELING DELLE ITERAZIONI IN PIÙ
+     * Il loop più lungo si ferma dopo Limit iterazioni, le stesse dell'altro,
+     * e le iterazioni rimanenti le esegue una copia del loop inserita dopo L2.
+     * Se il loop lungo è L1 le sue ultime iterazioni finiscono dopo L2: è lo
+     * stesso riordino che fa la fusione, quindi basta il controllo sulle
+     * dipendenze negative. Se è L2 l'ordine resta quello originale
+     */
+    void peelLoop(Loop* L, Loop* L2, Value* Limit, DominatorTree &DT,
+                  PostDominatorTree &PDT, LoopInfo &LI, ScalarEvolution &SE) {
+      BasicBlock* Header = L->getHeader();
+      BasicBlock* PreHead = L->getLoopPreheader();
+      BasicBlock* Exit = L->getExitBlock();
+      BasicBlock* Exit2 = L2->getExitBlock();
+      Function* F = Header->getParent();
+
+      // Exit2 diventa il preheader della copia, il resto della funzione la segue
+      DomTreeUpdater DTU(DT, PDT, DomTreeUpdater::UpdateStrategy::Lazy);
+      BasicBlock* Rest = SplitBlock(Exit2, Exit2->getFirstNonPHI(), &DTU, &LI);
+
+      ValueToValueMapTy VMap;
+      VMap[PreHead] = Exit2;
+      VMap[Exit] = Rest;
+      SmallVector<BasicBlock*, 8> Blocks;
+      for(BasicBlock* BB : L->blocks()) {
+        BasicBlock* Copy = CloneBasicBlock(BB, VMap, ".peel", F);
+        Copy->moveBefore(Rest);
+        VMap[BB] = Copy;
+        Blocks.push_back(Copy);
+      }
+      remapInstructionsInBlocks(Blocks, VMap);
+
+      // La copia riparte dai valori con cui il loop è uscito
+      for(PHINode &PN : Header->phis()) {
+        cast<PHINode>(VMap[&PN])->setIncomingValueForBlock(Exit2, &PN);
+      }
+      Exit2->getTerminator()->setSuccessor(0, cast<BasicBlock>(VMap[Header]));
+
+      // Gli archi della copia sono tutti nuovi, quello di Exit2 viene deviato
+      SmallVector<BasicBlock*, 8> Rewired(Blocks.begin(), Blocks.end());
+      Rewired.push_back(Exit2);
+      SmallVector<SmallPtrSet<BasicBlock*, 2>, 8> OldSuccs(Blocks.size());
+      OldSuccs.push_back({Rest});
+      applyEdgeUpdates(Rewired, OldSuccs, DTU);
+      // SCEVExpander interroga DT attraverso SE
+      DTU.flush();
+
+      // Il loop originale esce anche quando il contatore delle iterazioni
+      // {0,+,1} raggiunge il limite: la IV canonica se c'è, altrimenti lo
+      // generiamo con SCEVExpander
+      BranchInst* Br = cast<BranchInst>(Header->getTerminator());
+      Value* IV = L->getCanonicalInductionVariable();
+      if(!IV) {
+        Type* Ty = Limit->getType();
+        const SCEV* Count = SE.getAddRecExpr(SE.getZero(Ty), SE.getOne(Ty), L, SCEV::FlagNUW);
+        SCEVExpander Expander(SE, F->getParent()->getDataLayout(), "peel");
+        IV = Expander.expandCodeFor(Count, Ty, &*Header->getFirstInsertionPt());
+      }
+      IRBuilder<> Builder(Br);
+      Value* Bound = Builder.CreateZExtOrTrunc(Limit, IV->getType());
+      if(L->contains(Br->getSuccessor(0))) {
+        Br->setCondition(Builder.CreateAnd(Br->getCondition(), Builder.CreateICmpULT(IV, Bound, "peel.cmp")));
+      } else {
+        Br->setCondition(Builder.CreateOr(Br->getCondition(), Builder.CreateICmpUGE(IV, Bound, "peel.cmp")));
+      }
+      SE.forgetLoop(L);
+
+      Loop* Peeled = LI.AllocateLoop();
+      if(Loop* Parent = LI.getLoopFor(Exit2)) {
+        Parent->addChildLoop(Peeled);
+      } else {
+        LI.addTopLevelLoop(Peeled);
+      }
+      for(BasicBlock* Copy : Blocks) Peeled->addBasicBlockToLoop(Copy, LI);
+      Peeled->moveToHeader(cast<BasicBlock>(VMap[Header]));
+      addStringMetadataToLoop(Peeled, NoFusionMD, 1);
+
+      assert(DT.verify(DominatorTree::VerificationLevel::Fast) && "DT non valido dopo il peeling");
+      assert(PDT.verify(PostDominatorTree::VerificationLevel::Fast) && "PDT non valido dopo il peeling");
+      outs() << "Peeling completato: limite " << *Limit << "\n";
+    }
+
+    /**
+     * Riscrive le ricorrenze di un loop come ricorrenze di un altro loop.
+     * Applicata agli indirizzi di L1 li esprime in funzione delle iterazioni
+     * di L2: è l'indirizzo che il loop fuso userebbe alla stessa iterazione
+     */
+    class AddRecLoopReplacer : public SCEVRewriteVisitor<AddRecLoopReplacer> {
+    public:
+      AddRecLoopReplacer(ScalarEvolution &SE, const Loop &OldL, const Loop &NewL)
+          : SCEVRewriteVisitor(SE), OldL(OldL), NewL(NewL) {}
+
+      bool Valid = true;
+
+      const SCEV* visitAddRecExpr(const SCEVAddRecExpr* Expr) {
+        SmallVector<const SCEV*, 2> Operands;
+        for(const SCEV* Op : Expr->operands()) {
+          const SCEV* NewOp = visit(Op);
+          // start e step devono essere già disponibili all'ingresso di L2
+          if(!SE.isLoopInvariant(NewOp, &NewL) || !SE.properlyDominates(NewOp, NewL.getHeader())) {
+            Valid = false;
+            return Expr;
+          }
+          Operands.push_back(NewOp);
+        }
+        if(Expr->getLoop() == &OldL) return SE.getAddRecExpr(Operands, &NewL, SCEV::FlagAnyWrap);
+        // Le ricorrenze dei sotto-loop di L1 non hanno un corrispondente in L2
+        if(OldL.contains(Expr->getLoop())) Valid = false;
+        return Expr;
+      }
+
+      const SCEV* visitUnknown(const SCEVUnknown* Expr) {
+        // Un valore calcolato dentro L1 cambia a ogni iterazione in modo ignoto
+        if(Instruction* I = dyn_cast<Instruction>(Expr->getValue())) {
+          if(OldL.contains(I)) Valid = false;
+        }
+        return Expr;
+      }
+
+    private:
+      const Loop &OldL;
+      const Loop &NewL;
+    };
+
+    /**
+     * Dopo la fusione l'iterazione k di L2 viene eseguita prima delle
+     * iterazioni k+1, k+2, ... di L1. La fusione è valida se la locazione
+     * acceduta da B (in L2) all'iterazione k viene acceduta da A (in L1)
+     * solo in iterazioni k' <= k. Gli accessi coprono [A(k), A(k) + |A|)
+     * e [B(k), B(k) + |B|): se l'indirizzo di A cresce di Step a ogni
+     * iterazione B non deve arrivare ad A(k + 1), cioè
+     * A(k) - B(k) + Step - |B| >= 0, se decresce A(k + 1) + |A| non deve
+     * superare B(k), cioè A(k) - B(k) + Step + |A| <= 0. Un indirizzo di A
+     * invariante viene toccato a ogni iterazione di L1 e la fusione non è
+     * mai valida
+     */
+    bool isFusionPreventing(Loop* L1, Loop* L2, Instruction* A, Instruction* B, ScalarEvolution* SE) {
+      const SCEV* PtrA = SE->getSCEV(getLoadStorePointerOperand(A));
+      const SCEV* PtrB = SE->getSCEV(getLoadStorePointerOperand(B));
+
+      AddRecLoopReplacer Rewriter(*SE, *L1, *L2);
+      PtrA = Rewriter.visit(PtrA);
+      outs() << "Indirizzo in L1 riscritto su L2: " << *PtrA << "\n";
+      outs() << "Indirizzo in L2: " << *PtrB << "\n";
+      if(!Rewriter.Valid) return true;
+
+      const SCEVAddRecExpr* RecA = dyn_cast<SCEVAddRecExpr>(PtrA);
+      if(!RecA || RecA->getLoop() != L2 || !RecA->isAffine()) return true;
+      // Con puntatori a oggetti diversi la differenza non è calcolabile
+      const SCEV* Diff = SE->getMinusSCEV(PtrA, PtrB);
+      if(isa<SCEVCouldNotCompute>(Diff)) return true;
+      outs() << "Differenza tra gli indirizzi: " << *Diff << "\n";
+      const SCEV* Step = RecA->getStepRecurrence(*SE);
+      const DataLayout &DL = A->getModule()->getDataLayout();
+      const SCEV* SizeA = SE->getConstant(Diff->getType(), DL.getTypeStoreSize(getLoadStoreType(A)));
+      const SCEV* SizeB = SE->getConstant(Diff->getType(), DL.getTypeStoreSize(getLoadStoreType(B)));
+      const SCEV* Next = SE->getAddExpr(Diff, Step);
+      if(SE->isKnownPositive(Step))
+        return !SE->isKnownNonNegative(SE->getMinusSCEV(Next, SizeB));
+      if(SE->isKnownNegative(Step))
+        return !SE->isKnownNonPositive(SE->getAddExpr(Next, SizeA));
+      return true;
+    }
+
+    /**
+     * Forma dei loop non ruotati che fuseLoops sa trasformare: si esce solo
+     * dall'header, con un branch condizionale che ha un solo successore nel
+     * loop (il primo blocco del corpo, raggiunto solo dall'header), e il
+     * latch ha un solo predecessore, che ci salta con un branch non
+     * condizionale. Un continue nel corpo, ad esempio, dà al latch due
+     * predecessori
+     */
+    bool hasFusableShape(Loop* L) {
+      BasicBlock* Header = L->getHeader();
+      BasicBlock* Latch = L->getLoopLatch();
+      BranchInst* HeaderBr = dyn_cast<BranchInst>(Header->getTerminator());
+      if(!Latch || Latch == Header || L->getExitingBlock() != Header) return false;
+      if(!HeaderBr || !HeaderBr->isConditional()) return false;
+      bool InLoop0 = L->contains(HeaderBr->getSuccessor(0));
+      if(InLoop0 == L->contains(HeaderBr->getSuccessor(1))) return false;
+      BasicBlock* BodyFirst = HeaderBr->getSuccessor(InLoop0 ? 0 : 1);
+      if(BodyFirst->getSinglePredecessor() != Header) return false;
+
+      BasicBlock* BodyLast = Latch->getSinglePredecessor();
+      if(!BodyLast || BodyLast == Header) return false;
+      BranchInst* BodyBr = dyn_cast<BranchInst>(BodyLast->getTerminator());
+      return BodyBr && BodyBr->isUnconditional();
+    }
+
+    /**
+     * fuseLoops elimina preheader, header e latch di L2, quindi il loro
+     * contenuto deve poter passare in L1:
+     * - le phi dell'header che sono ricorrenze affini {start,+,passo}
+     *   riscrivibili su L1 diventano valori di L1 (unifyInductionVariables),
+     *   le altre (riduzioni, ricorrenze non affini) passano nell'header di L1
+     *   e il loro valore iniziale non può venire da L1
+     * - le altre istruzioni dell'header vanno all'inizio del corpo: non devono
+     *   avere effetti collaterali (non vengono più eseguite all'ultimo
+     *   controllo) né usi fuori da L2
+     * - il preheader viene anticipato a quello di L1: solo istruzioni
+     *   eseguibili in modo speculativo che non accedono alla memoria (L1
+     *   potrebbe scriverla) e non usano valori di L1
+     */
+    bool canMergeLoopBlocks(Loop* L1, Loop* L2, ScalarEvolution &SE) {
+      BasicBlock* PreHead2 = L2->getLoopPreheader();
+      BasicBlock* Header2 = L2->getHeader();
+      if(!PreHead2 || !L1->getLoopPreheader()) return false;
+      if(!hasFusableShape(L1) || !hasFusableShape(L2)) {
+        outs() << "Forma dei loop non gestita dalla fusione\n";
+        return false;
+      }
+
+      AddRecLoopReplacer Rewriter(SE, *L2, *L1);
+      for(PHINode &PN : Header2->phis()) {
+        const SCEVAddRecExpr* Rec = nullptr;
+        if(SE.isSCEVable(PN.getType())) Rec = dyn_cast<SCEVAddRecExpr>(SE.getSCEV(&PN));
+        if(Rec && Rec->getLoop() == L2 && Rec->isAffine()) {
+          Rewriter.visit(Rec);
+          if(Rewriter.Valid) continue;
+          Rewriter.Valid = true;
+        }
+        Instruction* Start = dyn_cast<Instruction>(PN.getIncomingValueForBlock(PreHead2));
+        if(Start && L1->contains(Start)) {
+          outs() << "Phi di L2 che parte da un valore di L1:" << PN << "\n";
+          return false;
+        }
+      }
+      for(Instruction &I : *Header2) {
+        if(isa<PHINode>(I) || I.isTerminator()) continue;
+        if(I.mayHaveSideEffects() || any_of(I.users(), [&](User* U) { return !L2->contains(cast<Instruction>(U)); })) {
+          outs() << "Istruzione dell'header di L2 non spostabile:" << I << "\n";
+          return false;
+        }
+      }
+      for(Instruction &I : *PreHead2) {
+        if(I.isTerminator() || (isa<PHINode>(I) && I.use_empty())) continue;
+        bool UsesL1 = any_of(I.operands(), [&](Value* Op) {
+          Instruction* OpI = dyn_cast<Instruction>(Op);
+          return OpI && L1->contains(OpI);
+        });
+        if(isa<PHINode>(I) || UsesL1 || I.mayReadOrWriteMemory() || !isSafeToSpeculativelyExecute(&I)) {
+          outs() << "Istruzione tra i loop non spostabile:" << I << "\n";
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Sostituisce le induction variable di L2 con il loro valore alla
+     * stessa iterazione di L1: la phi di L1 con la stessa ricorrenza se
+     * c'è, altrimenti (se Expand) la ricorrenza riscritta su L1 e generata
+     * da SCEVExpander all'inizio dell'header di L1. Le phi sostituite
+     * restano nell'header di L2 senza usi
+     */
+    void unifyInductionVariables(Loop* L1, Loop* L2, ScalarEvolution &SE, bool Expand) {
+      BasicBlock* Header1 = L1->getHeader();
+      AddRecLoopReplacer Rewriter(SE, *L2, *L1);
+      SCEVExpander Expander(SE, Header1->getModule()->getDataLayout(), "fusion");
+      for(PHINode &PN2 : L2->getHeader()->phis()) {
+        if(!SE.isSCEVable(PN2.getType())) continue;
+        const SCEV* Rec = Rewriter.visit(SE.getSCEV(&PN2));
+        if(!Rewriter.Valid) {
+          Rewriter.Valid = true;
+          continue;
+        }
+        Value* V = nullptr;
+        for(PHINode &PN1 : Header1->phis()) {
+          if(PN1.getType() == PN2.getType() && SE.getSCEV(&PN1) == Rec) {
+            V = &PN1;
+            break;
+          }
+        }
+        if(!V && Expand) V = Expander.expandCodeFor(Rec, PN2.getType(), &*Header1->getFirstInsertionPt());
+        if(!V) continue;
+        outs() << "Induction variable di L2 sostituita:" << PN2 << " ->" << *V << "\n";
+        PN2.replaceAllUsesWith(V);
+      }
+    }
+
+    /**
+     * CONDIZIONE 4: ANALISI DELLE DIPENDENZE
+     * Per ogni coppia di accessi in memoria, uno in L1 e uno in L2, di cui
+     * almeno uno scrive (RAW, WAR e WAW), DependenceInfo dice se possono
+     * toccare la stessa locazione. Lavorando sugli indirizzi e non sulle GEP
+     * gestisce array multidimensionali e aritmetica dei puntatori, e usa
+     * l'AliasAnalysis per separare oggetti diversi. Le chiamate che accedono
+     * alla memoria danno una dipendenza "confused" e bloccano la fusione
+     */
+    bool hasDependence(Loop* L1, Loop* L2, DependenceInfo &DI, ScalarEvolution* SE) {
+      SmallVector<Instruction*, 8> Accesses1, Accesses2;
+      collectMemoryAccesses(L1, Accesses1);
+      collectMemoryAccesses(L2, Accesses2);
+
+      for(Instruction* A : Accesses1) {
+        for(Instruction* B : Accesses2) {
+          if(!A->mayWriteToMemory() && !B->mayWriteToMemory()) continue;
+
+          std::unique_ptr<Dependence> Dep = DI.depends(A, B, true);
+          if(!Dep) continue;
+
+          outs() << "Dipendenza tra:\n" << *A << "\n" << *B << "\n";
+          if(Dep->isConfused()) {
+            outs() << "Dipendenza non analizzabile\n";
+            return true;
+          }
+
+          // I livelli comuni sono i loop che contengono sia L1 che L2. Una
+          // dipendenza tra iterazioni diverse di uno di questi loop non
+          // cambia con la fusione: conta solo quella con direzione '=' su
+          // tutti i livelli comuni
+          bool SameIteration = true;
+          for(unsigned Level = 1; Level <= Dep->getLevels(); Level++) {
+            if(!(Dep->getDirection(Level) & Dependence::DVEntry::EQ)) SameIteration = false;
+          }
+          if(!SameIteration) continue;
+
+          if(isFusionPreventing(L1, L2, A, B, SE)) {
+            outs() << "La dipendenza impedisce la fusione\n";
+            return true;
+          }
+        }
+      }
+      return false; // Nessuna dipendenza che impedisce la fusione
     }
 
     /**
      * FUSIONE DEI LOOP
      * Implementa la trasformazione vera e propria unendo i due loop
-     * Modifica il CFG per creare un singolo loop che esegue entrambi i corpi
+     * Modifica il CFG per creare un singolo loop che esegue entrambi i corpi,
+     * elimina preheader, header e latch di L2 e aggiorna DT, PDT, LoopInfo e
+     * ScalarEvolution senza ricalcolarli
      */
-    void fuseLoops(Loop* L1, Loop* L2) {
+    bool fuseLoops(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                   LoopInfo &LI, ScalarEvolution &SE) {
       
       // STEP 1: UNIFICAZIONE DELLE INDUCTION VARIABLES
       // Ogni loop ha una variabile di controllo (induction variable)
-      // Sostituisco tutte le occorrenze di IV2 con IV1 per usare un solo contatore
-      PHINode* IV1 = L1->getCanonicalInductionVariable();
-      if(!IV1) return;
-      PHINode* IV2 = L2->getCanonicalInductionVariable();
-      if(!IV2) return;
-      IV2->replaceAllUsesWith(IV1); // LLVM API per sostituire tutti gli usi
+      // Le IV di L2 vengono calcolate da quelle di L1 per usare un solo
+      // contatore (canMergeLoopBlocks ha già controllato che si possa)
+      unifyInductionVariables(L1, L2, SE, true);
+
+      // SCEV ha in cache le espressioni dei due loop (trip count, AddRec):
+      // le invalidiamo prima di toccare IR e LoopInfo
+      SE.forgetLoop(L2);
+      SE.forgetLoop(L1);
 
       // STEP 2: IDENTIFICAZIONE DEI BLOCCHI CHIAVE
       // Mappo i componenti strutturali di entrambi i loop
       
       // Componenti del primo loop:
-      BasicBlock* Exit1 = L1->getExitBlock();        // Blocco di uscita
+      BasicBlock* PreHead1 = L1->getLoopPreheader(); // Blocco prima dell'header
       BasicBlock* Header1 = L1->getHeader();         // Blocco di ingresso/controllo
       BasicBlock* Latch1 = L1->getLoopLatch();       // Blocco che chiude il loop
       BasicBlock* BodyLast1 = Latch1->getSinglePredecessor(); // Ultimo blocco del corpo
@@ -298,19 +1014,67 @@ namespace
       
       // IDENTIFICAZIONE DEL PRIMO BLOCCO DEL CORPO DI L2:
       // Itero sui successori dell'header del secondo loop
-      // Il successore che non è l'uscita è il primo blocco del corpo
-      BasicBlock* BodyFirst2;
+      // Il successore nel loop è il primo blocco del corpo (hasFusableShape
+      // garantisce che sia uno solo)
+      BasicBlock* BodyFirst2 = nullptr;
       for(auto succ = succ_begin(Header2); succ != succ_end(Header2); succ++) {
         BasicBlock* succBB = *succ;
-        if(succBB != Exit2) {
+        if(L2->contains(succBB)) {
           BodyFirst2 = succBB; // Primo blocco del corpo di L2
         }
       }
 
-      
+      // STEP 3: SPOSTAMENTO DEL CONTENUTO DI L2
+      // Preheader, header e latch di L2 verranno eliminati: quello che serve
+      // ancora passa nei blocchi corrispondenti di L1
+      SmallVector<WeakTrackingVH, 8> MaybeDead;
+      auto AddMaybeDead = [&](Value* V) {
+        if(isa<Instruction>(V)) MaybeDead.push_back(V);
+      };
+      AddMaybeDead(cast<BranchInst>(Header2->getTerminator())->getCondition());
+
+      // Le phi rimaste (riduzioni e ricorrenze non affini) passano
+      // nell'header di L1, quelle sostituite da unifyInductionVariables no
+      while(PHINode* PN = dyn_cast<PHINode>(&Header2->front())) {
+        if(PN->use_empty()) {
+          for(Value* Op : PN->incoming_values()) AddMaybeDead(Op);
+          PN->eraseFromParent();
+          continue;
+        }
+        outs() << "Phi di L2 spostata nell'header di L1:" << *PN << "\n";
+        PN->replaceIncomingBlockWith(PreHead2, PreHead1);
+        PN->replaceIncomingBlockWith(Latch2, Latch1);
+        PN->moveBefore(Header1->getFirstNonPHI());
+      }
+      // Il resto dell'header viene eseguito dopo il corpo di L1, prima di
+      // quello di L2: va all'inizio del corpo di L2. Il latch segue il latch
+      // di L1 e il preheader viene anticipato a quello di L1
+      auto MoveBefore = [](BasicBlock* From, Instruction* InsertPt) {
+        SmallVector<Instruction*, 8> ToMove;
+        for(Instruction &I : *From) {
+          if(!isa<PHINode>(I) && !I.isTerminator()) ToMove.push_back(&I);
+        }
+        for(Instruction* I : ToMove) I->moveBefore(InsertPt);
+      };
+      MoveBefore(Header2, &*BodyFirst2->getFirstInsertionPt());
+      MoveBefore(Latch2, Latch1->getTerminator());
+      MoveBefore(PreHead2, PreHead1->getTerminator());
+
+      // Salvo i successori dei blocchi che verranno modificati: confrontandoli
+      // con quelli finali ottengo gli archi da comunicare a DT e PDT
+      SmallSetVector<BasicBlock*, 4> Rewired;
+      Rewired.insert(Header1);
+      Rewired.insert(BodyLast1);
+      Rewired.insert(BodyLast2);
+      Rewired.insert(Header2);
+      SmallVector<SmallPtrSet<BasicBlock*, 2>, 4> OldSuccs;
+      for(auto* BB : Rewired) {
+        OldSuccs.emplace_back(succ_begin(BB), succ_end(BB));
+      }
+
       outs() << "Inizio modifica dei branch per la fusione dei loop\n";
 
-      // STEP 3: MODIFICA DEI BRANCH - RICONNESSIONE DEL CFG
+      // STEP 4: MODIFICA DEI BRANCH - RICONNESSIONE DEL CFG
       
       // MODIFICA 1: Header del primo loop
       // L'header di L1 ora deve uscire direttamente quando la condizione è falsa
@@ -333,6 +1097,8 @@ namespace
           outs() << "-----------------------------------------" << "\n\n";
           brHeader1->setSuccessor(1, Exit2);
         }
+        // Le phi di Exit2 (create dal versioning) ora ricevono l'arco da Header1
+        Exit2->replacePhiUsesWith(Header2, Header1);
       }
 
       // MODIFICA 2: Ultimo blocco del corpo di L1
@@ -366,8 +1132,8 @@ namespace
       }
 
       // MODIFICA 4: Header del secondo loop (ora inutilizzato)
-      // L'header di L2 non sarà più raggiunto, ma per correttezza del CFG
-      // impostiamo tutti i suoi successori al suo latch
+      // L'header di L2 non sarà più raggiunto: puntando solo al suo latch
+      // i blocchi da eliminare non hanno archi verso il resto della funzione
       BranchInst* brHeader2 = dyn_cast<BranchInst>(Header2->getTerminator());
       outs() << "Analizzo terminatore di Header1 (per Header2): " << Header2->getName() << "\n";
       outs() << "-----------------------------------------" << "\n\n";
@@ -380,39 +1146,207 @@ namespace
 
       outs() << "Modifica dei branch completata\n";
       outs() << "-----------------------------------------" << "\n\n";
-      return;
+
+      // STEP 5: AGGIORNAMENTO INCREMENTALE DI DT E PDT
+      // Comunico solo gli archi inseriti e rimossi invece di ricostruire gli alberi
+      DomTreeUpdater DTU(DT, PDT, DomTreeUpdater::UpdateStrategy::Lazy);
+      applyEdgeUpdates(Rewired.getArrayRef(), OldSuccs, DTU);
+
+      // STEP 6: ELIMINAZIONE DEI BLOCCHI DI L2 E AGGIORNAMENTO DI LOOPINFO
+      // PreHead2, Header2 e Latch2 non sono più raggiungibili: li tolgo da
+      // LoopInfo e dalla funzione, insieme ai valori che usavano solo loro
+      // (condizione di uscita e incremento della IV di L2)
+      SmallVector<BasicBlock*, 3> Dead = {PreHead2, Header2, Latch2};
+      for(BasicBlock* BB : Dead) LI.removeBlock(BB);
+      DeleteDeadBlocks(Dead, &DTU);
+      RecursivelyDeleteTriviallyDeadInstructionsPermissive(MaybeDead);
+      mergeLoopInfo(L1, L2, LI);
+
+      // Il corpo di L1 ora prosegue solo nel corpo di L2: li uniamo. Il
+      // latch resta un blocco a parte, come in ogni loop che fuseLoops tratta
+      MergeBlockIntoPredecessor(BodyFirst2, &DTU, &LI);
+      DTU.flush();
+
+      assert(DT.verify(DominatorTree::VerificationLevel::Fast) && "DT non valido dopo la fusione");
+      assert(PDT.verify(PostDominatorTree::VerificationLevel::Fast) && "PDT non valido dopo la fusione");
+      return true;
     }
 
-    bool isLoopFusionPossible(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT, ScalarEvolution &SE) {
-      // STEP 3: PIPELINE DI CONTROLLI PER LA FUSIONE SICURA
-      
-      outs() << "-----------------------------------------" << "\n";
-      outs() << "|     INIZIO CONTROLLO DI ADIACENZA     |" << "\n";
-      outs() << "-----------------------------------------" << "\n";
-      
-      // Test 1: I loop devono essere fisicamente adiacenti nel CFG
-      if(areAdjacent(L1, L2)) {
-        outs() << "I loop sono adiacenti\n \n";
-        outs() << "-----------------------------------------" << "\n";
-        outs() << "| INIZIO CONTROLLO DI CFG EQUIVALENZA   |" << "\n";
-        outs() << "-----------------------------------------" << "\n";
+    /**
+     * Confronta i successori attuali dei blocchi modificati con quelli
+     * salvati prima della modifica e comunica a DTU gli archi inseriti e
+     * rimossi
+     */
+    void applyEdgeUpdates(ArrayRef<BasicBlock*> Rewired,
+                          ArrayRef<SmallPtrSet<BasicBlock*, 2>> OldSuccs, DomTreeUpdater &DTU) {
+      SmallVector<DominatorTree::UpdateType, 8> Updates;
+      for(unsigned i = 0; i < Rewired.size(); i++) {
+        BasicBlock* BB = Rewired[i];
+        SmallPtrSet<BasicBlock*, 2> NewSuccs(succ_begin(BB), succ_end(BB));
+        for(auto* Succ : OldSuccs[i]) {
+          if(!NewSuccs.count(Succ)) Updates.push_back({DominatorTree::Delete, BB, Succ});
+        }
+        for(auto* Succ : NewSuccs) {
+          if(!OldSuccs[i].count(Succ)) Updates.push_back({DominatorTree::Insert, BB, Succ});
+        }
+      }
+      DTU.applyUpdates(Updates);
+    }
 
-        // Test 2: I loop devono avere struttura di controllo equivalente
-        if(areCFGEquivalent(L1,L2, DT, PDT)) {
-          outs() << "I loop sono CFG equivalenti\n\n";
-          outs() << "---------------------------------------------" << "\n";
-          outs() << "| INIZIO CONTROLLO SUL NUMERO DI ITERAZIONI |" << "\n";
-          outs() << "---------------------------------------------" << "\n";
-          
-          // Test 3: Stesso numero di iterazioni per preservare la semantica
-          if(sameIterationNumber(L1,L2,&SE)){
-            outs() << "I loop hanno lo stesso numero di iterazioni\n\n";
+    /**
+     * I blocchi rimasti in L2 (compresi quelli dei sotto-loop) e i suoi
+     * sotto-loop passano a L1, poi L2 viene eliminato da LoopInfo
+     */
+    void mergeLoopInfo(Loop* L1, Loop* L2, LoopInfo &LI) {
+      SmallVector<BasicBlock*, 8> Blocks(L2->blocks());
+      for(auto* BB : Blocks) {
+        L1->addBlockEntry(BB);
+        L2->removeBlockFromLoop(BB);
+        if(LI.getLoopFor(BB) == L2) LI.changeLoopFor(BB, L1);
+      }
+      // I sotto-loop di L2 diventano figli di L1
+      while(!L2->isInnermost()) {
+        auto Child = L2->begin();
+        Loop* ChildLoop = *Child;
+        L2->removeChildLoop(Child);
+        L1->addChildLoop(ChildLoop);
+      }
+      // L2 ora è vuoto e può essere eliminato
+      LI.erase(L2);
+    }
+
+    /**
+     * FUSIONE DI LOOP RUOTATI
+     * I due corpi, header compreso, vengono eseguiti uno dopo l'altro: il
+     * latch di L1 salta all'header di L2 e il latch di L2, che decide
+     * l'uscita, torna all'header di L1. Le phi di L2 passano nell'header
+     * di L1; quelle che descrivono la stessa ricorrenza di una phi di L1
+     * (le induction variable) vengono sostituite da quest'ultima.
+     * Con le guardie, la guardia di L1 protegge il loop fuso e salta
+     * direttamente dove saltava quella di L2. I blocchi tra i due loop
+     * (uscita di L1, guardia e preheader di L2) vengono eliminati e l'header
+     * di L2 viene unito al latch di L1
+     */
+    bool fuseRotatedLoops(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                          LoopInfo &LI, ScalarEvolution &SE) {
+      BasicBlock* PreHead1 = L1->getLoopPreheader();
+      BasicBlock* Header1 = L1->getHeader();
+      BasicBlock* Latch1 = L1->getLoopLatch();
+      BasicBlock* Exit1 = L1->getExitBlock();
+      BasicBlock* PreHead2 = L2->getLoopPreheader();
+      BasicBlock* Header2 = L2->getHeader();
+      BasicBlock* Latch2 = L2->getLoopLatch();
+      BranchInst* Guard1 = L1->getLoopGuardBranch();
+      BranchInst* Guard2 = L2->getLoopGuardBranch();
+
+      // Induction variable di L2 uguali a una di L1: stesso start e stesso passo
+      unifyInductionVariables(L1, L2, SE, false);
+
+      SE.forgetLoop(L2);
+      SE.forgetLoop(L1);
+
+      // Blocchi tra i due loop: dall'uscita di L1 al preheader di L2
+      SmallVector<BasicBlock*, 4> Dead;
+      BasicBlock* GuardBB2 = Guard2 ? Guard2->getParent() : nullptr;
+      for(BasicBlock* BB = Exit1; BB != PreHead2; BB = BB == GuardBB2 ? PreHead2 : BB->getSingleSuccessor()) {
+        Dead.push_back(BB);
+      }
+      Dead.push_back(PreHead2);
+
+      // Successori dei blocchi che verranno modificati, per comunicare a DT
+      // e PDT solo gli archi cambiati, come in fuseLoops
+      SmallSetVector<BasicBlock*, 4> Rewired;
+      if(Guard1) Rewired.insert(Guard1->getParent());
+      Rewired.insert(Latch1);
+      Rewired.insert(Latch2);
+      SmallVector<SmallPtrSet<BasicBlock*, 2>, 4> OldSuccs;
+      for(auto* BB : Rewired) {
+        OldSuccs.emplace_back(succ_begin(BB), succ_end(BB));
+      }
+
+      // La guardia di L1, se falsa, salta oltre L2
+      if(Guard1) {
+        BasicBlock* Skip2 = Guard2->getSuccessor(0) == PreHead2 ? Guard2->getSuccessor(1) : Guard2->getSuccessor(0);
+        for(PHINode &PN : Skip2->phis()) {
+          PN.addIncoming(PN.getIncomingValueForBlock(GuardBB2), Guard1->getParent());
+        }
+        Guard1->replaceUsesOfWith(GuardBB2, Skip2);
+      }
+
+      // Le phi rimaste in L2 partono dal preheader di L1; l'arco all'indietro
+      // arriva ora dal latch di L2
+      for(PHINode &PN : Header1->phis()) PN.replaceIncomingBlockWith(Latch1, Latch2);
+      while(PHINode* PN = dyn_cast<PHINode>(&Header2->front())) {
+        if(PN->use_empty()) {
+          PN->eraseFromParent();
+          continue;
+        }
+        PN->replaceIncomingBlockWith(PreHead2, PreHead1);
+        PN->moveBefore(Header1->getFirstNonPHI());
+      }
+
+      // Il latch di L1 prosegue nel corpo di L2: la sua condizione di uscita
+      // non serve più, il loop fuso esce dal latch di L2
+      BranchInst* Br1 = cast<BranchInst>(Latch1->getTerminator());
+      Value* Cond1 = Br1->getCondition();
+      BranchInst::Create(Header2, Latch1);
+      Br1->eraseFromParent();
+      RecursivelyDeleteTriviallyDeadInstructions(Cond1);
+      Latch2->getTerminator()->replaceUsesOfWith(Header2, Header1);
+
+      DomTreeUpdater DTU(DT, PDT, DomTreeUpdater::UpdateStrategy::Lazy);
+      applyEdgeUpdates(Rewired.getArrayRef(), OldSuccs, DTU);
+
+      for(BasicBlock* BB : Dead) LI.removeBlock(BB);
+      DeleteDeadBlocks(Dead, &DTU);
+      mergeLoopInfo(L1, L2, LI);
+      // L'header di L2 ora ha come unico predecessore il latch di L1
+      MergeBlockIntoPredecessor(Header2, &DTU, &LI);
+      DTU.flush();
+
+      assert(DT.verify(DominatorTree::VerificationLevel::Fast) && "DT non valido dopo la fusione");
+      assert(PDT.verify(PostDominatorTree::VerificationLevel::Fast) && "PDT non valido dopo la fusione");
+      return true;
+    }
+
+    bool isLoopFusionPossible(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                              ScalarEvolution &SE, DependenceInfo &DI, AAResults &AA, TripCountFix &Fix) {
+      // STEP 3: PIPELINE DI CONTROLLI PER LA FUSIONE SICURA
+
+      // Le copie create dal versioning servono proprio quando la fusione non è valida
+      if(getBooleanLoopAttribute(L1, NoFusionMD) || getBooleanLoopAttribute(L2, NoFusionMD)) {
+        return false;
+      }
+      // fuseLoops elimina preheader, header e latch di L2
+      if(!L1->isRotatedForm() && !canMergeLoopBlocks(L1, L2, SE)) return false;
+      
+      outs() << "-----------------------------------------" << "\n";
+      outs() << "|     INIZIO CONTROLLO DI ADIACENZA     |" << "\n";
+      outs() << "-----------------------------------------" << "\n";
+      
+      // Test 1: I loop devono essere fisicamente adiacenti nel CFG
+      if(areAdjacent(L1, L2, DT)) {
+        outs() << "I loop sono adiacenti\n \n";
+        outs() << "-----------------------------------------" << "\n";
+        outs() << "| INIZIO CONTROLLO DI CFG EQUIVALENZA   |" << "\n";
+        outs() << "-----------------------------------------" << "\n";
+
+        // Test 2: I loop devono avere struttura di controllo equivalente
+        if(areCFGEquivalent(L1, L2, DT, PDT, SE, AA)) {
+          outs() << "I loop sono CFG equivalenti\n\n";
+          outs() << "---------------------------------------------" << "\n";
+          outs() << "| INIZIO CONTROLLO SUL NUMERO DI ITERAZIONI |" << "\n";
+          outs() << "---------------------------------------------" << "\n";
+          
+          // Test 3: Stesso numero di iterazioni per preservare la semantica
+          if(sameIterationNumber(L1,L2,&SE,Fix)){
+            outs() << "I loop hanno lo stesso numero di iterazioni\n\n";
             outs() << "---------------------------------------------------------" << "\n";
             outs() << "| INIZIO CONTROLLO SULLE DIPENDENZE A DISTANZA NEGATIVA |" << "\n";
             outs() << "---------------------------------------------------------" << "\n";
             
             // Test 4: Assenza di dipendenze che violerebbero l'ordine di esecuzione
-            if(hasDependence(L1, L2, &SE)) {
+            if(hasDependence(L1, L2, DI, &SE)) {
               outs() << "I loop hanno dipendenze negative\n\n";
               return false;
               // Dipendenze negative = risultato diverso dopo la fusione
@@ -439,35 +1373,237 @@ namespace
 
     }
 
-    bool visitLoops(std::vector<Loop*> Loops, DominatorTree &DT, PostDominatorTree &PDT, ScalarEvolution &SE) {
-      outs() << "| ----------------------------------------- |" << "\n";
-      for (int i = 0; i < Loops.size(); i++)
-      {
-        for (int j = 0; j < Loops.size(); j++)
-        {
-          if(i!=j) {
-            if(isLoopFusionPossible(Loops[i],Loops[j],DT,PDT,SE)) {
-              // STEP 4: ESECUZIONE DELLA TRASFORMAZIONE
-              outs() << "-----------------------------------------" << "\n";
-              outs() << "|       INIZIO FUSIONE DEI LOOP         |" << "\n";
-              outs() << "-----------------------------------------" << "\n\n";
-
-              // In questa implementazione dimostrativa, eseguiamo sempre la fusione
-              // Un'implementazione di produzione dovrebbe fondere solo se tutti i test passano
-              fuseLoops(Loops[i],Loops[j]);
-              outs() << "-----------------------------------------" << "\n";
-              outs() << "|           FUSIONE COMPLETATA           |\n";
-              outs() << "-----------------------------------------" << "\n";
-              return true;
+    /**
+     * Dati usati dal modello di profittabilità: vengono riportati anche
+     * nei remark, qualunque sia la decisione
+     */
+    struct FusionProfit {
+      unsigned SharedStreams = 0; // Oggetti acceduti da entrambi i loop
+      unsigned Streams = 0;       // Oggetti acceduti in totale
+      unsigned LiveValues = 0;    // Stima dei valori vivi nel loop fuso
+      unsigned Registers = 0;     // Registri disponibili secondo TTI
+    };
+
+    /**
+     * Stima i valori vivi nel corpo del loop: i valori definiti fuori dal
+     * loop e usati dentro (vivi per tutto il loop), le phi dell'header
+     * (portate da un'iterazione all'altra) e i valori usati in un blocco
+     * diverso da quello che li definisce
+     */
+    void collectLiveValues(Loop* L, SmallPtrSetImpl<Value*> &Invariants,
+                           unsigned &Carried, unsigned &Temporaries) {
+      Carried += std::distance(L->getHeader()->phis().begin(), L->getHeader()->phis().end());
+      for(BasicBlock* BB : L->blocks()) {
+        for(Instruction &I : *BB) {
+          for(Value* Op : I.operands()) {
+            Instruction* OpI = dyn_cast<Instruction>(Op);
+            if((OpI && !L->contains(OpI)) || isa<Argument>(Op)) Invariants.insert(Op);
+          }
+          if(isa<PHINode>(I) && BB == L->getHeader()) continue;
+          for(User* U : I.users()) {
+            if(cast<Instruction>(U)->getParent() != BB) {
+              Temporaries++;
+              break;
             }
           }
         }
-        std::vector<Loop*> subLoops = Loops[i]->getSubLoopsVector();
-        if(subLoops.size() > 1) {
-          visitLoops(subLoops, DT, PDT, SE);
+      }
+    }
+
+    /**
+     * MODELLO DI PROFITTABILITÀ
+     * La fusione conviene quando i due corpi leggono o scrivono gli stessi
+     * oggetti: i dati portati in cache dal primo vengono riusati dal
+     * secondo alla stessa iterazione. Senza oggetti in comune non c'è
+     * riuso e i loop restano separati. Anche con riuso la fusione ha un
+     * costo se i valori vivi nel loop fuso non entrano nei registri (spill
+     * a ogni iterazione) o se i due loop accedono a troppi oggetti, che si
+     * contendono le linee della cache. Le costanti dei limiti vengono da TTI e da
+     * -fusion-max-streams
+     */
+    bool isFusionProfitable(Loop* L1, Loop* L2, ScalarEvolution &SE, TargetTransformInfo &TTI,
+                            FusionProfit &Profit) {
+      SmallVector<Instruction*, 8> Accesses1, Accesses2;
+      collectMemoryAccesses(L1, Accesses1);
+      collectMemoryAccesses(L2, Accesses2);
+      SmallPtrSet<const SCEV*, 8> Streams1, Streams2;
+      collectStreams(Accesses1, SE, Streams1);
+      collectStreams(Accesses2, SE, Streams2);
+      countStreams(Streams1, Streams2, Profit.SharedStreams, Profit.Streams);
+
+      // I valori invarianti usati da entrambi i loop occupano un registro
+      // solo; delle due induction variable ne resta una. I temporanei del
+      // primo corpo sono morti quando inizia il secondo: conta il massimo
+      SmallPtrSet<Value*, 16> Invariants;
+      unsigned Carried = 0, Temporaries1 = 0, Temporaries2 = 0;
+      collectLiveValues(L1, Invariants, Carried, Temporaries1);
+      collectLiveValues(L2, Invariants, Carried, Temporaries2);
+      Profit.LiveValues = Invariants.size() + (Carried ? Carried - 1 : 0) + std::max(Temporaries1, Temporaries2);
+      Profit.Registers = TTI.getNumberOfRegisters(TTI.getRegisterClassForType(false));
+
+      outs() << "Flussi condivisi: " << Profit.SharedStreams << " su " << Profit.Streams
+             << ", valori vivi: " << Profit.LiveValues << ", registri: " << Profit.Registers << "\n";
+
+      // Senza oggetti in comune la fusione non porta riuso: resta solo il
+      // rischio di spill e di conflitti in cache
+      return Profit.SharedStreams > 0 && Profit.Streams <= FusionMaxStreams &&
+             Profit.LiveValues <= Profit.Registers;
+    }
+
+    /**
+     * Controlla una coppia di loop e, se possibile, li fonde. Restituisce
+     * true se L2 è stato fuso in L1 (e rimosso da LoopInfo)
+     */
+    bool tryFusion(Loop* L1, Loop* L2, DominatorTree &DT, PostDominatorTree &PDT,
+                   LoopInfo &LI, ScalarEvolution &SE, DependenceInfo &DI, AAResults &AA,
+                   TargetTransformInfo &TTI, OptimizationRemarkEmitter &ORE) {
+      TripCountFix Fix = NoFix;
+      if(!isLoopFusionPossible(L1,L2,DT,PDT,SE,DI,AA,Fix)) return false;
+
+      // La fusione è valida: decidiamo se conviene
+      FusionProfit Profit;
+      bool Profitable = isFusionProfitable(L1, L2, SE, TTI, Profit);
+      auto AddInputs = [&](auto R) {
+        return R << ore::NV("SharedStreams", Profit.SharedStreams) << " shared streams out of "
+                 << ore::NV("Streams", Profit.Streams) << ", "
+                 << ore::NV("LiveValues", Profit.LiveValues) << " live values, "
+                 << ore::NV("Registers", Profit.Registers) << " registers";
+      };
+      if(!Profitable) {
+        outs() << "La fusione non conviene\n\n";
+        ORE.emit([&]() {
+          return AddInputs(OptimizationRemarkMissed("loop-fusion1", "NotProfitable",
+                                                    L1->getStartLoc(), L1->getHeader())
+                           << "loops not fused: ");
+        });
+        return false;
+      }
+
+      // STEP 4: ESECUZIONE DELLA TRASFORMAZIONE
+      outs() << "-----------------------------------------" << "\n";
+      outs() << "|       INIZIO FUSIONE DEI LOOP         |" << "\n";
+      outs() << "-----------------------------------------" << "\n\n";
+
+      // Trip count uguali solo a runtime: la fusione avviene sulla
+      // versione protetta dal test
+      if(Fix == RuntimeCheck) versionLoops(L1, L2, DT, PDT, LI, SE);
+      // Trip count diversi: i loop vengono limitati al minimo delle
+      // iterazioni. Ogni copia va subito dopo L2, quindi stacchiamo
+      // prima L2: le iterazioni in più di L1 devono precedere quelle di L2
+      if(Fix & (PeelFirst | PeelSecond)) {
+        Type* Ty = SE.getWiderType(SE.getBackedgeTakenCount(L1)->getType(),
+                                   SE.getBackedgeTakenCount(L2)->getType());
+        const SCEV* Min = SE.getUMinExpr(getBackedgeTakenCount(L1, Ty, &SE),
+                                         getBackedgeTakenCount(L2, Ty, &SE));
+        BasicBlock* PreHead1 = L1->getLoopPreheader();
+        SCEVExpander Expander(SE, PreHead1->getModule()->getDataLayout(), "fusion");
+        Value* Limit = Expander.expandCodeFor(Min, Ty, PreHead1->getTerminator());
+        if(Fix & PeelSecond) peelLoop(L2, L2, Limit, DT, PDT, LI, SE);
+        if(Fix & PeelFirst) peelLoop(L1, L2, Limit, DT, PDT, LI, SE);
+      }
+
+      // La posizione va letta prima della fusione, che modifica gli header
+      DebugLoc Loc = L1->getStartLoc();
+      BasicBlock* Header = L1->getHeader();
+      bool Done = L1->isRotatedForm() ? fuseRotatedLoops(L1, L2, DT, PDT, LI, SE)
+                                      : fuseLoops(L1, L2, DT, PDT, LI, SE);
+      if(!Done) return false;
+      assert(!verifyFunction(*Header->getParent(), &errs()) && "IR non valido dopo la fusione");
+      ORE.emit([&]() {
+        return AddInputs(OptimizationRemark("loop-fusion1", "Fused", Loc, Header) << "loops fused: ");
+      });
+      outs() << "-----------------------------------------" << "\n";
+      outs() << "|           FUSIONE COMPLETATA           |\n";
+      outs() << "-----------------------------------------" << "\n";
+      return true;
+    }
+
+    /**
+     * Blocco da cui parte il controllo del loop: la guardia se c'è,
+     * altrimenti l'header. Sono i blocchi confrontati da areCFGEquivalent
+     */
+    BasicBlock* getEntryBlock(Loop* L) {
+      return L->isGuarded() ? L->getLoopGuardBranch()->getParent() : L->getHeader();
+    }
+
+    /**
+     * Raggruppa i loop di un livello del nido in classi di CFG equivalenza,
+     * come i FusionCandidateSet di LoopFuse: ogni loop finisce nella classe
+     * del primo loop con cui è CFG equivalente. Loop di classi diverse non
+     * possono essere fusi. I loop di una classe sono ordinati per dominanza,
+     * cioè in ordine di programma, e solo due loop consecutivi possono
+     * essere adiacenti
+     */
+    std::vector<FusionCandidateSet> collectFusionCandidates(const std::vector<Loop*> &Loops,
+                                                            DominatorTree &DT, PostDominatorTree &PDT,
+                                                            ScalarEvolution &SE, AAResults &AA) {
+      std::vector<FusionCandidateSet> Sets;
+      for(Loop* L : Loops) {
+        bool Inserted = false;
+        for(FusionCandidateSet &Set : Sets) {
+          if(areCFGEquivalent(Set.front(), L, DT, PDT, SE, AA) || areCFGEquivalent(L, Set.front(), DT, PDT, SE, AA)) {
+            Set.push_back(L);
+            Inserted = true;
+            break;
+          }
         }
+        if(!Inserted) Sets.push_back({L});
       }
-      return false;
+      // L'ordine dei fratelli in LoopInfo non è quello del programma
+      for(FusionCandidateSet &Set : Sets) {
+        std::stable_sort(Set.begin(), Set.end(), [&](Loop* A, Loop* B) {
+          return A != B && DT.dominates(getEntryBlock(A), getEntryBlock(B));
+        });
+      }
+      return Sets;
+    }
+
+    /**
+     * Fonde le catene di loop adiacenti tra quelli di Loops (fratelli nello
+     * stesso loop padre o top-level) e poi scende nei sotto-loop. I controlli
+     * vengono eseguiti solo su coppie vicine nella stessa classe di CFG
+     * equivalenza: con n loop sullo stesso livello i tentativi sono O(n)
+     * invece di O(n^2). Dopo ogni fusione il loop risultante viene provato
+     * con il successivo della classe, quindi una catena di N loop fondibili
+     * diventa un loop solo in una sola esecuzione del pass.
+     * DT, PDT, LoopInfo e SCEV vengono aggiornati da fuseLoops, senza
+     * ricalcolarli tra una fusione e l'altra
+     */
+    unsigned visitLoops(const std::vector<Loop*> &Loops, DominatorTree &DT, PostDominatorTree &PDT,
+                        LoopInfo &LI, ScalarEvolution &SE, DependenceInfo &DI, AAResults &AA,
+                        TargetTransformInfo &TTI, OptimizationRemarkEmitter &ORE) {
+      outs() << "| ----------------------------------------- |" << "\n";
+      unsigned NumFusions = 0;
+      std::vector<FusionCandidateSet> Sets = collectFusionCandidates(Loops, DT, PDT, SE, AA);
+      for(FusionCandidateSet &Set : Sets) {
+        unsigned k = 0;
+        while(k + 1 < Set.size()) {
+          auto Start = std::chrono::steady_clock::now();
+          bool Fused = tryFusion(Set[k], Set[k + 1], DT, PDT, LI, SE, DI, AA, TTI, ORE);
+          std::chrono::duration<double, std::micro> Elapsed = std::chrono::steady_clock::now() - Start;
+          outs() << "Tentativo di fusione " << (Fused ? "riuscito" : "fallito")
+                 << " in " << format("%.1f", Elapsed.count()) << " us\n";
+          if(Fused) {
+            // L2 non esiste più: il suo posto nella classe va al loop successivo
+            Set.erase(Set.begin() + k + 1);
+            NumFusions++;
+          } else {
+            k++;
+          }
+        }
+      }
+
+      // I sotto-loop dei loop rimasti, compresi quelli fusi che ora
+      // contengono anche i sotto-loop di L2
+      for(FusionCandidateSet &Set : Sets) {
+        for(Loop* L : Set) {
+          std::vector<Loop*> subLoops = L->getSubLoopsVector();
+          if(subLoops.size() > 1) {
+            NumFusions += visitLoops(subLoops, DT, PDT, LI, SE, DI, AA, TTI, ORE);
+          }
+        }
+      }
+      return NumFusions;
     }
 
     /**
@@ -484,26 +1620,1004 @@ namespace
       PostDominatorTree &PDT = AM.getResult<PostDominatorTreeAnalysis>(F);  // Post-dominanza
       ScalarEvolution &SE = AM.getResult<ScalarEvolutionAnalysis>(F);       // Analisi matematica
       DependenceInfo &DI = AM.getResult<DependenceAnalysis>(F);             // Analisi dipendenze
+      TargetTransformInfo &TTI = AM.getResult<TargetIRAnalysis>(F);         // Costi del target
+      OptimizationRemarkEmitter &ORE = AM.getResult<OptimizationRemarkEmitterAnalysis>(F);
+      AAResults &AA = AM.getResult<AAManager>(F);                           // Load delle guardie
 
       std::vector<Loop*> Loops = LI.getTopLevelLoops();
-      visitLoops(Loops, DT, PDT, SE);
+      unsigned NumFusions = visitLoops(Loops, DT, PDT, LI, SE, DI, AA, TTI, ORE);
+      outs() << "Fusioni nella funzione " << F.getName() << ": " << NumFusions << "\n";
+      if(NumFusions == 0) return PreservedAnalyses::all();
 
       // STEP 5: NOTIFICA DELLE ANALISI PRESERVATE
-      // Indichiamo a LLVM che tutte le analisi sono ancora valide
-      // (in realtà alcune potrebbero essere invalidate dalla trasformazione)
-      return PreservedAnalyses::all();
+      // fuseLoops aggiorna DT, PDT, LoopInfo e SCEV: le altre analisi
+      // (DependenceInfo, AA sui valori rimossi, ...) vanno ricalcolate
+      PreservedAnalyses PA;
+      PA.preserve<DominatorTreeAnalysis>();
+      PA.preserve<PostDominatorTreeAnalysis>();
+      PA.preserve<LoopAnalysis>();
+      PA.preserve<ScalarEvolutionAnalysis>();
+      return PA;
     }
   
     // Questa funzione forza l'esecuzione del pass anche con -O0
     // Normalmente LLVM salta le ottimizzazioni quando optnone è impostato
     static bool isRequired() { return true; }
   };  
+
+  // Struttura del pass di distribuzione (loop fission): l'inverso della
+  // fusione, divide il corpo di un loop in più loop eseguiti uno dopo l'altro
+  struct LoopDistribution1 : PassInfoMixin<LoopDistribution1>
+  {
+    // Un gruppo di istruzioni del corpo che finirà in un loop a sé
+    struct Partition {
+      SmallPtrSet<Instruction*, 8> Insts;
+      SmallPtrSet<const SCEV*, 4> Streams;
+      bool Cyclic = false; // Contiene una dipendenza in memoria tra iterazioni diverse
+    };
+
+    /**
+     * Componenti fortemente connesse del grafo delle dipendenze (Tarjan).
+     * Le componenti vengono numerate in ordine topologico inverso: una
+     * componente riceve il suo numero dopo tutte quelle raggiungibili da lei
+     */
+    struct SCCFinder {
+      const std::vector<SmallVector<unsigned, 4>> &Succs;
+      std::vector<int> Index, LowLink, SCCOf;
+      std::vector<bool> OnStack;
+      SmallVector<unsigned, 16> Stack;
+      int Next = 0;
+      unsigned NumSCCs = 0;
+
+      SCCFinder(const std::vector<SmallVector<unsigned, 4>> &Succs)
+          : Succs(Succs), Index(Succs.size(), -1), LowLink(Succs.size()),
+            SCCOf(Succs.size(), -1), OnStack(Succs.size(), false) {
+        for(unsigned V = 0; V < Succs.size(); V++) {
+          if(Index[V] < 0) strongConnect(V);
+        }
+      }
+
+      void strongConnect(unsigned V) {
+        Index[V] = LowLink[V] = Next++;
+        Stack.push_back(V);
+        OnStack[V] = true;
+        for(unsigned W : Succs[V]) {
+          if(Index[W] < 0) {
+            strongConnect(W);
+            LowLink[V] = std::min(LowLink[V], LowLink[W]);
+          } else if(OnStack[W]) {
+            LowLink[V] = std::min(LowLink[V], Index[W]);
+          }
+        }
+        if(LowLink[V] != Index[V]) return;
+        unsigned W;
+        do {
+          W = Stack.pop_back_val();
+          OnStack[W] = false;
+          SCCOf[W] = NumSCCs;
+        } while(W != V);
+        NumSCCs++;
+      }
+    };
+
+    /**
+     * Il loop deve avere la forma dei for dopo mem2reg: l'header valuta la
+     * condizione ed è l'unico blocco da cui si esce, il resto del corpo è
+     * una sequenza di blocchi con salti incondizionati fino al latch.
+     * Le induction variable e la condizione vengono replicate in ogni loop
+     */
+    bool hasDistributableShape(Loop* L) {
+      if(!L->isInnermost() || !L->getLoopPreheader() || !L->getExitBlock() || !L->getLoopLatch()) {
+        return false;
+      }
+      if(L->getExitingBlock() != L->getHeader()) return false;
+      for(BasicBlock* BB : L->blocks()) {
+        BranchInst* Br = dyn_cast<BranchInst>(BB->getTerminator());
+        if(!Br || Br->isConditional() != (BB == L->getHeader())) return false;
+      }
+      return true;
+    }
+
+    /**
+     * Ordina le componenti in ordine topologico. Tra quelle pronte sceglie
+     * prima una dello stesso tipo (ciclica o no) dell'ultima scelta, poi la
+     * prima nel programma: componenti dello stesso tipo restano vicine e
+     * possono finire nello stesso loop
+     */
+    std::vector<unsigned> orderComponents(const std::vector<SmallVector<unsigned, 4>> &Succs,
+                                          const SCCFinder &SCCs, const std::vector<bool> &Cyclic) {
+      std::vector<SmallSetVector<unsigned, 4>> CSuccs(SCCs.NumSCCs);
+      std::vector<unsigned> InDegree(SCCs.NumSCCs, 0), First(SCCs.NumSCCs, Succs.size());
+      for(unsigned U = 0; U < Succs.size(); U++) {
+        First[SCCs.SCCOf[U]] = std::min(First[SCCs.SCCOf[U]], U);
+        for(unsigned V : Succs[U]) {
+          if(SCCs.SCCOf[U] != SCCs.SCCOf[V] && CSuccs[SCCs.SCCOf[U]].insert(SCCs.SCCOf[V])) {
+            InDegree[SCCs.SCCOf[V]]++;
+          }
+        }
+      }
+
+      std::vector<unsigned> Order, Ready;
+      for(unsigned C = 0; C < SCCs.NumSCCs; C++) {
+        if(InDegree[C] == 0) Ready.push_back(C);
+      }
+      while(!Ready.empty()) {
+        auto Best = Ready.begin();
+        for(auto It = Ready.begin(); It != Ready.end(); ++It) {
+          bool SameKind = !Order.empty() && Cyclic[*It] == Cyclic[Order.back()];
+          bool BestSameKind = !Order.empty() && Cyclic[*Best] == Cyclic[Order.back()];
+          if(SameKind != BestSameKind ? SameKind : First[*It] < First[*Best]) Best = It;
+        }
+        unsigned C = *Best;
+        Ready.erase(Best);
+        Order.push_back(C);
+        for(unsigned D : CSuccs[C]) {
+          if(--InDegree[D] == 0) Ready.push_back(D);
+        }
+      }
+      return Order;
+    }
+
+    /**
+     * Divide il corpo di L in gruppi di istruzioni da eseguire in loop
+     * separati. I nodi del grafo sono le istruzioni che non si possono
+     * ricalcolare in ogni loop: accessi in memoria, phi e tutto ciò che ne
+     * dipende. Gli archi sono:
+     *  - gli usi SSA, in entrambe le direzioni: un valore letto dalla
+     *    memoria non può passare da un loop all'altro, quindi chi lo usa
+     *    deve stare nello stesso loop
+     *  - le dipendenze in memoria date da DependenceInfo sul livello di L,
+     *    dalla sorgente (l'accesso eseguito prima) alla destinazione
+     * Le componenti fortemente connesse sono i gruppi minimi; due gruppi
+     * vicini dello stesso tipo restano insieme se condividono la cache
+     * (lo stesso criterio della fusione). Se rimangono almeno due gruppi,
+     * quelli senza cicli possono essere vettorizzati da soli o gruppi
+     * senza dati in comune usano meno cache
+     */
+    bool buildPartitions(Loop* L, LoopInfo &LI, ScalarEvolution &SE, DependenceInfo &DI,
+                         std::vector<Partition> &Parts) {
+      // Le induction variable (phi affini secondo SCEV) si ricalcolano in
+      // ogni loop; le altre phi portano un valore da un'iterazione alla
+      // successiva e sono nodi del grafo
+      SmallPtrSet<Instruction*, 16> Recomputable;
+      for(PHINode &Phi : L->getHeader()->phis()) {
+        const SCEVAddRecExpr* AR = dyn_cast<SCEVAddRecExpr>(SE.getSCEV(&Phi));
+        if(AR && AR->getLoop() == L && AR->isAffine()) Recomputable.insert(&Phi);
+      }
+
+      // Le definizioni precedono gli usi in reverse post-order (le phi a
+      // parte, gestite sopra)
+      LoopBlocksRPO RPOT(L);
+      RPOT.perform(&LI);
+      std::vector<Instruction*> Nodes;
+      DenseMap<Instruction*, unsigned> NodeIndex;
+      for(BasicBlock* BB : RPOT) {
+        for(Instruction &I : *BB) {
+          if(I.isTerminator() || Recomputable.count(&I)) continue;
+          bool CanRecompute = !isa<PHINode>(I) && !I.mayReadOrWriteMemory() && !I.mayHaveSideEffects();
+          for(Value* Op : I.operands()) {
+            Instruction* OpI = dyn_cast<Instruction>(Op);
+            if(OpI && L->contains(OpI) && !Recomputable.count(OpI)) CanRecompute = false;
+          }
+          if(CanRecompute) {
+            Recomputable.insert(&I);
+          } else {
+            NodeIndex[&I] = Nodes.size();
+            Nodes.push_back(&I);
+          }
+        }
+      }
+
+      // La condizione di uscita e l'incremento delle induction variable
+      // vengono copiati in ogni loop
+      BranchInst* Br = cast<BranchInst>(L->getHeader()->getTerminator());
+      Instruction* Cond = dyn_cast<Instruction>(Br->getCondition());
+      if(Cond && NodeIndex.count(Cond)) {
+        LLVM_DEBUG(dbgs() << "La condizione di uscita dipende dalla memoria\n");
+        return false;
+      }
+      for(PHINode &Phi : L->getHeader()->phis()) {
+        Instruction* Next = dyn_cast<Instruction>(Phi.getIncomingValueForBlock(L->getLoopLatch()));
+        if(Recomputable.count(&Phi) && Next && NodeIndex.count(Next)) {
+          LLVM_DEBUG(dbgs() << "L'incremento di un'induction variable dipende dalla memoria\n");
+          return false;
+        }
+      }
+
+      std::vector<SmallVector<unsigned, 4>> Succs(Nodes.size());
+      // Dipendenze in memoria tra iterazioni diverse: un gruppo che le
+      // contiene è ciclico e non si può vettorizzare. Riduzioni e
+      // ricorrenze sui registri (le phi) sono invece gestite dal vettorizzatore
+      SmallVector<std::pair<unsigned, unsigned>, 8> Carried;
+      for(unsigned U = 0; U < Nodes.size(); U++) {
+        for(User* Usr : Nodes[U]->users()) {
+          auto It = NodeIndex.find(cast<Instruction>(Usr));
+          if(It == NodeIndex.end()) continue;
+          Succs[U].push_back(It->second);
+          Succs[It->second].push_back(U);
+        }
+      }
+
+      // Nodes è in ordine di programma: per A prima di B, la direzione '<'
+      // o '=' va da A a B, la direzione '>' da B (iterazione precedente) ad A
+      unsigned Level = L->getLoopDepth();
+      for(unsigned A = 0; A < Nodes.size(); A++) {
+        if(!Nodes[A]->mayReadOrWriteMemory()) continue;
+        for(unsigned B = A; B < Nodes.size(); B++) {
+          if(!Nodes[B]->mayReadOrWriteMemory()) continue;
+          if(!Nodes[A]->mayWriteToMemory() && !Nodes[B]->mayWriteToMemory()) continue;
+          std::unique_ptr<Dependence> Dep = DI.depends(Nodes[A], Nodes[B], true);
+          if(!Dep) continue;
+          unsigned Dir = Dependence::DVEntry::ALL;
+          if(!Dep->isConfused() && Level <= Dep->getLevels()) Dir = Dep->getDirection(Level);
+          if(Dir & (Dependence::DVEntry::LT | Dependence::DVEntry::GT)) Carried.push_back({A, B});
+          if(A == B) continue;
+          if(Dir & (Dependence::DVEntry::LT | Dependence::DVEntry::EQ)) Succs[A].push_back(B);
+          if(Dir & Dependence::DVEntry::GT) Succs[B].push_back(A);
+        }
+      }
+
+      SCCFinder SCCs(Succs);
+      std::vector<std::vector<Instruction*>> Members(SCCs.NumSCCs);
+      for(unsigned U = 0; U < Nodes.size(); U++) Members[SCCs.SCCOf[U]].push_back(Nodes[U]);
+      std::vector<bool> Cyclic(SCCs.NumSCCs, false);
+      for(auto &Pair : Carried) {
+        if(SCCs.SCCOf[Pair.first] == SCCs.SCCOf[Pair.second]) Cyclic[SCCs.SCCOf[Pair.first]] = true;
+      }
+
+      for(unsigned C : orderComponents(Succs, SCCs, Cyclic)) {
+        Partition P;
+        P.Insts.insert(Members[C].begin(), Members[C].end());
+        collectStreams(Members[C], SE, P.Streams);
+        P.Cyclic = Cyclic[C];
+        // Gruppi vicini nell'ordine topologico si possono unire senza
+        // invertire nessuna dipendenza
+        unsigned Shared, Total;
+        if(!Parts.empty() && Parts.back().Cyclic == P.Cyclic &&
+           shareCacheProfitably(Parts.back().Streams, P.Streams, Shared, Total)) {
+          Parts.back().Insts.insert(P.Insts.begin(), P.Insts.end());
+          Parts.back().Streams.insert(P.Streams.begin(), P.Streams.end());
+        } else {
+          Parts.push_back(std::move(P));
+        }
+      }
+
+      for(unsigned K = 0; K < Parts.size(); K++) {
+        LLVM_DEBUG(dbgs() << "Gruppo " << K << (Parts[K].Cyclic ? " (ciclico)" : "") << ": "
+                          << Parts[K].Insts.size() << " istruzioni, " << Parts[K].Streams.size() << " oggetti\n");
+      }
+      return Parts.size() > 1;
+    }
+
+    /**
+     * Crea un loop per gruppo. Come in LoopDistribute di LLVM, l'ultimo
+     * gruppo resta nel loop originale e per gli altri il loop viene copiato
+     * (con il preheader) davanti, dal penultimo al primo. Da ogni loop
+     * vengono poi tolte le istruzioni degli altri gruppi
+     */
+    void distributeLoop(Loop* L, std::vector<Partition> &Parts, DominatorTree &DT,
+                        PostDominatorTree &PDT, LoopInfo &LI, ScalarEvolution &SE) {
+      Function* F = L->getHeader()->getParent();
+      SE.forgetLoop(L);
+
+      // Il preheader viene copiato insieme a ogni loop: deve essere vuoto
+      // e avere un solo predecessore, da cui partirà il primo loop
+      BasicBlock* PH = L->getLoopPreheader();
+      if(!PH->getSinglePredecessor() || &PH->front() != PH->getTerminator()) {
+        SplitBlock(PH, PH->getTerminator(), &DT, &LI);
+        PH = L->getLoopPreheader();
+      }
+      BasicBlock* Pred = PH->getSinglePredecessor();
+      BasicBlock* Exit = L->getExitBlock();
+
+      unsigned Last = Parts.size() - 1;
+      SmallVector<std::unique_ptr<ValueToValueMapTy>, 4> VMaps;
+      SmallVector<Loop*, 4> Loops(Parts.size(), L);
+      for(unsigned K = 0; K < Last; K++) VMaps.push_back(std::make_unique<ValueToValueMapTy>());
+      BasicBlock* TopPH = PH;
+      for(int K = Last - 1; K >= 0; K--) {
+        SmallVector<BasicBlock*, 8> Blocks;
+        Loops[K] = cloneLoopWithPreheader(TopPH, Pred, L, *VMaps[K], ".dist" + Twine(K), &LI, &DT, Blocks);
+        // La copia esce nel preheader del loop successivo
+        (*VMaps[K])[Exit] = TopPH;
+        remapInstructionsInBlocks(Blocks, *VMaps[K]);
+        TopPH = Loops[K]->getLoopPreheader();
+      }
+      Pred->getTerminator()->replaceUsesOfWith(PH, TopPH);
+
+      // Un valore usato dopo il loop (definito nell'header, l'unico blocco
+      // che domina l'uscita) va preso dal loop del suo gruppo
+      for(unsigned K = 0; K < Last; K++) {
+        for(Instruction* I : Parts[K].Insts) {
+          Value* Copy = (*VMaps[K])[I];
+          I->replaceUsesWithIf(Copy, [&](Use &U) {
+            return !L->contains(cast<Instruction>(U.getUser()));
+          });
+        }
+      }
+
+      for(unsigned K = 0; K <= Last; K++) {
+        SmallVector<Instruction*, 16> Dead;
+        for(unsigned O = 0; O <= Last; O++) {
+          if(O == K) continue;
+          for(Instruction* I : Parts[O].Insts) {
+            Dead.push_back(K == Last ? I : cast<Instruction>((*VMaps[K])[I]));
+          }
+        }
+        // Le istruzioni di un gruppo si usano solo tra loro
+        for(Instruction* I : Dead) I->replaceAllUsesWith(PoisonValue::get(I->getType()));
+        for(Instruction* I : Dead) I->eraseFromParent();
+
+        // Senza gli altri gruppi restano istruzioni ricalcolabili inutili
+        SmallVector<WeakTrackingVH, 16> Candidates;
+        for(BasicBlock* BB : Loops[K]->blocks()) {
+          for(Instruction &I : *BB) Candidates.push_back(&I);
+        }
+        for(WeakTrackingVH &V : reverse(Candidates)) {
+          if(Instruction* I = dyn_cast_or_null<Instruction>(V)) {
+            if(isInstructionTriviallyDead(I)) RecursivelyDeleteTriviallyDeadInstructions(I);
+          }
+        }
+        // La fusione annullerebbe la distribuzione
+        addStringMetadataToLoop(Loops[K], NoFusionMD, 1);
+      }
+
+      // Trasformazione una tantum per loop, come versioning e peeling
+      DT.recalculate(*F);
+      PDT.recalculate(*F);
+    }
+
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &AM)
+    {
+      LoopInfo &LI = AM.getResult<LoopAnalysis>(F);
+      DominatorTree &DT = AM.getResult<DominatorTreeAnalysis>(F);
+      PostDominatorTree &PDT = AM.getResult<PostDominatorTreeAnalysis>(F);
+      ScalarEvolution &SE = AM.getResult<ScalarEvolutionAnalysis>(F);
+      DependenceInfo &DI = AM.getResult<DependenceAnalysis>(F);
+
+      // I loop creati dalla distribuzione contengono un gruppo solo: basta
+      // visitare i loop più interni presenti all'inizio
+      SmallVector<Loop*, 8> Worklist;
+      for(Loop* L : LI.getLoopsInPreorder()) {
+        if(L->isInnermost()) Worklist.push_back(L);
+      }
+
+      unsigned NumDistributed = 0;
+      for(Loop* L : Worklist) {
+        LLVM_DEBUG(dbgs() << "Analizzo un loop di profondità " << L->getLoopDepth() << "\n");
+        if(!hasDistributableShape(L)) {
+          LLVM_DEBUG(dbgs() << "Forma del loop non supportata\n");
+          continue;
+        }
+        std::vector<Partition> Parts;
+        if(!buildPartitions(L, LI, SE, DI, Parts)) continue;
+        distributeLoop(L, Parts, DT, PDT, LI, SE);
+        LLVM_DEBUG(dbgs() << "Loop distribuito in " << Parts.size() << " loop\n");
+        NumDistributed++;
+      }
+      outs() << "Loop distribuiti nella funzione " << F.getName() << ": " << NumDistributed << "\n";
+      if(NumDistributed == 0) return PreservedAnalyses::all();
+
+      PreservedAnalyses PA;
+      PA.preserve<DominatorTreeAnalysis>();
+      PA.preserve<PostDominatorTreeAnalysis>();
+      PA.preserve<LoopAnalysis>();
+      return PA;
+    }
+
+    static bool isRequired() { return true; }
+  };
+  // Controllo di un loop nella forma dei for dopo mem2reg: la phi
+  // dell'induction variable, il confronto nell'header e l'incremento
+  struct LoopControl {
+    PHINode* IV = nullptr;
+    ICmpInst* Cmp = nullptr;
+    BranchInst* Br = nullptr;
+    Instruction* Next = nullptr;
+  };
+
+  /**
+   * Nell'header ci sono solo la phi dell'induction variable, il confronto
+   * e il branch; si esce solo dall'header. Start, passo e limite devono
+   * essere invarianti rispetto a Outer, il loop più esterno del nido:
+   * scambiando i loop o dividendoli in tile il controllo di ciascuno viene
+   * spostato fuori dagli altri
+   */
+  bool getLoopControl(Loop* L, Loop* Outer, ScalarEvolution &SE, LoopControl &C) {
+    BasicBlock* Header = L->getHeader();
+    if(!L->getLoopPreheader() || !L->getLoopLatch() || !L->getExitBlock()) return false;
+    if(L->getExitingBlock() != Header || Header->size() != 3) return false;
+    C.IV = dyn_cast<PHINode>(&Header->front());
+    C.Br = dyn_cast<BranchInst>(Header->getTerminator());
+    if(!C.IV || !C.Br || !C.Br->isConditional()) return false;
+    C.Cmp = dyn_cast<ICmpInst>(C.Br->getCondition());
+    if(!C.Cmp || C.Cmp->getParent() != Header) return false;
+    C.Next = dyn_cast<Instruction>(C.IV->getIncomingValueForBlock(L->getLoopLatch()));
+    if(!C.Next || !L->contains(C.Next)) return false;
+
+    const SCEVAddRecExpr* AR = dyn_cast<SCEVAddRecExpr>(SE.getSCEV(C.IV));
+    if(!AR || AR->getLoop() != L || !AR->isAffine() || !SE.isLoopInvariant(AR->getStart(), Outer) ||
+       !SE.isLoopInvariant(AR->getStepRecurrence(SE), Outer)) {
+      return false;
+    }
+    Value* Bound = C.Cmp->getOperand(0) == C.IV ? C.Cmp->getOperand(1) : C.Cmp->getOperand(0);
+    if((C.Cmp->getOperand(0) != C.IV && C.Cmp->getOperand(1) != C.IV) ||
+       !SE.isLoopInvariant(SE.getSCEV(Bound), Outer)) {
+      return false;
+    }
+    // L'incremento si può spostare solo se dipende dalla sola IV
+    for(Value* Op : C.Next->operands()) {
+      if(Op != C.IV && !isa<Constant>(Op)) return false;
+    }
+    return true;
+  }
+
+  /**
+   * Il nido è perfetto se fuori dal loop interno il loop esterno contiene
+   * solo il proprio controllo e branch incondizionati. Nessun valore del
+   * controllo deve servire dopo il nido
+   */
+  bool isPerfectNest(Loop* Outer, Loop* Inner, const LoopControl &OC, const LoopControl &IC) {
+    for(BasicBlock* BB : Outer->blocks()) {
+      if(Inner->contains(BB) || BB == Outer->getHeader()) continue;
+      for(Instruction &I : *BB) {
+        if(&I == OC.Next) continue;
+        BranchInst* Br = dyn_cast<BranchInst>(&I);
+        if(!Br || Br->isConditional()) return false;
+      }
+    }
+    for(const LoopControl* C : {&OC, &IC}) {
+      for(Instruction* I : {(Instruction*)C->IV, (Instruction*)C->Cmp, C->Next}) {
+        for(User* U : I->users()) {
+          if(!Outer->contains(cast<Instruction>(U))) return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Passo in byte del puntatore di un accesso rispetto a L: lo step
+   * dell'AddRec di L, 0 se il puntatore è invariante in L. Un passo non
+   * costante conta come il più lungo possibile
+   */
+  uint64_t getAccessStride(Instruction* I, Loop* L, ScalarEvolution &SE) {
+    const SCEV* S = SE.getSCEV(getLoadStorePointerOperand(I));
+    while(const SCEVAddRecExpr* AR = dyn_cast<SCEVAddRecExpr>(S)) {
+      if(AR->getLoop() == L) {
+        const SCEVConstant* Step = dyn_cast<SCEVConstant>(AR->getStepRecurrence(SE));
+        if(!AR->isAffine() || !Step) return UINT64_MAX;
+        return Step->getAPInt().abs().getLimitedValue();
+      }
+      S = AR->getStart();
+    }
+    return SE.isLoopInvariant(S, L) ? 0 : UINT64_MAX;
+  }
+
+  /**
+   * DependenceInfo non sempre separa gli indici di un array a più
+   * dimensioni: per due accessi allo stesso indirizzo, come la store di
+   * B[i][j] con sé stessa, può restituire [* *]. Se ordinando i passi del
+   * puntatore ciascuno supera lo spazio coperto dai più corti, iterazioni
+   * diverse accedono a indirizzi diversi. I due accessi si toccano allora
+   * solo in iterazioni che differiscono al più nel loop in cui l'indirizzo
+   * è invariante: scambiare o dividere in tile i loop non cambia il loro
+   * ordine
+   */
+  bool isSameAddressPerIteration(Instruction* A, Instruction* B, ArrayRef<Loop*> Nest,
+                                 ScalarEvolution &SE) {
+    if(SE.getSCEV(getLoadStorePointerOperand(A)) != SE.getSCEV(getLoadStorePointerOperand(B))) {
+      return false;
+    }
+    const DataLayout &DL = A->getModule()->getDataLayout();
+    uint64_t Reach = DL.getTypeStoreSize(getLoadStoreType(A));
+    // Si esce dall'header, che contiene solo il controllo: il corpo viene
+    // eseguito al più backedge-taken count volte
+    SmallVector<std::pair<uint64_t, uint64_t>, 4> Strides;
+    unsigned Invariant = 0;
+    for(Loop* L : Nest) {
+      uint64_t Stride = getAccessStride(A, L, SE);
+      const SCEVConstant* BTC = dyn_cast<SCEVConstant>(SE.getConstantMaxBackedgeTakenCount(L));
+      if(Stride == UINT64_MAX || !BTC || BTC->getAPInt().getActiveBits() > 32) return false;
+      if(Stride == 0) Invariant++;
+      else Strides.push_back({Stride, BTC->getAPInt().getZExtValue()});
+    }
+    if(Invariant > 1) return false;
+    llvm::sort(Strides);
+    for(auto &Stride : Strides) {
+      if(Stride.first < Reach || Stride.first > UINT32_MAX) return false;
+      Reach += Stride.first * (Stride.second > 0 ? Stride.second - 1 : 0);
+    }
+    return true;
+  }
+
+  // Struttura del pass di interchange: scambia i due loop di un nido
+  // perfetto quando il loop interno attraversa la memoria a passi lunghi
+  struct LoopInterchange1 : PassInfoMixin<LoopInterchange1>
+  {
+    /**
+     * Lo scambio inverte l'ordine delle iterazioni dei due loop: una
+     * dipendenza con direzione (<, >) diventerebbe (>, <), cioè la
+     * destinazione verrebbe eseguita prima della sorgente
+     */
+    bool isInterchangeLegal(Loop* Outer, Loop* Inner, DependenceInfo &DI, ScalarEvolution &SE) {
+      SmallVector<Instruction*, 8> Accesses;
+      collectMemoryAccesses(Inner, Accesses);
+      unsigned OuterLevel = Outer->getLoopDepth(), InnerLevel = Inner->getLoopDepth();
+      for(unsigned A = 0; A < Accesses.size(); A++) {
+        for(unsigned B = A; B < Accesses.size(); B++) {
+          if(!Accesses[A]->mayWriteToMemory() && !Accesses[B]->mayWriteToMemory()) continue;
+          std::unique_ptr<Dependence> Dep = DI.depends(Accesses[A], Accesses[B], true);
+          if(!Dep || isSameAddressPerIteration(Accesses[A], Accesses[B], {Outer, Inner}, SE)) continue;
+          if(Dep->isConfused() || Dep->getLevels() < InnerLevel) {
+            LLVM_DEBUG(dbgs() << "Dipendenza sconosciuta tra:\n  " << *Accesses[A] << "\n  "
+                              << *Accesses[B] << "\n");
+            return false;
+          }
+          unsigned OuterDir = Dep->getDirection(OuterLevel), InnerDir = Dep->getDirection(InnerLevel);
+          if(((OuterDir & Dependence::DVEntry::LT) && (InnerDir & Dependence::DVEntry::GT)) ||
+             ((OuterDir & Dependence::DVEntry::GT) && (InnerDir & Dependence::DVEntry::LT))) {
+            LLVM_DEBUG(dbgs() << "Lo scambio invertirebbe la dipendenza tra:\n  " << *Accesses[A] << "\n  "
+                              << *Accesses[B] << "\n");
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Conviene scambiare i loop se nel nuovo loop interno più accessi
+     * scorrono la memoria un elemento alla volta. Restituisce anche il passo
+     * interno più lungo prima e dopo, per il remark
+     */
+    bool isInterchangeProfitable(Loop* Outer, Loop* Inner, ScalarEvolution &SE,
+                                 uint64_t &StrideBefore, uint64_t &StrideAfter) {
+      const DataLayout &DL = Inner->getHeader()->getModule()->getDataLayout();
+      unsigned UnitBefore = 0, UnitAfter = 0;
+      StrideBefore = StrideAfter = 0;
+      for(BasicBlock* BB : Inner->blocks()) {
+        for(Instruction &I : *BB) {
+          if(!getLoadStorePointerOperand(&I)) continue;
+          uint64_t Size = DL.getTypeStoreSize(getLoadStoreType(&I));
+          uint64_t Before = getAccessStride(&I, Inner, SE), After = getAccessStride(&I, Outer, SE);
+          LLVM_DEBUG(dbgs() << "Passo di" << I << ": " << Before << " byte, dopo lo scambio " << After << "\n");
+          UnitBefore += Before == Size;
+          UnitAfter += After == Size;
+          StrideBefore = std::max(StrideBefore, Before);
+          StrideAfter = std::max(StrideAfter, After);
+        }
+      }
+      LLVM_DEBUG(dbgs() << "Accessi a passo unitario: " << UnitBefore << ", dopo lo scambio " << UnitAfter << "\n");
+      return UnitAfter > UnitBefore;
+    }
+
+    /**
+     * Il CFG resta quello di prima: si scambiano i controlli. La phi, il
+     * confronto e l'incremento del loop esterno passano nel loop interno e
+     * viceversa, quindi il loop esterno scorre i valori che prima scorreva
+     * quello interno. Il corpo usa le stesse phi, ora dominate dal nuovo header
+     */
+    void interchangeLoops(Loop* Outer, Loop* Inner, LoopControl &OC, LoopControl &IC) {
+      BasicBlock* OuterPH = Outer->getLoopPreheader();
+      BasicBlock* InnerPH = Inner->getLoopPreheader();
+      BasicBlock* OuterLatch = Outer->getLoopLatch();
+      BasicBlock* InnerLatch = Inner->getLoopLatch();
+      // Il ramo vero del branch entra nel corpo o esce dal loop?
+      bool OuterTrueEnters = Outer->contains(OC.Br->getSuccessor(0));
+      bool InnerTrueEnters = Inner->contains(IC.Br->getSuccessor(0));
+
+      OC.IV->moveBefore(IC.IV);
+      IC.IV->moveBefore(&*Outer->getHeader()->begin());
+      for(PHINode* IV : {OC.IV, IC.IV}) {
+        for(unsigned K = 0; K < IV->getNumIncomingValues(); K++) {
+          BasicBlock* In = IV->getIncomingBlock(K);
+          if(In == OuterPH) IV->setIncomingBlock(K, InnerPH);
+          else if(In == InnerPH) IV->setIncomingBlock(K, OuterPH);
+          else if(In == OuterLatch) IV->setIncomingBlock(K, InnerLatch);
+          else IV->setIncomingBlock(K, OuterLatch);
+        }
+      }
+      OC.Cmp->moveBefore(IC.Br);
+      IC.Cmp->moveBefore(OC.Br);
+      OC.Next->moveBefore(InnerLatch->getTerminator());
+      IC.Next->moveBefore(OuterLatch->getTerminator());
+      OC.Br->setCondition(IC.Cmp);
+      IC.Br->setCondition(OC.Cmp);
+      if(OuterTrueEnters != InnerTrueEnters) {
+        OC.Br->swapSuccessors();
+        IC.Br->swapSuccessors();
+      }
+    }
+
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &AM)
+    {
+      LoopInfo &LI = AM.getResult<LoopAnalysis>(F);
+      ScalarEvolution &SE = AM.getResult<ScalarEvolutionAnalysis>(F);
+      DependenceInfo &DI = AM.getResult<DependenceAnalysis>(F);
+      OptimizationRemarkEmitter &ORE = AM.getResult<OptimizationRemarkEmitterAnalysis>(F);
+
+      // Coppie formate da un loop più interno e dal loop che lo contiene
+      unsigned NumInterchanged = 0;
+      for(Loop* Inner : LI.getLoopsInPreorder()) {
+        Loop* Outer = Inner->getParentLoop();
+        if(!Inner->isInnermost() || !Outer || Outer->getSubLoops().size() != 1) continue;
+        LLVM_DEBUG(dbgs() << "Analizzo un nido di profondità " << Inner->getLoopDepth() << "\n");
+
+        LoopControl OC, IC;
+        if(!getLoopControl(Outer, Outer, SE, OC) || !getLoopControl(Inner, Outer, SE, IC) ||
+           !isPerfectNest(Outer, Inner, OC, IC)) {
+          LLVM_DEBUG(dbgs() << "Il nido non è perfetto o i controlli non sono nella forma attesa\n");
+          continue;
+        }
+
+        uint64_t StrideBefore, StrideAfter;
+        if(!isInterchangeProfitable(Outer, Inner, SE, StrideBefore, StrideAfter)) {
+          LLVM_DEBUG(dbgs() << "Lo scambio non conviene\n");
+          continue;
+        }
+        auto AddStrides = [&](auto R) {
+          return R << "innermost stride " << ore::NV("StrideBefore", StrideBefore) << " -> "
+                   << ore::NV("StrideAfter", StrideAfter) << " bytes";
+        };
+        if(!isInterchangeLegal(Outer, Inner, DI, SE)) {
+          ORE.emit([&]() {
+            return AddStrides(OptimizationRemarkMissed("loop-interchange1", "Dependence",
+                                                       Outer->getStartLoc(), Outer->getHeader())
+                              << "loops not interchanged, a dependence would be reversed: ");
+          });
+          continue;
+        }
+
+        interchangeLoops(Outer, Inner, OC, IC);
+        SE.forgetLoop(Outer);
+        ORE.emit([&]() {
+          return AddStrides(OptimizationRemark("loop-interchange1", "Interchanged",
+                                               Outer->getStartLoc(), Outer->getHeader())
+                            << "loops interchanged: ");
+        });
+        LLVM_DEBUG(dbgs() << "Loop scambiati\n");
+        NumInterchanged++;
+      }
+      outs() << "Nidi scambiati nella funzione " << F.getName() << ": " << NumInterchanged << "\n";
+      if(NumInterchanged == 0) return PreservedAnalyses::all();
+
+      // Il CFG non cambia: dominatori e loop restano validi
+      PreservedAnalyses PA;
+      PA.preserve<DominatorTreeAnalysis>();
+      PA.preserve<PostDominatorTreeAnalysis>();
+      PA.preserve<LoopAnalysis>();
+      return PA;
+    }
+
+    static bool isRequired() { return true; }
+  };
+  // Struttura del pass di tiling: divide lo spazio di iterazione di un nido
+  // perfetto in blocchi (tile) il cui working set sta nella cache
+  struct LoopTiling1 : PassInfoMixin<LoopTiling1>
+  {
+    /**
+     * Nido perfetto che parte da Outer e scende fino a un loop più interno.
+     * Per dividere un loop in tile serve anche che:
+     *  - il confronto sia `IV < limite` (slt o ult) e il ramo vero entri nel loop
+     *  - il passo sia una costante positiva
+     *  - limite - IV non vada in overflow (start non negativo per slt) e
+     *    nemmeno limite + passo * lato massimo della tile
+     */
+    bool collectTilableNest(Loop* Outer, ScalarEvolution &SE, SmallVectorImpl<Loop*> &Nest,
+                            SmallVectorImpl<LoopControl> &Controls) {
+      for(Loop* L = Outer; ; L = L->getSubLoops().front()) {
+        LoopControl C;
+        if(!getLoopControl(L, Outer, SE, C) || C.Cmp->getOperand(0) != C.IV) return false;
+        bool Signed = C.Cmp->getPredicate() == ICmpInst::ICMP_SLT;
+        if(!Signed && C.Cmp->getPredicate() != ICmpInst::ICMP_ULT) return false;
+        if(!L->contains(C.Br->getSuccessor(0))) return false;
+
+        const SCEVAddRecExpr* AR = cast<SCEVAddRecExpr>(SE.getSCEV(C.IV));
+        const SCEVConstant* Step = dyn_cast<SCEVConstant>(AR->getStepRecurrence(SE));
+        if(!Step || !Step->getAPInt().isStrictlyPositive()) return false;
+        if(Signed && !SE.isKnownNonNegative(AR->getStart())) return false;
+        const SCEV* Bound = SE.getSCEV(C.Cmp->getOperand(1));
+        // Il lato massimo e passo * lato massimo devono stare nel tipo
+        // dell'IV (senza bit di segno), altrimenti l'avanzamento si azzera
+        // o torna indietro e il loop delle tile non termina
+        unsigned Width = Step->getAPInt().getBitWidth();
+        if(!isUIntN(Width, MaxTile)) return false;
+        bool Overflow;
+        APInt MaxAdvance = Step->getAPInt().umul_ov(APInt(Width, MaxTile), Overflow);
+        if(Overflow || MaxAdvance.isNegative()) return false;
+        // Ci interessa solo se limite + avanzamento massimo va in overflow
+        if(Signed) SE.getSignedRangeMax(Bound).sadd_ov(MaxAdvance, Overflow);
+        else SE.getUnsignedRangeMax(Bound).uadd_ov(MaxAdvance, Overflow);
+        if(Overflow) return false;
+
+        Nest.push_back(L);
+        Controls.push_back(C);
+        if(L->isInnermost()) break;
+        if(L->getSubLoops().size() != 1) return false;
+      }
+      for(unsigned K = 0; K + 1 < Nest.size(); K++) {
+        if(!isPerfectNest(Nest[K], Nest[K + 1], Controls[K], Controls[K + 1])) return false;
+      }
+      // L'uscita riceverà il controllo dalle tile, non più dal loop
+      return Nest.size() >= 2 && !isa<PHINode>(Outer->getExitBlock()->front());
+    }
+
+    /**
+     * Le tile eseguono le iterazioni in un ordine diverso: è valido se il
+     * nido è completamente permutabile, cioè se ogni dipendenza, orientata
+     * dalla sorgente alla destinazione, non ha componenti negative. Nel
+     * vettore restituito da DependenceInfo basta che manchi '>' oppure
+     * (dipendenza in verso opposto) '<'. Se un solo loop ha direzione
+     * diversa da '=', l'ordine tra i due accessi non cambia comunque
+     */
+    bool isTilingLegal(ArrayRef<Loop*> Nest, DependenceInfo &DI, ScalarEvolution &SE) {
+      SmallVector<Instruction*, 8> Accesses;
+      collectMemoryAccesses(Nest.back(), Accesses);
+      for(unsigned A = 0; A < Accesses.size(); A++) {
+        for(unsigned B = A; B < Accesses.size(); B++) {
+          if(!Accesses[A]->mayWriteToMemory() && !Accesses[B]->mayWriteToMemory()) continue;
+          std::unique_ptr<Dependence> Dep = DI.depends(Accesses[A], Accesses[B], true);
+          if(!Dep || isSameAddressPerIteration(Accesses[A], Accesses[B], Nest, SE)) continue;
+          if(Dep->isConfused() || Dep->getLevels() < Nest.back()->getLoopDepth()) {
+            LLVM_DEBUG(dbgs() << "Dipendenza sconosciuta tra:\n  " << *Accesses[A] << "\n  "
+                              << *Accesses[B] << "\n");
+            return false;
+          }
+          bool HasLT = false, HasGT = false;
+          unsigned NotEQ = 0;
+          for(Loop* L : Nest) {
+            unsigned Dir = Dep->getDirection(L->getLoopDepth());
+            HasLT |= (Dir & Dependence::DVEntry::LT) != 0;
+            HasGT |= (Dir & Dependence::DVEntry::GT) != 0;
+            NotEQ += Dir != Dependence::DVEntry::EQ;
+          }
+          if(HasLT && HasGT && NotEQ > 1) {
+            LLVM_DEBUG(dbgs() << "Le tile invertirebbero la dipendenza tra:\n  " << *Accesses[A] << "\n  "
+                              << *Accesses[B] << "\n");
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Modello del working set di un blocco di iterazioni che copre
+     * Extents[K] iterazioni del loop Nest[K]. Un accesso tocca Extents[K]
+     * elementi per ogni loop in cui il suo indirizzo cambia; gli accessi allo stesso oggetto che cambiano negli
+     * stessi loop (A[i-1][j] e A[i+1][j]) si sovrappongono e contano una
+     * volta. Un accesso che non scorre la memoria a passo unitario in
+     * nessun loop occupa una linea di cache per elemento.
+     * Reuse dice se la tile serve: un accesso invariante in un loop esterno
+     * al più interno, due accessi allo stesso gruppo o un passo unitario
+     * solo in un loop esterno indicano dati riusati da iterazioni lontane
+     */
+    uint64_t getFootprint(ArrayRef<Loop*> Nest, ArrayRef<uint64_t> Extents, unsigned LineSize,
+                          ScalarEvolution &SE, bool &Reuse) {
+      DenseMap<std::pair<const SCEV*, unsigned>, uint64_t> Groups;
+      Reuse = false;
+      for(BasicBlock* BB : Nest.back()->blocks()) {
+        for(Instruction &I : *BB) {
+          Value* Ptr = getLoadStorePointerOperand(&I);
+          if(!Ptr) continue;
+          uint64_t Size = I.getModule()->getDataLayout().getTypeStoreSize(getLoadStoreType(&I));
+          unsigned Varying = 0;
+          uint64_t Elements = 1;
+          bool UnitStride = false;
+          for(unsigned K = 0; K < Nest.size(); K++) {
+            uint64_t Stride = getAccessStride(&I, Nest[K], SE);
+            if(Stride == 0) {
+              Reuse |= K + 1 < Nest.size();
+              continue;
+            }
+            Varying |= 1 << K;
+            Elements = SaturatingMultiply(Elements, Extents[K]);
+            UnitStride |= Stride == Size;
+            Reuse |= Stride == Size && K + 1 < Nest.size() &&
+                     getAccessStride(&I, Nest.back(), SE) != Size;
+          }
+          uint64_t Bytes = SaturatingMultiply(Elements, UnitStride ? Size : std::max<uint64_t>(Size, LineSize));
+          auto Key = std::make_pair(SE.getPointerBase(SE.getSCEV(Ptr)), Varying);
+          auto It = Groups.find(Key);
+          if(It != Groups.end()) {
+            Reuse = true;
+            It->second = std::max(It->second, Bytes);
+          } else {
+            Groups[Key] = Bytes;
+          }
+        }
+      }
+      uint64_t Footprint = 0;
+      for(auto &G : Groups) Footprint = SaturatingAdd(Footprint, G.second);
+      return Footprint;
+    }
+
+    /**
+     * Strip-mining di ogni loop del nido e interchange dei loop risultanti:
+     * prima i loop sulle tile (passo Tile * passo), poi i loop originali,
+     * che partono dall'inizio della tile e si fermano alla fine della tile
+     * o al limite originale
+     *
+     *   for(ii = s; ii < n; ii += T)      for(i = s; i < n; i++)
+     *     for(jj = t; jj < m; jj += T)      for(j = t; j < m; j++)
+     *       for(i = ii; i < min(n, ii + T); i++)
+     *         for(j = jj; j < min(m, jj + T); j++)
+     */
+    void tileNest(ArrayRef<Loop*> Nest, ArrayRef<LoopControl> Controls, uint64_t Tile,
+                  DominatorTree &DT, PostDominatorTree &PDT, LoopInfo &LI, ScalarEvolution &SE) {
+      Loop* Outer = Nest.front();
+      BasicBlock* PreHead = Outer->getLoopPreheader();
+      BasicBlock* Exit = Outer->getExitBlock();
+      Function* F = PreHead->getParent();
+      LLVMContext &Ctx = F->getContext();
+      Loop* Top = Outer;
+      while(Top->getParentLoop()) Top = Top->getParentLoop();
+      SE.forgetLoop(Top);
+
+      unsigned N = Nest.size();
+      SmallVector<BasicBlock*, 4> Headers, Latches, PreHeads;
+      for(unsigned K = 0; K < N; K++) {
+        PreHeads.push_back(K == 0 ? PreHead : BasicBlock::Create(Ctx, "tile.ph", F, Outer->getHeader()));
+        Headers.push_back(BasicBlock::Create(Ctx, "tile.header", F, Outer->getHeader()));
+      }
+      BasicBlock* Body = BasicBlock::Create(Ctx, "tile.body", F, Outer->getHeader());
+      for(unsigned K = 0; K < N; K++) {
+        Latches.push_back(BasicBlock::Create(Ctx, "tile.latch", F, Exit));
+      }
+
+      IRBuilder<> Builder(Ctx);
+      SmallVector<PHINode*, 4> TileIVs;
+      for(unsigned K = 0; K < N; K++) {
+        const LoopControl &C = Controls[K];
+        Type* Ty = C.IV->getType();
+        Value* Start = C.IV->getIncomingValueForBlock(Nest[K]->getLoopPreheader());
+        // Tile <= MaxTile: collectTilableNest garantisce che non vada in overflow
+        Value* Advance = ConstantInt::get(Ty, cast<SCEVConstant>(cast<SCEVAddRecExpr>(SE.getSCEV(C.IV))
+                                                  ->getStepRecurrence(SE))->getAPInt() * Tile);
+        if(K > 0) {
+          Builder.SetInsertPoint(PreHeads[K]);
+          Builder.CreateBr(Headers[K]);
+        }
+        Builder.SetInsertPoint(Headers[K]);
+        PHINode* TileIV = Builder.CreatePHI(Ty, 2, C.IV->getName() + ".tile");
+        Value* Cond = Builder.CreateICmp(C.Cmp->getPredicate(), TileIV, C.Cmp->getOperand(1));
+        Builder.CreateCondBr(Cond, K + 1 < N ? PreHeads[K + 1] : Body, K == 0 ? Exit : Latches[K - 1]);
+        Builder.SetInsertPoint(Latches[K]);
+        Value* TileNext = Builder.CreateAdd(TileIV, Advance, TileIV->getName() + ".next");
+        Builder.CreateBr(Headers[K]);
+        TileIV->addIncoming(Start, PreHeads[K]);
+        TileIV->addIncoming(TileNext, Latches[K]);
+        TileIVs.push_back(TileIV);
+
+        // Fine della tile: limite - IV non va in overflow perché IV < limite
+        Builder.SetInsertPoint(Body);
+        Value* Bound = C.Cmp->getOperand(1);
+        Value* Left = Builder.CreateSub(Bound, TileIV);
+        Value* Last = Builder.CreateICmpULE(Left, Advance);
+        Value* End = Builder.CreateSelect(Last, Bound, Builder.CreateAdd(TileIV, Advance), "tile.end");
+        C.Cmp->setOperand(1, End);
+        C.IV->setIncomingValueForBlock(Nest[K]->getLoopPreheader(), TileIV);
+      }
+      Builder.SetInsertPoint(Body);
+      Builder.CreateBr(Outer->getHeader());
+      Controls[0].IV->replaceIncomingBlockWith(PreHead, Body);
+      PreHead->getTerminator()->replaceUsesOfWith(Outer->getHeader(), Headers[0]);
+      Controls[0].Br->replaceUsesOfWith(Exit, Latches[N - 1]);
+
+      // Loop delle tile in LoopInfo, tra il padre del nido e il nido
+      SmallVector<Loop*, 4> Tiles;
+      for(unsigned K = 0; K < N; K++) Tiles.push_back(LI.AllocateLoop());
+      if(Loop* Parent = Outer->getParentLoop()) Parent->replaceChildLoopWith(Outer, Tiles[0]);
+      else LI.changeTopLevelLoop(Outer, Tiles[0]);
+      for(unsigned K = 1; K < N; K++) Tiles[K - 1]->addChildLoop(Tiles[K]);
+      Tiles[N - 1]->addChildLoop(Outer);
+      for(unsigned K = 0; K < N; K++) {
+        Tiles[K]->addBasicBlockToLoop(Headers[K], LI);
+        if(K + 1 < N) Tiles[K]->addBasicBlockToLoop(PreHeads[K + 1], LI);
+      }
+      Tiles[N - 1]->addBasicBlockToLoop(Body, LI);
+      for(unsigned K = 0; K < N; K++) Tiles[K]->addBasicBlockToLoop(Latches[K], LI);
+      for(BasicBlock* BB : Outer->blocks()) {
+        for(Loop* T : Tiles) T->addBlockEntry(BB);
+      }
+
+      DT.recalculate(*F);
+      PDT.recalculate(*F);
+    }
+
+    PreservedAnalyses run(Function &F, FunctionAnalysisManager &AM)
+    {
+      LoopInfo &LI = AM.getResult<LoopAnalysis>(F);
+      DominatorTree &DT = AM.getResult<DominatorTreeAnalysis>(F);
+      PostDominatorTree &PDT = AM.getResult<PostDominatorTreeAnalysis>(F);
+      ScalarEvolution &SE = AM.getResult<ScalarEvolutionAnalysis>(F);
+      DependenceInfo &DI = AM.getResult<DependenceAnalysis>(F);
+      TargetTransformInfo &TTI = AM.getResult<TargetIRAnalysis>(F);
+      OptimizationRemarkEmitter &ORE = AM.getResult<OptimizationRemarkEmitterAnalysis>(F);
+      unsigned LineSize = TTI.getCacheLineSize() ? TTI.getCacheLineSize() : 64;
+
+      // Si parte dai nidi più esterni: un nido già diviso non viene rivisitato
+      SmallVector<Loop*, 8> Worklist(LI.begin(), LI.end());
+      unsigned NumTiled = 0;
+      while(!Worklist.empty()) {
+        Loop* Outer = Worklist.pop_back_val();
+        SmallVector<Loop*, 4> Nest;
+        SmallVector<LoopControl, 4> Controls;
+        if(!collectTilableNest(Outer, SE, Nest, Controls)) {
+          for(Loop* Sub : Outer->getSubLoops()) Worklist.push_back(Sub);
+          continue;
+        }
+        LLVM_DEBUG(dbgs() << "Analizzo un nido perfetto di " << Nest.size() << " loop\n");
+
+        // Il lato più grande (potenza di 2) con il working set nella cache
+        uint64_t Tile = MaxTile, Footprint = 0;
+        bool Reuse = false;
+        for(; Tile >= 4; Tile /= 2) {
+          SmallVector<uint64_t, 4> Extents(Nest.size(), Tile);
+          Footprint = getFootprint(Nest, Extents, LineSize, SE, Reuse);
+          if(Footprint <= TilingCacheSize) break;
+        }
+        // Dati toccati da un'iterazione del loop esterno (i loop interni
+        // completi): se stanno nella cache, l'iterazione successiva li
+        // ritrova senza bisogno di tile
+        SmallVector<uint64_t, 4> Extents(1, 1);
+        for(unsigned K = 1; K < Nest.size(); K++) {
+          const SCEVConstant* BTC = dyn_cast<SCEVConstant>(SE.getConstantMaxBackedgeTakenCount(Nest[K]));
+          Extents.push_back(BTC ? BTC->getAPInt().getLimitedValue() : UINT64_MAX);
+        }
+        bool Ignored;
+        uint64_t Distance = getFootprint(Nest, Extents, LineSize, SE, Ignored);
+        LLVM_DEBUG(dbgs() << "Lato della tile: " << Tile << ", working set: " << Footprint
+                          << " byte, un'iterazione esterna: " << Distance << " byte\n");
+        auto AddModel = [&](auto R) {
+          return R << "tile size " << ore::NV("TileSize", Tile) << ", working set "
+                   << ore::NV("Footprint", Footprint) << " bytes, cache "
+                   << ore::NV("CacheSize", TilingCacheSize.getValue()) << " bytes";
+        };
+        const char* Missed = nullptr;
+        if(Tile < 4) Missed = "the working set of the smallest tile does not fit in the cache";
+        else if(!Reuse) Missed = "no data reused across outer iterations";
+        else if(Distance <= TilingCacheSize) Missed = "the data of one outer iteration already fits in the cache";
+        else if(!isTilingLegal(Nest, DI, SE)) Missed = "a dependence would be reversed";
+        if(Missed) {
+          LLVM_DEBUG(dbgs() << "Tiling non applicato: " << Missed << "\n");
+          ORE.emit([&]() {
+            return AddModel(OptimizationRemarkMissed("loop-tiling1", "NotTiled", Outer->getStartLoc(),
+                                                     Outer->getHeader())
+                            << "loops not tiled, " << Missed << ": ");
+          });
+          continue;
+        }
+
+        tileNest(Nest, Controls, Tile, DT, PDT, LI, SE);
+        ORE.emit([&]() {
+          return AddModel(OptimizationRemark("loop-tiling1", "Tiled", Outer->getStartLoc(), Outer->getHeader())
+                          << "loops tiled: ");
+        });
+        LLVM_DEBUG(dbgs() << "Nido diviso in tile\n");
+        NumTiled++;
+      }
+      outs() << "Nidi divisi in tile nella funzione " << F.getName() << ": " << NumTiled << "\n";
+      if(NumTiled == 0) return PreservedAnalyses::all();
+
+      PreservedAnalyses PA;
+      PA.preserve<DominatorTreeAnalysis>();
+      PA.preserve<PostDominatorTreeAnalysis>();
+      PA.preserve<LoopAnalysis>();
+      return PA;
+    }
+
+    static bool isRequired() { return true; }
+  };
 } // namespace
 
 //-----------------------------------------------------------------------------
 // New PM Registration - Registrazione nel sistema di Pass di LLVM
 //-----------------------------------------------------------------------------
-llvm::PassPluginLibraryInfo getTestPassPluginInfo()
+// static: con più plugin caricati nello stesso opt, un simbolo globale con
+// lo stesso nome verrebbe risolto nel primo plugin caricato
+static llvm::PassPluginLibraryInfo getTestPassPluginInfo()
 {
   return {LLVM_PLUGIN_API_VERSION, "LoopFusion1", LLVM_VERSION_STRING,
           [](PassBuilder &PB)
@@ -518,6 +2632,21 @@ llvm::PassPluginLibraryInfo getTestPassPluginInfo()
                     FPM.addPass(LoopFusion1()); // Aggiunge il nostro pass alla pipeline
                     return true;
                   }
+                  else if (Name == "loop-distribution1")
+                  {
+                    FPM.addPass(LoopDistribution1());
+                    return true;
+                  }
+                  else if (Name == "loop-interchange1")
+                  {
+                    FPM.addPass(LoopInterchange1());
+                    return true;
+                  }
+                  else if (Name == "loop-tiling1")
+                  {
+                    FPM.addPass(LoopTiling1());
+                    return true;
+                  }
                   return false;
                 });
           }};
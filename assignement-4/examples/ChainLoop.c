@@ -0,0 +1,35 @@
+// Catena di cinque loop adiacenti con lo stesso numero di iterazioni: ogni
+// fusione produce un loop che viene subito riprovato con il suo nuovo
+// vicino, quindi una sola esecuzione di LoopFusion1 li fonde tutti.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm ChainLoop.c -o ChainLoop.ll
+//	opt -passes=mem2reg -S ChainLoop.ll -o ChainLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -S ChainLoop.m2r.ll -o ChainLoopOpt.m2r.ll
+
+#define N 1000
+
+int A[N], B[N], C[N], D[N], E[N];
+
+int chain(void) {
+  for (int i = 0; i < N; i++) {
+    A[i] = i;
+  }
+  for (int i = 0; i < N; i++) {
+    B[i] = A[i] + 1;
+  }
+  for (int i = 0; i < N; i++) {
+    C[i] = B[i] * 2;
+  }
+  for (int i = 0; i < N; i++) {
+    D[i] = C[i] - A[i];
+  }
+  for (int i = 0; i < N; i++) {
+    E[i] = D[i] + B[i];
+  }
+  return E[N - 1];
+}
+
+int main() {
+  return chain() & 0xff;
+}
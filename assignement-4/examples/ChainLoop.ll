@@ -0,0 +1,181 @@
+; ModuleID = 'ChainLoop.c'
+source_filename = "ChainLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chain() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %6
+
+6:                                                ; preds = %14, %0
+  %7 = load i32, ptr %1, align 4
+  %8 = icmp slt i32 %7, 1000
+  br i1 %8, label %9, label %17
+
+9:                                                ; preds = %6
+  %10 = load i32, ptr %1, align 4
+  %11 = load i32, ptr %1, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %12
+  store i32 %10, ptr %13, align 4
+  br label %14
+
+14:                                               ; preds = %9
+  %15 = load i32, ptr %1, align 4
+  %16 = add nsw i32 %15, 1
+  store i32 %16, ptr %1, align 4
+  br label %6
+
+17:                                               ; preds = %6
+  store i32 0, ptr %2, align 4
+  br label %18
+
+18:                                               ; preds = %30, %17
+  %19 = load i32, ptr %2, align 4
+  %20 = icmp slt i32 %19, 1000
+  br i1 %20, label %21, label %33
+
+21:                                               ; preds = %18
+  %22 = load i32, ptr %2, align 4
+  %23 = sext i32 %22 to i64
+  %24 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %23
+  %25 = load i32, ptr %24, align 4
+  %26 = add nsw i32 %25, 1
+  %27 = load i32, ptr %2, align 4
+  %28 = sext i32 %27 to i64
+  %29 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %28
+  store i32 %26, ptr %29, align 4
+  br label %30
+
+30:                                               ; preds = %21
+  %31 = load i32, ptr %2, align 4
+  %32 = add nsw i32 %31, 1
+  store i32 %32, ptr %2, align 4
+  br label %18
+
+33:                                               ; preds = %18
+  store i32 0, ptr %3, align 4
+  br label %34
+
+34:                                               ; preds = %46, %33
+  %35 = load i32, ptr %3, align 4
+  %36 = icmp slt i32 %35, 1000
+  br i1 %36, label %37, label %49
+
+37:                                               ; preds = %34
+  %38 = load i32, ptr %3, align 4
+  %39 = sext i32 %38 to i64
+  %40 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %39
+  %41 = load i32, ptr %40, align 4
+  %42 = mul nsw i32 %41, 2
+  %43 = load i32, ptr %3, align 4
+  %44 = sext i32 %43 to i64
+  %45 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %44
+  store i32 %42, ptr %45, align 4
+  br label %46
+
+46:                                               ; preds = %37
+  %47 = load i32, ptr %3, align 4
+  %48 = add nsw i32 %47, 1
+  store i32 %48, ptr %3, align 4
+  br label %34
+
+49:                                               ; preds = %34
+  store i32 0, ptr %4, align 4
+  br label %50
+
+50:                                               ; preds = %66, %49
+  %51 = load i32, ptr %4, align 4
+  %52 = icmp slt i32 %51, 1000
+  br i1 %52, label %53, label %69
+
+53:                                               ; preds = %50
+  %54 = load i32, ptr %4, align 4
+  %55 = sext i32 %54 to i64
+  %56 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %55
+  %57 = load i32, ptr %56, align 4
+  %58 = load i32, ptr %4, align 4
+  %59 = sext i32 %58 to i64
+  %60 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %59
+  %61 = load i32, ptr %60, align 4
+  %62 = sub nsw i32 %57, %61
+  %63 = load i32, ptr %4, align 4
+  %64 = sext i32 %63 to i64
+  %65 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %64
+  store i32 %62, ptr %65, align 4
+  br label %66
+
+66:                                               ; preds = %53
+  %67 = load i32, ptr %4, align 4
+  %68 = add nsw i32 %67, 1
+  store i32 %68, ptr %4, align 4
+  br label %50
+
+69:                                               ; preds = %50
+  store i32 0, ptr %5, align 4
+  br label %70
+
+70:                                               ; preds = %86, %69
+  %71 = load i32, ptr %5, align 4
+  %72 = icmp slt i32 %71, 1000
+  br i1 %72, label %73, label %89
+
+73:                                               ; preds = %70
+  %74 = load i32, ptr %5, align 4
+  %75 = sext i32 %74 to i64
+  %76 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %75
+  %77 = load i32, ptr %76, align 4
+  %78 = load i32, ptr %5, align 4
+  %79 = sext i32 %78 to i64
+  %80 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %79
+  %81 = load i32, ptr %80, align 4
+  %82 = add nsw i32 %77, %81
+  %83 = load i32, ptr %5, align 4
+  %84 = sext i32 %83 to i64
+  %85 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %84
+  store i32 %82, ptr %85, align 4
+  br label %86
+
+86:                                               ; preds = %73
+  %87 = load i32, ptr %5, align 4
+  %88 = add nsw i32 %87, 1
+  store i32 %88, ptr %5, align 4
+  br label %70
+
+89:                                               ; preds = %70
+  %90 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  ret i32 %90
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  %2 = call i32 @chain()
+  %3 = and i32 %2, 255
+  ret i32 %3
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,147 @@
+; ModuleID = 'ChainLoop.ll'
+source_filename = "ChainLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chain() #0 {
+  br label %1
+
+1:                                                ; preds = %6, %0
+  %.0 = phi i32 [ 0, %0 ], [ %7, %6 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %8
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  br label %6
+
+6:                                                ; preds = %3
+  %7 = add nsw i32 %.0, 1
+  br label %1
+
+8:                                                ; preds = %1
+  br label %9
+
+9:                                                ; preds = %18, %8
+  %.01 = phi i32 [ 0, %8 ], [ %19, %18 ]
+  %10 = icmp slt i32 %.01, 1000
+  br i1 %10, label %11, label %20
+
+11:                                               ; preds = %9
+  %12 = sext i32 %.01 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = add nsw i32 %14, 1
+  %16 = sext i32 %.01 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %16
+  store i32 %15, ptr %17, align 4
+  br label %18
+
+18:                                               ; preds = %11
+  %19 = add nsw i32 %.01, 1
+  br label %9
+
+20:                                               ; preds = %9
+  br label %21
+
+21:                                               ; preds = %30, %20
+  %.02 = phi i32 [ 0, %20 ], [ %31, %30 ]
+  %22 = icmp slt i32 %.02, 1000
+  br i1 %22, label %23, label %32
+
+23:                                               ; preds = %21
+  %24 = sext i32 %.02 to i64
+  %25 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = mul nsw i32 %26, 2
+  %28 = sext i32 %.02 to i64
+  %29 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %28
+  store i32 %27, ptr %29, align 4
+  br label %30
+
+30:                                               ; preds = %23
+  %31 = add nsw i32 %.02, 1
+  br label %21
+
+32:                                               ; preds = %21
+  br label %33
+
+33:                                               ; preds = %45, %32
+  %.03 = phi i32 [ 0, %32 ], [ %46, %45 ]
+  %34 = icmp slt i32 %.03, 1000
+  br i1 %34, label %35, label %47
+
+35:                                               ; preds = %33
+  %36 = sext i32 %.03 to i64
+  %37 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %36
+  %38 = load i32, ptr %37, align 4
+  %39 = sext i32 %.03 to i64
+  %40 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %39
+  %41 = load i32, ptr %40, align 4
+  %42 = sub nsw i32 %38, %41
+  %43 = sext i32 %.03 to i64
+  %44 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %43
+  store i32 %42, ptr %44, align 4
+  br label %45
+
+45:                                               ; preds = %35
+  %46 = add nsw i32 %.03, 1
+  br label %33
+
+47:                                               ; preds = %33
+  br label %48
+
+48:                                               ; preds = %60, %47
+  %.04 = phi i32 [ 0, %47 ], [ %61, %60 ]
+  %49 = icmp slt i32 %.04, 1000
+  br i1 %49, label %50, label %62
+
+50:                                               ; preds = %48
+  %51 = sext i32 %.04 to i64
+  %52 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %51
+  %53 = load i32, ptr %52, align 4
+  %54 = sext i32 %.04 to i64
+  %55 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %54
+  %56 = load i32, ptr %55, align 4
+  %57 = add nsw i32 %53, %56
+  %58 = sext i32 %.04 to i64
+  %59 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %58
+  store i32 %57, ptr %59, align 4
+  br label %60
+
+60:                                               ; preds = %50
+  %61 = add nsw i32 %.04, 1
+  br label %48
+
+62:                                               ; preds = %48
+  %63 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  ret i32 %63
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @chain()
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
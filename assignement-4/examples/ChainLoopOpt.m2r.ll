@@ -0,0 +1,87 @@
+; ModuleID = 'ChainLoop.m2r.ll'
+source_filename = "ChainLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chain() #0 {
+  br label %1
+
+1:                                                ; preds = %36, %0
+  %.0 = phi i32 [ 0, %0 ], [ %37, %36 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %38
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  %6 = sext i32 %.0 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = add nsw i32 %8, 1
+  %10 = sext i32 %.0 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %10
+  store i32 %9, ptr %11, align 4
+  %12 = sext i32 %.0 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = mul nsw i32 %14, 2
+  %16 = sext i32 %.0 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %16
+  store i32 %15, ptr %17, align 4
+  %18 = sext i32 %.0 to i64
+  %19 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %18
+  %20 = load i32, ptr %19, align 4
+  %21 = sext i32 %.0 to i64
+  %22 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = sub nsw i32 %20, %23
+  %25 = sext i32 %.0 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %25
+  store i32 %24, ptr %26, align 4
+  %27 = sext i32 %.0 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %27
+  %29 = load i32, ptr %28, align 4
+  %30 = sext i32 %.0 to i64
+  %31 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %30
+  %32 = load i32, ptr %31, align 4
+  %33 = add nsw i32 %29, %32
+  %34 = sext i32 %.0 to i64
+  %35 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %34
+  store i32 %33, ptr %35, align 4
+  br label %36
+
+36:                                               ; preds = %3
+  %37 = add nsw i32 %.0, 1
+  br label %1
+
+38:                                               ; preds = %1
+  %39 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  ret i32 %39
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @chain()
+  %2 = and i32 %1, 255
+  ret i32 %2
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
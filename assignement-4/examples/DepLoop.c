@@ -0,0 +1,80 @@
+// Controllo delle dipendenze con DependenceInfo: per ogni coppia di accessi
+// in memoria dei due loop, di cui almeno uno scrive, si chiede se toccano la
+// stessa locazione e, in caso, se nel loop fuso l'ordine resterebbe quello
+// originale.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm DepLoop.c -o DepLoop.ll
+//	opt -passes=mem2reg -S DepLoop.ll -o DepLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -S DepLoop.m2r.ll -o DepLoopOpt.m2r.ll
+
+#define N 64
+
+int M[N][N], T[N][N];
+int V[N + 1];
+int W[N + 1];
+
+// Loop interni fratelli: il secondo legge M[i][j] scritto dal primo alla
+// stessa iterazione (RAW). La dipendenza ha direzione '=' sul loop esterno
+// e distanza 0 tra i loop interni, che vengono fusi
+void rows(void) {
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      M[i][j] = i + j;
+    }
+    for (int j = 0; j < N; j++) {
+      T[i][j] = M[i][j] * 3;
+    }
+  }
+}
+
+// Il secondo loop rilegge e riscrive gli elementi scritti dal primo alla
+// stessa iterazione (RAW e WAW): nel loop fuso la scrittura di L2 segue
+// ancora quella di L1 e i loop vengono fusi
+void twice(int *p) {
+  for (int i = 0; i < N; i++) {
+    p[i] = i;
+  }
+  for (int i = 0; i < N; i++) {
+    p[i] = p[i] * 2 + 1;
+  }
+}
+
+// q punta all'elemento successivo di p: il secondo loop scrive p[i + 1],
+// che il primo legge all'iterazione i + 1 (WAR). Le GEP hanno basi diverse
+// ma gli indirizzi si sovrappongono: la fusione viene rifiutata
+int shifted(int *p) {
+  int *q = p + 1;
+  int s = 0;
+  for (int i = 0; i < N; i++) {
+    s += p[i];
+  }
+  for (int i = 0; i < N; i++) {
+    q[i] = i;
+  }
+  return s;
+}
+
+// Il primo loop scrive interi da 4 byte, il secondo legge 8 byte a partire
+// dallo stesso indirizzo: la differenza tra gli indirizzi è 0, ma la lettura
+// all'iterazione i copre anche p[i + 1], che nel loop fuso non sarebbe ancora
+// stato scritto. Conta anche la dimensione degli accessi e la fusione viene
+// rifiutata
+long long widen(int *p) {
+  long long s = 0;
+  for (int i = 0; i < N; i++) {
+    p[i] = i;
+  }
+  for (int i = 0; i < N; i++) {
+    s += *(long long *)&p[i];
+  }
+  return s;
+}
+
+int main() {
+  rows();
+  twice(V);
+  int s = shifted(V);
+  long long w = widen(W);
+  return (s + T[N - 1][N - 2] + V[N] + (int)(w % 251)) % 251;
+}
@@ -0,0 +1,324 @@
+; ModuleID = 'DepLoop.c'
+source_filename = "DepLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@M = dso_local global [64 x [64 x i32]] zeroinitializer, align 16
+@T = dso_local global [64 x [64 x i32]] zeroinitializer, align 16
+@V = dso_local global [65 x i32] zeroinitializer, align 16
+@W = dso_local global [65 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @rows() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %4
+
+4:                                                ; preds = %47, %0
+  %5 = load i32, ptr %1, align 4
+  %6 = icmp slt i32 %5, 64
+  br i1 %6, label %7, label %50
+
+7:                                                ; preds = %4
+  store i32 0, ptr %2, align 4
+  br label %8
+
+8:                                                ; preds = %21, %7
+  %9 = load i32, ptr %2, align 4
+  %10 = icmp slt i32 %9, 64
+  br i1 %10, label %11, label %24
+
+11:                                               ; preds = %8
+  %12 = load i32, ptr %1, align 4
+  %13 = load i32, ptr %2, align 4
+  %14 = add nsw i32 %12, %13
+  %15 = load i32, ptr %1, align 4
+  %16 = sext i32 %15 to i64
+  %17 = getelementptr inbounds [64 x [64 x i32]], ptr @M, i64 0, i64 %16
+  %18 = load i32, ptr %2, align 4
+  %19 = sext i32 %18 to i64
+  %20 = getelementptr inbounds [64 x i32], ptr %17, i64 0, i64 %19
+  store i32 %14, ptr %20, align 4
+  br label %21
+
+21:                                               ; preds = %11
+  %22 = load i32, ptr %2, align 4
+  %23 = add nsw i32 %22, 1
+  store i32 %23, ptr %2, align 4
+  br label %8
+
+24:                                               ; preds = %8
+  store i32 0, ptr %3, align 4
+  br label %25
+
+25:                                               ; preds = %43, %24
+  %26 = load i32, ptr %3, align 4
+  %27 = icmp slt i32 %26, 64
+  br i1 %27, label %28, label %46
+
+28:                                               ; preds = %25
+  %29 = load i32, ptr %1, align 4
+  %30 = sext i32 %29 to i64
+  %31 = getelementptr inbounds [64 x [64 x i32]], ptr @M, i64 0, i64 %30
+  %32 = load i32, ptr %3, align 4
+  %33 = sext i32 %32 to i64
+  %34 = getelementptr inbounds [64 x i32], ptr %31, i64 0, i64 %33
+  %35 = load i32, ptr %34, align 4
+  %36 = mul nsw i32 %35, 3
+  %37 = load i32, ptr %1, align 4
+  %38 = sext i32 %37 to i64
+  %39 = getelementptr inbounds [64 x [64 x i32]], ptr @T, i64 0, i64 %38
+  %40 = load i32, ptr %3, align 4
+  %41 = sext i32 %40 to i64
+  %42 = getelementptr inbounds [64 x i32], ptr %39, i64 0, i64 %41
+  store i32 %36, ptr %42, align 4
+  br label %43
+
+43:                                               ; preds = %28
+  %44 = load i32, ptr %3, align 4
+  %45 = add nsw i32 %44, 1
+  store i32 %45, ptr %3, align 4
+  br label %25
+
+46:                                               ; preds = %25
+  br label %47
+
+47:                                               ; preds = %46
+  %48 = load i32, ptr %1, align 4
+  %49 = add nsw i32 %48, 1
+  store i32 %49, ptr %1, align 4
+  br label %4
+
+50:                                               ; preds = %4
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @twice(ptr noundef %0) #0 {
+  %2 = alloca ptr, align 8
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store ptr %0, ptr %2, align 8
+  store i32 0, ptr %3, align 4
+  br label %5
+
+5:                                                ; preds = %14, %1
+  %6 = load i32, ptr %3, align 4
+  %7 = icmp slt i32 %6, 64
+  br i1 %7, label %8, label %17
+
+8:                                                ; preds = %5
+  %9 = load i32, ptr %3, align 4
+  %10 = load ptr, ptr %2, align 8
+  %11 = load i32, ptr %3, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds i32, ptr %10, i64 %12
+  store i32 %9, ptr %13, align 4
+  br label %14
+
+14:                                               ; preds = %8
+  %15 = load i32, ptr %3, align 4
+  %16 = add nsw i32 %15, 1
+  store i32 %16, ptr %3, align 4
+  br label %5
+
+17:                                               ; preds = %5
+  store i32 0, ptr %4, align 4
+  br label %18
+
+18:                                               ; preds = %33, %17
+  %19 = load i32, ptr %4, align 4
+  %20 = icmp slt i32 %19, 64
+  br i1 %20, label %21, label %36
+
+21:                                               ; preds = %18
+  %22 = load ptr, ptr %2, align 8
+  %23 = load i32, ptr %4, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds i32, ptr %22, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = mul nsw i32 %26, 2
+  %28 = add nsw i32 %27, 1
+  %29 = load ptr, ptr %2, align 8
+  %30 = load i32, ptr %4, align 4
+  %31 = sext i32 %30 to i64
+  %32 = getelementptr inbounds i32, ptr %29, i64 %31
+  store i32 %28, ptr %32, align 4
+  br label %33
+
+33:                                               ; preds = %21
+  %34 = load i32, ptr %4, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %4, align 4
+  br label %18
+
+36:                                               ; preds = %18
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @shifted(ptr noundef %0) #0 {
+  %2 = alloca ptr, align 8
+  %3 = alloca ptr, align 8
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  %6 = alloca i32, align 4
+  store ptr %0, ptr %2, align 8
+  %7 = load ptr, ptr %2, align 8
+  %8 = getelementptr inbounds i32, ptr %7, i64 1
+  store ptr %8, ptr %3, align 8
+  store i32 0, ptr %4, align 4
+  store i32 0, ptr %5, align 4
+  br label %9
+
+9:                                                ; preds = %20, %1
+  %10 = load i32, ptr %5, align 4
+  %11 = icmp slt i32 %10, 64
+  br i1 %11, label %12, label %23
+
+12:                                               ; preds = %9
+  %13 = load ptr, ptr %2, align 8
+  %14 = load i32, ptr %5, align 4
+  %15 = sext i32 %14 to i64
+  %16 = getelementptr inbounds i32, ptr %13, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = load i32, ptr %4, align 4
+  %19 = add nsw i32 %18, %17
+  store i32 %19, ptr %4, align 4
+  br label %20
+
+20:                                               ; preds = %12
+  %21 = load i32, ptr %5, align 4
+  %22 = add nsw i32 %21, 1
+  store i32 %22, ptr %5, align 4
+  br label %9
+
+23:                                               ; preds = %9
+  store i32 0, ptr %6, align 4
+  br label %24
+
+24:                                               ; preds = %33, %23
+  %25 = load i32, ptr %6, align 4
+  %26 = icmp slt i32 %25, 64
+  br i1 %26, label %27, label %36
+
+27:                                               ; preds = %24
+  %28 = load i32, ptr %6, align 4
+  %29 = load ptr, ptr %3, align 8
+  %30 = load i32, ptr %6, align 4
+  %31 = sext i32 %30 to i64
+  %32 = getelementptr inbounds i32, ptr %29, i64 %31
+  store i32 %28, ptr %32, align 4
+  br label %33
+
+33:                                               ; preds = %27
+  %34 = load i32, ptr %6, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %6, align 4
+  br label %24
+
+36:                                               ; preds = %24
+  %37 = load i32, ptr %4, align 4
+  ret i32 %37
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i64 @widen(ptr noundef %0) #0 {
+  %2 = alloca ptr, align 8
+  %3 = alloca i64, align 8
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  store ptr %0, ptr %2, align 8
+  store i64 0, ptr %3, align 8
+  store i32 0, ptr %4, align 4
+  br label %6
+
+6:                                                ; preds = %15, %1
+  %7 = load i32, ptr %4, align 4
+  %8 = icmp slt i32 %7, 64
+  br i1 %8, label %9, label %18
+
+9:                                                ; preds = %6
+  %10 = load i32, ptr %4, align 4
+  %11 = load ptr, ptr %2, align 8
+  %12 = load i32, ptr %4, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds i32, ptr %11, i64 %13
+  store i32 %10, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %9
+  %16 = load i32, ptr %4, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %4, align 4
+  br label %6
+
+18:                                               ; preds = %6
+  store i32 0, ptr %5, align 4
+  br label %19
+
+19:                                               ; preds = %30, %18
+  %20 = load i32, ptr %5, align 4
+  %21 = icmp slt i32 %20, 64
+  br i1 %21, label %22, label %33
+
+22:                                               ; preds = %19
+  %23 = load ptr, ptr %2, align 8
+  %24 = load i32, ptr %5, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds i32, ptr %23, i64 %25
+  %27 = load i64, ptr %26, align 8
+  %28 = load i64, ptr %3, align 8
+  %29 = add nsw i64 %28, %27
+  store i64 %29, ptr %3, align 8
+  br label %30
+
+30:                                               ; preds = %22
+  %31 = load i32, ptr %5, align 4
+  %32 = add nsw i32 %31, 1
+  store i32 %32, ptr %5, align 4
+  br label %19
+
+33:                                               ; preds = %19
+  %34 = load i64, ptr %3, align 8
+  ret i64 %34
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i64, align 8
+  store i32 0, ptr %1, align 4
+  call void @rows()
+  call void @twice(ptr noundef @V)
+  %4 = call i32 @shifted(ptr noundef @V)
+  store i32 %4, ptr %2, align 4
+  %5 = call i64 @widen(ptr noundef @W)
+  store i64 %5, ptr %3, align 8
+  %6 = load i32, ptr %2, align 4
+  %7 = load i32, ptr getelementptr inbounds ([64 x [64 x i32]], ptr @T, i64 0, i64 63, i64 62), align 4
+  %8 = add nsw i32 %6, %7
+  %9 = load i32, ptr getelementptr inbounds ([65 x i32], ptr @V, i64 0, i64 64), align 16
+  %10 = add nsw i32 %8, %9
+  %11 = load i64, ptr %3, align 8
+  %12 = srem i64 %11, 251
+  %13 = trunc i64 %12 to i32
+  %14 = add nsw i32 %10, %13
+  %15 = srem i32 %14, 251
+  ret i32 %15
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
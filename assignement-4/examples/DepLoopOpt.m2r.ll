@@ -0,0 +1,208 @@
+; ModuleID = 'DepLoop.m2r.ll'
+source_filename = "DepLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@M = dso_local global [64 x [64 x i32]] zeroinitializer, align 16
+@T = dso_local global [64 x [64 x i32]] zeroinitializer, align 16
+@V = dso_local global [65 x i32] zeroinitializer, align 16
+@W = dso_local global [65 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @rows() #0 {
+  br label %1
+
+1:                                                ; preds = %25, %0
+  %.0 = phi i32 [ 0, %0 ], [ %26, %25 ]
+  %2 = icmp slt i32 %.0, 64
+  br i1 %2, label %3, label %27
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %22, %3
+  %.01 = phi i32 [ 0, %3 ], [ %23, %22 ]
+  %5 = icmp slt i32 %.01, 64
+  br i1 %5, label %6, label %24
+
+6:                                                ; preds = %4
+  %7 = add nsw i32 %.0, %.01
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [64 x [64 x i32]], ptr @M, i64 0, i64 %8
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [64 x i32], ptr %9, i64 0, i64 %10
+  store i32 %7, ptr %11, align 4
+  %12 = sext i32 %.0 to i64
+  %13 = getelementptr inbounds [64 x [64 x i32]], ptr @M, i64 0, i64 %12
+  %14 = sext i32 %.01 to i64
+  %15 = getelementptr inbounds [64 x i32], ptr %13, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = mul nsw i32 %16, 3
+  %18 = sext i32 %.0 to i64
+  %19 = getelementptr inbounds [64 x [64 x i32]], ptr @T, i64 0, i64 %18
+  %20 = sext i32 %.01 to i64
+  %21 = getelementptr inbounds [64 x i32], ptr %19, i64 0, i64 %20
+  store i32 %17, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %6
+  %23 = add nsw i32 %.01, 1
+  br label %4
+
+24:                                               ; preds = %4
+  br label %25
+
+25:                                               ; preds = %24
+  %26 = add nsw i32 %.0, 1
+  br label %1
+
+27:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @twice(ptr noundef %0) #0 {
+  br label %2
+
+2:                                                ; preds = %14, %1
+  %.01 = phi i32 [ 0, %1 ], [ %15, %14 ]
+  %3 = icmp slt i32 %.01, 64
+  br i1 %3, label %4, label %16
+
+4:                                                ; preds = %2
+  %5 = sext i32 %.01 to i64
+  %6 = getelementptr inbounds i32, ptr %0, i64 %5
+  store i32 %.01, ptr %6, align 4
+  %7 = sext i32 %.01 to i64
+  %8 = getelementptr inbounds i32, ptr %0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = mul nsw i32 %9, 2
+  %11 = add nsw i32 %10, 1
+  %12 = sext i32 %.01 to i64
+  %13 = getelementptr inbounds i32, ptr %0, i64 %12
+  store i32 %11, ptr %13, align 4
+  br label %14
+
+14:                                               ; preds = %4
+  %15 = add nsw i32 %.01, 1
+  br label %2
+
+16:                                               ; preds = %2
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @shifted(ptr noundef %0) #0 {
+  %2 = getelementptr inbounds i32, ptr %0, i64 1
+  br label %3
+
+3:                                                ; preds = %10, %1
+  %.02 = phi i32 [ 0, %1 ], [ %9, %10 ]
+  %.01 = phi i32 [ 0, %1 ], [ %11, %10 ]
+  %4 = icmp slt i32 %.01, 64
+  br i1 %4, label %5, label %12
+
+5:                                                ; preds = %3
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds i32, ptr %0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = add nsw i32 %.02, %8
+  br label %10
+
+10:                                               ; preds = %5
+  %11 = add nsw i32 %.01, 1
+  br label %3
+
+12:                                               ; preds = %3
+  br label %13
+
+13:                                               ; preds = %18, %12
+  %.0 = phi i32 [ 0, %12 ], [ %19, %18 ]
+  %14 = icmp slt i32 %.0, 64
+  br i1 %14, label %15, label %20
+
+15:                                               ; preds = %13
+  %16 = sext i32 %.0 to i64
+  %17 = getelementptr inbounds i32, ptr %2, i64 %16
+  store i32 %.0, ptr %17, align 4
+  br label %18
+
+18:                                               ; preds = %15
+  %19 = add nsw i32 %.0, 1
+  br label %13
+
+20:                                               ; preds = %13
+  ret i32 %.02
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i64 @widen(ptr noundef %0) #0 {
+  br label %2
+
+2:                                                ; preds = %7, %1
+  %.02 = phi i32 [ 0, %1 ], [ %8, %7 ]
+  %3 = icmp slt i32 %.02, 64
+  br i1 %3, label %4, label %9
+
+4:                                                ; preds = %2
+  %5 = sext i32 %.02 to i64
+  %6 = getelementptr inbounds i32, ptr %0, i64 %5
+  store i32 %.02, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %4
+  %8 = add nsw i32 %.02, 1
+  br label %2
+
+9:                                                ; preds = %2
+  br label %10
+
+10:                                               ; preds = %17, %9
+  %.01 = phi i64 [ 0, %9 ], [ %16, %17 ]
+  %.0 = phi i32 [ 0, %9 ], [ %18, %17 ]
+  %11 = icmp slt i32 %.0, 64
+  br i1 %11, label %12, label %19
+
+12:                                               ; preds = %10
+  %13 = sext i32 %.0 to i64
+  %14 = getelementptr inbounds i32, ptr %0, i64 %13
+  %15 = load i64, ptr %14, align 8
+  %16 = add nsw i64 %.01, %15
+  br label %17
+
+17:                                               ; preds = %12
+  %18 = add nsw i32 %.0, 1
+  br label %10
+
+19:                                               ; preds = %10
+  ret i64 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  call void @rows()
+  call void @twice(ptr noundef @V)
+  %1 = call i32 @shifted(ptr noundef @V)
+  %2 = call i64 @widen(ptr noundef @W)
+  %3 = load i32, ptr getelementptr inbounds ([64 x [64 x i32]], ptr @T, i64 0, i64 63, i64 62), align 4
+  %4 = add nsw i32 %1, %3
+  %5 = load i32, ptr getelementptr inbounds ([65 x i32], ptr @V, i64 0, i64 64), align 16
+  %6 = add nsw i32 %4, %5
+  %7 = srem i64 %2, 251
+  %8 = trunc i64 %7 to i32
+  %9 = add nsw i32 %6, %8
+  %10 = srem i32 %9, 251
+  ret i32 %10
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,49 @@
+// Distribuzione di loop: il corpo viene diviso in più loop quando una
+// parte senza dipendenze tra iterazioni può essere vettorizzata da sola
+// o quando le parti non hanno dati in comune e insieme usano troppa cache.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm Distribute.c -o Distribute.ll
+//	opt -passes=mem2reg -S Distribute.ll -o Distribute.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-distribution1 \
+//	    -S Distribute.m2r.ll -o DistributeOpt.m2r.ll
+
+#define N 1000
+
+int A[N], B[N], C[N], D[N], E[N], F[N], G[N], H[N], I[N], J[N];
+
+// C[i] dipende da C[i - 1], calcolato all'iterazione precedente: la
+// ricorrenza resta in un loop a sé e il calcolo di A[i] si può vettorizzare
+void mix(void) {
+  for (int i = 1; i < N; i++) {
+    A[i] = B[i] * 3;
+    C[i] = C[i - 1] + A[i];
+  }
+}
+
+// Le due istruzioni non hanno oggetti in comune e ne usano 10 in totale,
+// più di quelli ammessi da -fusion-max-streams: vengono separate
+void split(void) {
+  for (int i = 0; i < N; i++) {
+    D[i] = B[i] + C[i] + E[i] + F[i];
+    G[i] = H[i] + I[i] + J[i] + A[i];
+  }
+}
+
+// E viene scritto e riletto alla stessa iterazione: il loop resta intero
+void keep(void) {
+  for (int i = 0; i < N; i++) {
+    E[i] = B[i] + 1;
+    F[i] = E[i] * 2;
+  }
+}
+
+int main() {
+  for (int i = 0; i < N; i++) {
+    B[i] = i;
+    H[i] = 2 * i;
+  }
+  mix();
+  split();
+  keep();
+  return (C[N - 1] + D[N - 1] + G[N - 1] + F[N - 1]) & 0xff;
+}
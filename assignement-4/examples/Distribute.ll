@@ -0,0 +1,234 @@
+; ModuleID = 'Distribute.c'
+source_filename = "Distribute.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@F = dso_local global [1000 x i32] zeroinitializer, align 16
+@G = dso_local global [1000 x i32] zeroinitializer, align 16
+@H = dso_local global [1000 x i32] zeroinitializer, align 16
+@I = dso_local global [1000 x i32] zeroinitializer, align 16
+@J = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @mix() #0 {
+  %1 = alloca i32, align 4
+  store i32 1, ptr %1, align 4
+  br label %2
+
+2:                                                ; preds = %27, %0
+  %3 = load i32, ptr %1, align 4
+  %4 = icmp slt i32 %3, 1000
+  br i1 %4, label %5, label %30
+
+5:                                                ; preds = %2
+  %6 = load i32, ptr %1, align 4
+  %7 = sext i32 %6 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = mul nsw i32 %9, 3
+  %11 = load i32, ptr %1, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %12
+  store i32 %10, ptr %13, align 4
+  %14 = load i32, ptr %1, align 4
+  %15 = sub nsw i32 %14, 1
+  %16 = sext i32 %15 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = load i32, ptr %1, align 4
+  %20 = sext i32 %19 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %20
+  %22 = load i32, ptr %21, align 4
+  %23 = add nsw i32 %18, %22
+  %24 = load i32, ptr %1, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %25
+  store i32 %23, ptr %26, align 4
+  br label %27
+
+27:                                               ; preds = %5
+  %28 = load i32, ptr %1, align 4
+  %29 = add nsw i32 %28, 1
+  store i32 %29, ptr %1, align 4
+  br label %2
+
+30:                                               ; preds = %2
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @split() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %2
+
+2:                                                ; preds = %50, %0
+  %3 = load i32, ptr %1, align 4
+  %4 = icmp slt i32 %3, 1000
+  br i1 %4, label %5, label %53
+
+5:                                                ; preds = %2
+  %6 = load i32, ptr %1, align 4
+  %7 = sext i32 %6 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = load i32, ptr %1, align 4
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %9, %13
+  %15 = load i32, ptr %1, align 4
+  %16 = sext i32 %15 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = add nsw i32 %14, %18
+  %20 = load i32, ptr %1, align 4
+  %21 = sext i32 %20 to i64
+  %22 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = add nsw i32 %19, %23
+  %25 = load i32, ptr %1, align 4
+  %26 = sext i32 %25 to i64
+  %27 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %26
+  store i32 %24, ptr %27, align 4
+  %28 = load i32, ptr %1, align 4
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %29
+  %31 = load i32, ptr %30, align 4
+  %32 = load i32, ptr %1, align 4
+  %33 = sext i32 %32 to i64
+  %34 = getelementptr inbounds [1000 x i32], ptr @I, i64 0, i64 %33
+  %35 = load i32, ptr %34, align 4
+  %36 = add nsw i32 %31, %35
+  %37 = load i32, ptr %1, align 4
+  %38 = sext i32 %37 to i64
+  %39 = getelementptr inbounds [1000 x i32], ptr @J, i64 0, i64 %38
+  %40 = load i32, ptr %39, align 4
+  %41 = add nsw i32 %36, %40
+  %42 = load i32, ptr %1, align 4
+  %43 = sext i32 %42 to i64
+  %44 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %43
+  %45 = load i32, ptr %44, align 4
+  %46 = add nsw i32 %41, %45
+  %47 = load i32, ptr %1, align 4
+  %48 = sext i32 %47 to i64
+  %49 = getelementptr inbounds [1000 x i32], ptr @G, i64 0, i64 %48
+  store i32 %46, ptr %49, align 4
+  br label %50
+
+50:                                               ; preds = %5
+  %51 = load i32, ptr %1, align 4
+  %52 = add nsw i32 %51, 1
+  store i32 %52, ptr %1, align 4
+  br label %2
+
+53:                                               ; preds = %2
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @keep() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %2
+
+2:                                                ; preds = %22, %0
+  %3 = load i32, ptr %1, align 4
+  %4 = icmp slt i32 %3, 1000
+  br i1 %4, label %5, label %25
+
+5:                                                ; preds = %2
+  %6 = load i32, ptr %1, align 4
+  %7 = sext i32 %6 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = add nsw i32 %9, 1
+  %11 = load i32, ptr %1, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %12
+  store i32 %10, ptr %13, align 4
+  %14 = load i32, ptr %1, align 4
+  %15 = sext i32 %14 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = mul nsw i32 %17, 2
+  %19 = load i32, ptr %1, align 4
+  %20 = sext i32 %19 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %20
+  store i32 %18, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %5
+  %23 = load i32, ptr %1, align 4
+  %24 = add nsw i32 %23, 1
+  store i32 %24, ptr %1, align 4
+  br label %2
+
+25:                                               ; preds = %2
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %16, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %19
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %2, align 4
+  %8 = load i32, ptr %2, align 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %9
+  store i32 %7, ptr %10, align 4
+  %11 = load i32, ptr %2, align 4
+  %12 = mul nsw i32 2, %11
+  %13 = load i32, ptr %2, align 4
+  %14 = sext i32 %13 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %14
+  store i32 %12, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %6
+  %17 = load i32, ptr %2, align 4
+  %18 = add nsw i32 %17, 1
+  store i32 %18, ptr %2, align 4
+  br label %3
+
+19:                                               ; preds = %3
+  call void @mix()
+  call void @split()
+  call void @keep()
+  %20 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %21 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @D, i64 0, i64 999), align 4
+  %22 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @G, i64 0, i64 999), align 4
+  %23 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @F, i64 0, i64 999), align 4
+  %24 = add nsw i32 %20, %21
+  %25 = add nsw i32 %24, %22
+  %26 = add nsw i32 %25, %23
+  %27 = and i32 %26, 255
+  ret i32 %27
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
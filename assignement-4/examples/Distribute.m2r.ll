@@ -0,0 +1,193 @@
+; ModuleID = 'Distribute.ll'
+source_filename = "Distribute.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@F = dso_local global [1000 x i32] zeroinitializer, align 16
+@G = dso_local global [1000 x i32] zeroinitializer, align 16
+@H = dso_local global [1000 x i32] zeroinitializer, align 16
+@I = dso_local global [1000 x i32] zeroinitializer, align 16
+@J = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @mix() #0 {
+  br label %1
+
+1:                                                ; preds = %20, %0
+  %.0 = phi i32 [ 1, %0 ], [ %21, %20 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %22
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = mul nsw i32 %6, 3
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  %10 = sub nsw i32 %.0, 1
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = sext i32 %.0 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = add nsw i32 %13, %16
+  %18 = sext i32 %.0 to i64
+  %19 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %18
+  store i32 %17, ptr %19, align 4
+  br label %20
+
+20:                                               ; preds = %3
+  %21 = add nsw i32 %.0, 1
+  br label %1
+
+22:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @split() #0 {
+  br label %1
+
+1:                                                ; preds = %38, %0
+  %.0 = phi i32 [ 0, %0 ], [ %39, %38 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %40
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = add nsw i32 %6, %9
+  %11 = sext i32 %.0 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %10, %13
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = add nsw i32 %14, %17
+  %19 = sext i32 %.0 to i64
+  %20 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %19
+  store i32 %18, ptr %20, align 4
+  %21 = sext i32 %.0 to i64
+  %22 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = sext i32 %.0 to i64
+  %25 = getelementptr inbounds [1000 x i32], ptr @I, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = add nsw i32 %23, %26
+  %28 = sext i32 %.0 to i64
+  %29 = getelementptr inbounds [1000 x i32], ptr @J, i64 0, i64 %28
+  %30 = load i32, ptr %29, align 4
+  %31 = add nsw i32 %27, %30
+  %32 = sext i32 %.0 to i64
+  %33 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %32
+  %34 = load i32, ptr %33, align 4
+  %35 = add nsw i32 %31, %34
+  %36 = sext i32 %.0 to i64
+  %37 = getelementptr inbounds [1000 x i32], ptr @G, i64 0, i64 %36
+  store i32 %35, ptr %37, align 4
+  br label %38
+
+38:                                               ; preds = %3
+  %39 = add nsw i32 %.0, 1
+  br label %1
+
+40:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @keep() #0 {
+  br label %1
+
+1:                                                ; preds = %16, %0
+  %.0 = phi i32 [ 0, %0 ], [ %17, %16 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %18
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %6, 1
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  %10 = sext i32 %.0 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = mul nsw i32 %12, 2
+  %14 = sext i32 %.0 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %14
+  store i32 %13, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %3
+  %17 = add nsw i32 %.0, 1
+  br label %1
+
+18:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %9, %0
+  %.0 = phi i32 [ 0, %0 ], [ %10, %9 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %11
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  %6 = mul nsw i32 2, %.0
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %7
+  store i32 %6, ptr %8, align 4
+  br label %9
+
+9:                                                ; preds = %3
+  %10 = add nsw i32 %.0, 1
+  br label %1
+
+11:                                               ; preds = %1
+  call void @mix()
+  call void @split()
+  call void @keep()
+  %12 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %13 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @D, i64 0, i64 999), align 4
+  %14 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @G, i64 0, i64 999), align 4
+  %15 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @F, i64 0, i64 999), align 4
+  %16 = add nsw i32 %12, %13
+  %17 = add nsw i32 %16, %14
+  %18 = add nsw i32 %17, %15
+  %19 = and i32 %18, 255
+  ret i32 %19
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,79 @@
+// Fusione di loop ruotati con guardia: un do/while dentro un if è la forma
+// che loop-rotate (-O1) dà ai for con limite noto solo a runtime.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm GuardedLoop.c -o GuardedLoop.ll
+//	opt -passes=mem2reg -S GuardedLoop.ll -o GuardedLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -pass-remarks=loop-fusion1 -pass-remarks-missed=loop-fusion1 \
+//	    -S GuardedLoop.m2r.ll -o GuardedLoopOpt.m2r.ll
+//
+// Con i for degli altri esempi: -passes="function(loop(loop-rotate)),loop-fusion1"
+
+#define N 1000
+#define REPEAT 1
+
+int A[N], B[N], C[N];
+int flag = 1;
+
+// Le guardie sono istruzioni diverse ma SCEV dà gli stessi operandi, con il
+// confronto scritto al contrario: la guardia di L1 protegge il loop fuso
+void dowhile(int n) {
+  int i = 0, j = 0;
+  if (n > 0) {
+    do {
+      A[i] = i * 2;
+      i++;
+    } while (i < n);
+  }
+  if (0 < n) {
+    do {
+      B[j] = A[j] + 1;
+      j++;
+    } while (j < n);
+  }
+}
+
+// flag viene letto due volte, ma secondo l'AliasAnalysis il primo loop
+// scrive solo in C: le due load danno lo stesso valore
+void global(int n) {
+  int i = 0, j = 0;
+  if (flag < 4) {
+    do {
+      C[i] = B[i] * 3;
+      i++;
+    } while (i < n);
+  }
+  if (flag < 4) {
+    do {
+      A[j] = C[j] - 1;
+      j++;
+    } while (j < n);
+  }
+}
+
+// Con n = 1 viene eseguito solo il primo loop: le guardie sono diverse e i
+// loop restano separati
+void different(int n) {
+  int i = 0, j = 0;
+  if (n > 0) {
+    do {
+      A[i] += 1;
+      i++;
+    } while (i < n);
+  }
+  if (n > 1) {
+    do {
+      B[j] += 1;
+      j++;
+    } while (j < n);
+  }
+}
+
+int main() {
+  for (int r = 0; r < REPEAT; r++) {
+    dowhile(N);
+    global(N);
+    different(N);
+  }
+  return (A[N - 1] + B[N - 1] + C[N - 1]) & 0xff;
+}
@@ -0,0 +1,272 @@
+; ModuleID = 'GuardedLoop.c'
+source_filename = "GuardedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@flag = dso_local global i32 1, align 4
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @dowhile(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  store i32 0, ptr %4, align 4
+  %5 = load i32, ptr %2, align 4
+  %6 = icmp sgt i32 %5, 0
+  br i1 %6, label %7, label %21
+
+7:                                                ; preds = %1
+  br label %8
+
+8:                                                ; preds = %16, %7
+  %9 = load i32, ptr %3, align 4
+  %10 = mul nsw i32 %9, 2
+  %11 = load i32, ptr %3, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %12
+  store i32 %10, ptr %13, align 4
+  %14 = load i32, ptr %3, align 4
+  %15 = add nsw i32 %14, 1
+  store i32 %15, ptr %3, align 4
+  br label %16
+
+16:                                               ; preds = %8
+  %17 = load i32, ptr %3, align 4
+  %18 = load i32, ptr %2, align 4
+  %19 = icmp slt i32 %17, %18
+  br i1 %19, label %8, label %20
+
+20:                                               ; preds = %16
+  br label %21
+
+21:                                               ; preds = %20, %1
+  %22 = load i32, ptr %2, align 4
+  %23 = icmp slt i32 0, %22
+  br i1 %23, label %24, label %41
+
+24:                                               ; preds = %21
+  br label %25
+
+25:                                               ; preds = %36, %24
+  %26 = load i32, ptr %4, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %27
+  %29 = load i32, ptr %28, align 4
+  %30 = add nsw i32 %29, 1
+  %31 = load i32, ptr %4, align 4
+  %32 = sext i32 %31 to i64
+  %33 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %32
+  store i32 %30, ptr %33, align 4
+  %34 = load i32, ptr %4, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %4, align 4
+  br label %36
+
+36:                                               ; preds = %25
+  %37 = load i32, ptr %4, align 4
+  %38 = load i32, ptr %2, align 4
+  %39 = icmp slt i32 %37, %38
+  br i1 %39, label %25, label %40
+
+40:                                               ; preds = %36
+  br label %41
+
+41:                                               ; preds = %40, %21
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @global(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  store i32 0, ptr %4, align 4
+  %5 = load i32, ptr @flag, align 4
+  %6 = icmp slt i32 %5, 4
+  br i1 %6, label %7, label %24
+
+7:                                                ; preds = %1
+  br label %8
+
+8:                                                ; preds = %19, %7
+  %9 = load i32, ptr %3, align 4
+  %10 = sext i32 %9 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = mul nsw i32 %12, 3
+  %14 = load i32, ptr %3, align 4
+  %15 = sext i32 %14 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %15
+  store i32 %13, ptr %16, align 4
+  %17 = load i32, ptr %3, align 4
+  %18 = add nsw i32 %17, 1
+  store i32 %18, ptr %3, align 4
+  br label %19
+
+19:                                               ; preds = %8
+  %20 = load i32, ptr %3, align 4
+  %21 = load i32, ptr %2, align 4
+  %22 = icmp slt i32 %20, %21
+  br i1 %22, label %8, label %23
+
+23:                                               ; preds = %19
+  br label %24
+
+24:                                               ; preds = %23, %1
+  %25 = load i32, ptr @flag, align 4
+  %26 = icmp slt i32 %25, 4
+  br i1 %26, label %27, label %44
+
+27:                                               ; preds = %24
+  br label %28
+
+28:                                               ; preds = %39, %27
+  %29 = load i32, ptr %4, align 4
+  %30 = sext i32 %29 to i64
+  %31 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %30
+  %32 = load i32, ptr %31, align 4
+  %33 = sub nsw i32 %32, 1
+  %34 = load i32, ptr %4, align 4
+  %35 = sext i32 %34 to i64
+  %36 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %35
+  store i32 %33, ptr %36, align 4
+  %37 = load i32, ptr %4, align 4
+  %38 = add nsw i32 %37, 1
+  store i32 %38, ptr %4, align 4
+  br label %39
+
+39:                                               ; preds = %28
+  %40 = load i32, ptr %4, align 4
+  %41 = load i32, ptr %2, align 4
+  %42 = icmp slt i32 %40, %41
+  br i1 %42, label %28, label %43
+
+43:                                               ; preds = %39
+  br label %44
+
+44:                                               ; preds = %43, %24
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @different(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  store i32 0, ptr %4, align 4
+  %5 = load i32, ptr %2, align 4
+  %6 = icmp sgt i32 %5, 0
+  br i1 %6, label %7, label %21
+
+7:                                                ; preds = %1
+  br label %8
+
+8:                                                ; preds = %16, %7
+  %9 = load i32, ptr %3, align 4
+  %10 = sext i32 %9 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %12, 1
+  store i32 %13, ptr %11, align 4
+  %14 = load i32, ptr %3, align 4
+  %15 = add nsw i32 %14, 1
+  store i32 %15, ptr %3, align 4
+  br label %16
+
+16:                                               ; preds = %8
+  %17 = load i32, ptr %3, align 4
+  %18 = load i32, ptr %2, align 4
+  %19 = icmp slt i32 %17, %18
+  br i1 %19, label %8, label %20
+
+20:                                               ; preds = %16
+  br label %21
+
+21:                                               ; preds = %20, %1
+  %22 = load i32, ptr %2, align 4
+  %23 = icmp sgt i32 %22, 1
+  br i1 %23, label %24, label %38
+
+24:                                               ; preds = %21
+  br label %25
+
+25:                                               ; preds = %33, %24
+  %26 = load i32, ptr %4, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %27
+  %29 = load i32, ptr %28, align 4
+  %30 = add nsw i32 %29, 1
+  store i32 %30, ptr %28, align 4
+  %31 = load i32, ptr %4, align 4
+  %32 = add nsw i32 %31, 1
+  store i32 %32, ptr %4, align 4
+  br label %33
+
+33:                                               ; preds = %25
+  %34 = load i32, ptr %4, align 4
+  %35 = load i32, ptr %2, align 4
+  %36 = icmp slt i32 %34, %35
+  br i1 %36, label %25, label %37
+
+37:                                               ; preds = %33
+  br label %38
+
+38:                                               ; preds = %37, %21
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %7, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 1
+  br i1 %5, label %6, label %10
+
+6:                                                ; preds = %3
+  call void @dowhile(i32 noundef 1000)
+  call void @global(i32 noundef 1000)
+  call void @different(i32 noundef 1000)
+  br label %7
+
+7:                                                ; preds = %6
+  %8 = load i32, ptr %2, align 4
+  %9 = add nsw i32 %8, 1
+  store i32 %9, ptr %2, align 4
+  br label %3
+
+10:                                               ; preds = %3
+  %11 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %12 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 999), align 4
+  %13 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %14 = add nsw i32 %11, %12
+  %15 = add nsw i32 %14, %13
+  %16 = and i32 %15, 255
+  ret i32 %16
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,216 @@
+; ModuleID = 'GuardedLoop.ll'
+source_filename = "GuardedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@flag = dso_local global i32 1, align 4
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @dowhile(i32 noundef %0) #0 {
+  %2 = icmp sgt i32 %0, 0
+  br i1 %2, label %3, label %12
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %9, %3
+  %.01 = phi i32 [ 0, %3 ], [ %8, %9 ]
+  %5 = mul nsw i32 %.01, 2
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %6
+  store i32 %5, ptr %7, align 4
+  %8 = add nsw i32 %.01, 1
+  br label %9
+
+9:                                                ; preds = %4
+  %10 = icmp slt i32 %8, %0
+  br i1 %10, label %4, label %11
+
+11:                                               ; preds = %9
+  br label %12
+
+12:                                               ; preds = %11, %1
+  %13 = icmp slt i32 0, %0
+  br i1 %13, label %14, label %26
+
+14:                                               ; preds = %12
+  br label %15
+
+15:                                               ; preds = %23, %14
+  %.0 = phi i32 [ 0, %14 ], [ %22, %23 ]
+  %16 = sext i32 %.0 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = add nsw i32 %18, 1
+  %20 = sext i32 %.0 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %20
+  store i32 %19, ptr %21, align 4
+  %22 = add nsw i32 %.0, 1
+  br label %23
+
+23:                                               ; preds = %15
+  %24 = icmp slt i32 %22, %0
+  br i1 %24, label %15, label %25
+
+25:                                               ; preds = %23
+  br label %26
+
+26:                                               ; preds = %25, %12
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @global(i32 noundef %0) #0 {
+  %2 = load i32, ptr @flag, align 4
+  %3 = icmp slt i32 %2, 4
+  br i1 %3, label %4, label %16
+
+4:                                                ; preds = %1
+  br label %5
+
+5:                                                ; preds = %13, %4
+  %.01 = phi i32 [ 0, %4 ], [ %12, %13 ]
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = mul nsw i32 %8, 3
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %10
+  store i32 %9, ptr %11, align 4
+  %12 = add nsw i32 %.01, 1
+  br label %13
+
+13:                                               ; preds = %5
+  %14 = icmp slt i32 %12, %0
+  br i1 %14, label %5, label %15
+
+15:                                               ; preds = %13
+  br label %16
+
+16:                                               ; preds = %15, %1
+  %17 = load i32, ptr @flag, align 4
+  %18 = icmp slt i32 %17, 4
+  br i1 %18, label %19, label %31
+
+19:                                               ; preds = %16
+  br label %20
+
+20:                                               ; preds = %28, %19
+  %.0 = phi i32 [ 0, %19 ], [ %27, %28 ]
+  %21 = sext i32 %.0 to i64
+  %22 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = sub nsw i32 %23, 1
+  %25 = sext i32 %.0 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %25
+  store i32 %24, ptr %26, align 4
+  %27 = add nsw i32 %.0, 1
+  br label %28
+
+28:                                               ; preds = %20
+  %29 = icmp slt i32 %27, %0
+  br i1 %29, label %20, label %30
+
+30:                                               ; preds = %28
+  br label %31
+
+31:                                               ; preds = %30, %16
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @different(i32 noundef %0) #0 {
+  %2 = icmp sgt i32 %0, 0
+  br i1 %2, label %3, label %13
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %10, %3
+  %.01 = phi i32 [ 0, %3 ], [ %9, %10 ]
+  %5 = sext i32 %.01 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %5
+  %7 = load i32, ptr %6, align 4
+  %8 = add nsw i32 %7, 1
+  store i32 %8, ptr %6, align 4
+  %9 = add nsw i32 %.01, 1
+  br label %10
+
+10:                                               ; preds = %4
+  %11 = icmp slt i32 %9, %0
+  br i1 %11, label %4, label %12
+
+12:                                               ; preds = %10
+  br label %13
+
+13:                                               ; preds = %12, %1
+  %14 = icmp sgt i32 %0, 1
+  br i1 %14, label %15, label %25
+
+15:                                               ; preds = %13
+  br label %16
+
+16:                                               ; preds = %22, %15
+  %.0 = phi i32 [ 0, %15 ], [ %21, %22 ]
+  %17 = sext i32 %.0 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = add nsw i32 %19, 1
+  store i32 %20, ptr %18, align 4
+  %21 = add nsw i32 %.0, 1
+  br label %22
+
+22:                                               ; preds = %16
+  %23 = icmp slt i32 %21, %0
+  br i1 %23, label %16, label %24
+
+24:                                               ; preds = %22
+  br label %25
+
+25:                                               ; preds = %24, %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %4, %0
+  %.0 = phi i32 [ 0, %0 ], [ %5, %4 ]
+  %2 = icmp slt i32 %.0, 1
+  br i1 %2, label %3, label %6
+
+3:                                                ; preds = %1
+  call void @dowhile(i32 noundef 1000)
+  call void @global(i32 noundef 1000)
+  call void @different(i32 noundef 1000)
+  br label %4
+
+4:                                                ; preds = %3
+  %5 = add nsw i32 %.0, 1
+  br label %1
+
+6:                                                ; preds = %1
+  %7 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %8 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 999), align 4
+  %9 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %10 = add nsw i32 %7, %8
+  %11 = add nsw i32 %10, %9
+  %12 = and i32 %11, 255
+  ret i32 %12
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
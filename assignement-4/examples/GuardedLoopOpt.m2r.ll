@@ -0,0 +1,185 @@
+; ModuleID = 'GuardedLoop.m2r.ll'
+source_filename = "GuardedLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@flag = dso_local global i32 1, align 4
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @dowhile(i32 noundef %0) #0 {
+  %2 = icmp sgt i32 %0, 0
+  br i1 %2, label %3, label %20
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %17, %3
+  %.01 = phi i32 [ 0, %3 ], [ %8, %17 ]
+  %5 = mul nsw i32 %.01, 2
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %6
+  store i32 %5, ptr %7, align 4
+  %8 = add nsw i32 %.01, 1
+  br label %9
+
+9:                                                ; preds = %4
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %12, 1
+  %14 = sext i32 %.01 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %14
+  store i32 %13, ptr %15, align 4
+  %16 = add nsw i32 %.01, 1
+  br label %17
+
+17:                                               ; preds = %9
+  %18 = icmp slt i32 %16, %0
+  br i1 %18, label %4, label %19
+
+19:                                               ; preds = %17
+  br label %20
+
+20:                                               ; preds = %1, %19
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @global(i32 noundef %0) #0 {
+  %2 = load i32, ptr @flag, align 4
+  %3 = icmp slt i32 %2, 4
+  br i1 %3, label %4, label %24
+
+4:                                                ; preds = %1
+  br label %5
+
+5:                                                ; preds = %21, %4
+  %.01 = phi i32 [ 0, %4 ], [ %12, %21 ]
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = mul nsw i32 %8, 3
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %10
+  store i32 %9, ptr %11, align 4
+  %12 = add nsw i32 %.01, 1
+  br label %13
+
+13:                                               ; preds = %5
+  %14 = sext i32 %.01 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = sub nsw i32 %16, 1
+  %18 = sext i32 %.01 to i64
+  %19 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %18
+  store i32 %17, ptr %19, align 4
+  %20 = add nsw i32 %.01, 1
+  br label %21
+
+21:                                               ; preds = %13
+  %22 = icmp slt i32 %20, %0
+  br i1 %22, label %5, label %23
+
+23:                                               ; preds = %21
+  br label %24
+
+24:                                               ; preds = %1, %23
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @different(i32 noundef %0) #0 {
+  %2 = icmp sgt i32 %0, 0
+  br i1 %2, label %3, label %13
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %10, %3
+  %.01 = phi i32 [ 0, %3 ], [ %9, %10 ]
+  %5 = sext i32 %.01 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %5
+  %7 = load i32, ptr %6, align 4
+  %8 = add nsw i32 %7, 1
+  store i32 %8, ptr %6, align 4
+  %9 = add nsw i32 %.01, 1
+  br label %10
+
+10:                                               ; preds = %4
+  %11 = icmp slt i32 %9, %0
+  br i1 %11, label %4, label %12
+
+12:                                               ; preds = %10
+  br label %13
+
+13:                                               ; preds = %12, %1
+  %14 = icmp sgt i32 %0, 1
+  br i1 %14, label %15, label %25
+
+15:                                               ; preds = %13
+  br label %16
+
+16:                                               ; preds = %22, %15
+  %.0 = phi i32 [ 0, %15 ], [ %21, %22 ]
+  %17 = sext i32 %.0 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = add nsw i32 %19, 1
+  store i32 %20, ptr %18, align 4
+  %21 = add nsw i32 %.0, 1
+  br label %22
+
+22:                                               ; preds = %16
+  %23 = icmp slt i32 %21, %0
+  br i1 %23, label %16, label %24
+
+24:                                               ; preds = %22
+  br label %25
+
+25:                                               ; preds = %24, %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %4, %0
+  %.0 = phi i32 [ 0, %0 ], [ %5, %4 ]
+  %2 = icmp slt i32 %.0, 1
+  br i1 %2, label %3, label %6
+
+3:                                                ; preds = %1
+  call void @dowhile(i32 noundef 1000)
+  call void @global(i32 noundef 1000)
+  call void @different(i32 noundef 1000)
+  br label %4
+
+4:                                                ; preds = %3
+  %5 = add nsw i32 %.0, 1
+  br label %1
+
+6:                                                ; preds = %1
+  %7 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %8 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 999), align 4
+  %9 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %10 = add nsw i32 %7, %8
+  %11 = add nsw i32 %10, %9
+  %12 = and i32 %11, 255
+  ret i32 %12
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,48 @@
+// Interchange di loop: le matrici sono memorizzate per righe, ma i loop le
+// visitano per colonne e ogni iterazione interna salta un'intera riga.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm Interchange.c -o Interchange.ll
+//	opt -passes=mem2reg -S Interchange.ll -o Interchange.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-interchange1 \
+//	    -pass-remarks=loop-interchange1 -pass-remarks-missed=loop-interchange1 \
+//	    -S Interchange.m2r.ll -o InterchangeOpt.m2r.ll
+//
+// Il main ripete la visita: il tempo si misura con `time lli` prima e dopo.
+
+#define N 1024
+#define REPEAT 20
+
+int A[N][N], B[N][N], C[N][N];
+
+// Passo interno di N * 4 byte: dopo lo scambio è di 4 byte
+void columns(void) {
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < N; i++) {
+      B[i][j] = A[i][j] + 1;
+    }
+  }
+}
+
+// C[i][j] viene letto all'iterazione (j - 1, i + 1) e scritto a (j, i):
+// direzioni (<, >). Con i loop scambiati la scrittura verrebbe prima della
+// lettura, quindi il nido resta com'è anche se lo scambio converrebbe
+void skew(void) {
+  for (int j = 0; j < N - 1; j++) {
+    for (int i = 1; i < N; i++) {
+      C[i][j] = C[i - 1][j + 1] + 1;
+    }
+  }
+}
+
+int main() {
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      A[i][j] = i + j;
+    }
+  }
+  for (int r = 0; r < REPEAT; r++) {
+    columns();
+  }
+  skew();
+  return (B[N - 1][N - 2] + C[N - 1][0]) & 0xff;
+}
@@ -0,0 +1,218 @@
+; ModuleID = 'Interchange.c'
+source_filename = "Interchange.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+@B = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+@C = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @columns() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %29, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1024
+  br i1 %5, label %6, label %32
+
+6:                                                ; preds = %3
+  store i32 0, ptr %2, align 4
+  br label %7
+
+7:                                                ; preds = %25, %6
+  %8 = load i32, ptr %2, align 4
+  %9 = icmp slt i32 %8, 1024
+  br i1 %9, label %10, label %28
+
+10:                                               ; preds = %7
+  %11 = load i32, ptr %2, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1024 x [1024 x i32]], ptr @A, i64 0, i64 %12
+  %14 = load i32, ptr %1, align 4
+  %15 = sext i32 %14 to i64
+  %16 = getelementptr inbounds [1024 x i32], ptr %13, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = add nsw i32 %17, 1
+  %19 = load i32, ptr %2, align 4
+  %20 = sext i32 %19 to i64
+  %21 = getelementptr inbounds [1024 x [1024 x i32]], ptr @B, i64 0, i64 %20
+  %22 = load i32, ptr %1, align 4
+  %23 = sext i32 %22 to i64
+  %24 = getelementptr inbounds [1024 x i32], ptr %21, i64 0, i64 %23
+  store i32 %18, ptr %24, align 4
+  br label %25
+
+25:                                               ; preds = %10
+  %26 = load i32, ptr %2, align 4
+  %27 = add nsw i32 %26, 1
+  store i32 %27, ptr %2, align 4
+  br label %7
+
+28:                                               ; preds = %7
+  br label %29
+
+29:                                               ; preds = %28
+  %30 = load i32, ptr %1, align 4
+  %31 = add nsw i32 %30, 1
+  store i32 %31, ptr %1, align 4
+  br label %3
+
+32:                                               ; preds = %3
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @skew() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %31, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1023
+  br i1 %5, label %6, label %34
+
+6:                                                ; preds = %3
+  store i32 1, ptr %2, align 4
+  br label %7
+
+7:                                                ; preds = %27, %6
+  %8 = load i32, ptr %2, align 4
+  %9 = icmp slt i32 %8, 1024
+  br i1 %9, label %10, label %30
+
+10:                                               ; preds = %7
+  %11 = load i32, ptr %2, align 4
+  %12 = sub nsw i32 %11, 1
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1024 x [1024 x i32]], ptr @C, i64 0, i64 %13
+  %15 = load i32, ptr %1, align 4
+  %16 = add nsw i32 %15, 1
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1024 x i32], ptr %14, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = add nsw i32 %19, 1
+  %21 = load i32, ptr %2, align 4
+  %22 = sext i32 %21 to i64
+  %23 = getelementptr inbounds [1024 x [1024 x i32]], ptr @C, i64 0, i64 %22
+  %24 = load i32, ptr %1, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1024 x i32], ptr %23, i64 0, i64 %25
+  store i32 %20, ptr %26, align 4
+  br label %27
+
+27:                                               ; preds = %10
+  %28 = load i32, ptr %2, align 4
+  %29 = add nsw i32 %28, 1
+  store i32 %29, ptr %2, align 4
+  br label %7
+
+30:                                               ; preds = %7
+  br label %31
+
+31:                                               ; preds = %30
+  %32 = load i32, ptr %1, align 4
+  %33 = add nsw i32 %32, 1
+  store i32 %33, ptr %1, align 4
+  br label %3
+
+34:                                               ; preds = %3
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %5
+
+5:                                                ; preds = %26, %0
+  %6 = load i32, ptr %2, align 4
+  %7 = icmp slt i32 %6, 1024
+  br i1 %7, label %8, label %29
+
+8:                                                ; preds = %5
+  store i32 0, ptr %3, align 4
+  br label %9
+
+9:                                                ; preds = %22, %8
+  %10 = load i32, ptr %3, align 4
+  %11 = icmp slt i32 %10, 1024
+  br i1 %11, label %12, label %25
+
+12:                                               ; preds = %9
+  %13 = load i32, ptr %2, align 4
+  %14 = load i32, ptr %3, align 4
+  %15 = add nsw i32 %13, %14
+  %16 = load i32, ptr %2, align 4
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1024 x [1024 x i32]], ptr @A, i64 0, i64 %17
+  %19 = load i32, ptr %3, align 4
+  %20 = sext i32 %19 to i64
+  %21 = getelementptr inbounds [1024 x i32], ptr %18, i64 0, i64 %20
+  store i32 %15, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %12
+  %23 = load i32, ptr %3, align 4
+  %24 = add nsw i32 %23, 1
+  store i32 %24, ptr %3, align 4
+  br label %9
+
+25:                                               ; preds = %9
+  br label %26
+
+26:                                               ; preds = %25
+  %27 = load i32, ptr %2, align 4
+  %28 = add nsw i32 %27, 1
+  store i32 %28, ptr %2, align 4
+  br label %5
+
+29:                                               ; preds = %5
+  store i32 0, ptr %4, align 4
+  br label %30
+
+30:                                               ; preds = %34, %29
+  %31 = load i32, ptr %4, align 4
+  %32 = icmp slt i32 %31, 20
+  br i1 %32, label %33, label %37
+
+33:                                               ; preds = %30
+  call void @columns()
+  br label %34
+
+34:                                               ; preds = %33
+  %35 = load i32, ptr %4, align 4
+  %36 = add nsw i32 %35, 1
+  store i32 %36, ptr %4, align 4
+  br label %30
+
+37:                                               ; preds = %30
+  call void @skew()
+  %38 = load i32, ptr getelementptr inbounds ([1024 x [1024 x i32]], ptr @B, i64 0, i64 1023, i64 1022), align 4
+  %39 = load i32, ptr getelementptr inbounds ([1024 x [1024 x i32]], ptr @C, i64 0, i64 1023, i64 0), align 4
+  %40 = add nsw i32 %38, %39
+  %41 = and i32 %40, 255
+  ret i32 %41
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
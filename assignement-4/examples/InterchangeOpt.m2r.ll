@@ -0,0 +1,176 @@
+; ModuleID = 'Interchange.m2r.ll'
+source_filename = "Interchange.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+@B = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+@C = dso_local global [1024 x [1024 x i32]] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @columns() #0 {
+  br label %1
+
+1:                                                ; preds = %20, %0
+  %.01 = phi i32 [ 0, %0 ], [ %21, %20 ]
+  %2 = icmp slt i32 %.01, 1024
+  br i1 %2, label %3, label %22
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %17, %3
+  %.0 = phi i32 [ 0, %3 ], [ %18, %17 ]
+  %5 = icmp slt i32 %.0, 1024
+  br i1 %5, label %6, label %19
+
+6:                                                ; preds = %4
+  %7 = sext i32 %.01 to i64
+  %8 = getelementptr inbounds [1024 x [1024 x i32]], ptr @A, i64 0, i64 %7
+  %9 = sext i32 %.0 to i64
+  %10 = getelementptr inbounds [1024 x i32], ptr %8, i64 0, i64 %9
+  %11 = load i32, ptr %10, align 4
+  %12 = add nsw i32 %11, 1
+  %13 = sext i32 %.01 to i64
+  %14 = getelementptr inbounds [1024 x [1024 x i32]], ptr @B, i64 0, i64 %13
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1024 x i32], ptr %14, i64 0, i64 %15
+  store i32 %12, ptr %16, align 4
+  br label %17
+
+17:                                               ; preds = %6
+  %18 = add nsw i32 %.0, 1
+  br label %4
+
+19:                                               ; preds = %4
+  br label %20
+
+20:                                               ; preds = %19
+  %21 = add nsw i32 %.01, 1
+  br label %1
+
+22:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @skew() #0 {
+  br label %1
+
+1:                                                ; preds = %22, %0
+  %.0 = phi i32 [ 0, %0 ], [ %23, %22 ]
+  %2 = icmp slt i32 %.0, 1023
+  br i1 %2, label %3, label %24
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %19, %3
+  %.01 = phi i32 [ 1, %3 ], [ %20, %19 ]
+  %5 = icmp slt i32 %.01, 1024
+  br i1 %5, label %6, label %21
+
+6:                                                ; preds = %4
+  %7 = sub nsw i32 %.01, 1
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [1024 x [1024 x i32]], ptr @C, i64 0, i64 %8
+  %10 = add nsw i32 %.0, 1
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [1024 x i32], ptr %9, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %13, 1
+  %15 = sext i32 %.01 to i64
+  %16 = getelementptr inbounds [1024 x [1024 x i32]], ptr @C, i64 0, i64 %15
+  %17 = sext i32 %.0 to i64
+  %18 = getelementptr inbounds [1024 x i32], ptr %16, i64 0, i64 %17
+  store i32 %14, ptr %18, align 4
+  br label %19
+
+19:                                               ; preds = %6
+  %20 = add nsw i32 %.01, 1
+  br label %4
+
+21:                                               ; preds = %4
+  br label %22
+
+22:                                               ; preds = %21
+  %23 = add nsw i32 %.0, 1
+  br label %1
+
+24:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %15, %0
+  %.01 = phi i32 [ 0, %0 ], [ %16, %15 ]
+  %2 = icmp slt i32 %.01, 1024
+  br i1 %2, label %3, label %17
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %12, %3
+  %.02 = phi i32 [ 0, %3 ], [ %13, %12 ]
+  %5 = icmp slt i32 %.02, 1024
+  br i1 %5, label %6, label %14
+
+6:                                                ; preds = %4
+  %7 = add nsw i32 %.01, %.02
+  %8 = sext i32 %.01 to i64
+  %9 = getelementptr inbounds [1024 x [1024 x i32]], ptr @A, i64 0, i64 %8
+  %10 = sext i32 %.02 to i64
+  %11 = getelementptr inbounds [1024 x i32], ptr %9, i64 0, i64 %10
+  store i32 %7, ptr %11, align 4
+  br label %12
+
+12:                                               ; preds = %6
+  %13 = add nsw i32 %.02, 1
+  br label %4
+
+14:                                               ; preds = %4
+  br label %15
+
+15:                                               ; preds = %14
+  %16 = add nsw i32 %.01, 1
+  br label %1
+
+17:                                               ; preds = %1
+  br label %18
+
+18:                                               ; preds = %21, %17
+  %.0 = phi i32 [ 0, %17 ], [ %22, %21 ]
+  %19 = icmp slt i32 %.0, 20
+  br i1 %19, label %20, label %23
+
+20:                                               ; preds = %18
+  call void @columns()
+  br label %21
+
+21:                                               ; preds = %20
+  %22 = add nsw i32 %.0, 1
+  br label %18
+
+23:                                               ; preds = %18
+  call void @skew()
+  %24 = load i32, ptr getelementptr inbounds ([1024 x [1024 x i32]], ptr @B, i64 0, i64 1023, i64 1022), align 4
+  %25 = load i32, ptr getelementptr inbounds ([1024 x [1024 x i32]], ptr @C, i64 0, i64 1023, i64 0), align 4
+  %26 = add nsw i32 %24, %25
+  %27 = and i32 %26, 255
+  ret i32 %27
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,53 @@
+// Fusione di loop con induction variable non canoniche: contatori che
+// scendono, con passo diverso da 1 o che partono da un valore diverso da 0.
+// Le IV di L2 vengono riscritte con SCEV in funzione delle iterazioni di L1.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm NonCanonicalLoop.c -o NonCanonicalLoop.ll
+//	opt -passes=mem2reg -S NonCanonicalLoop.ll -o NonCanonicalLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -pass-remarks=loop-fusion1 -pass-remarks-missed=loop-fusion1 \
+//	    -S NonCanonicalLoop.m2r.ll -o NonCanonicalLoopOpt.m2r.ll
+
+#define N 1000
+#define REPEAT 1
+
+int A[N], B[N], C[N], D[4 * N], E[N];
+
+// j = 999 - i
+void countdown(void) {
+  for (int i = 0; i < N; i++) {
+    A[i] = C[i] + 1;
+  }
+  for (int j = N - 1; j >= 0; j--) {
+    B[j] = C[j] * 2;
+  }
+}
+
+// j = 4 * i: C[j / 4] legge il valore scritto da L1 nella stessa iterazione
+void stride(void) {
+  for (int i = 0; i < N; i++) {
+    C[i] = i * 3;
+  }
+  for (int j = 0; j < 4 * N; j += 4) {
+    D[j] = C[j / 4] + 1;
+  }
+}
+
+// j = i + 5: E[j - 5] legge A nella stessa iterazione in cui L1 lo scrive
+void shifted(void) {
+  for (int i = 0; i < N; i++) {
+    A[i] = C[i] - 7;
+  }
+  for (int j = 5; j < N + 5; j++) {
+    E[j - 5] = A[j - 5] * 3;
+  }
+}
+
+int main() {
+  for (int r = 0; r < REPEAT; r++) {
+    countdown();
+    stride();
+    shifted();
+  }
+  return (A[N - 1] + B[0] + C[N - 1] + D[4 * N - 4] + E[N - 1]) & 0xff;
+}
@@ -0,0 +1,244 @@
+; ModuleID = 'NonCanonicalLoop.c'
+source_filename = "NonCanonicalLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [4000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @countdown() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %15, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %18
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = add nsw i32 %10, 1
+  %12 = load i32, ptr %1, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %13
+  store i32 %11, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %6
+  %16 = load i32, ptr %1, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %1, align 4
+  br label %3
+
+18:                                               ; preds = %3
+  store i32 999, ptr %2, align 4
+  br label %19
+
+19:                                               ; preds = %31, %18
+  %20 = load i32, ptr %2, align 4
+  %21 = icmp sge i32 %20, 0
+  br i1 %21, label %22, label %34
+
+22:                                               ; preds = %19
+  %23 = load i32, ptr %2, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = mul nsw i32 %26, 2
+  %28 = load i32, ptr %2, align 4
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %29
+  store i32 %27, ptr %30, align 4
+  br label %31
+
+31:                                               ; preds = %22
+  %32 = load i32, ptr %2, align 4
+  %33 = add nsw i32 %32, -1
+  store i32 %33, ptr %2, align 4
+  br label %19
+
+34:                                               ; preds = %19
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @stride() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %12, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %15
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = mul nsw i32 %7, 3
+  %9 = load i32, ptr %1, align 4
+  %10 = sext i32 %9 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %10
+  store i32 %8, ptr %11, align 4
+  br label %12
+
+12:                                               ; preds = %6
+  %13 = load i32, ptr %1, align 4
+  %14 = add nsw i32 %13, 1
+  store i32 %14, ptr %1, align 4
+  br label %3
+
+15:                                               ; preds = %3
+  store i32 0, ptr %2, align 4
+  br label %16
+
+16:                                               ; preds = %29, %15
+  %17 = load i32, ptr %2, align 4
+  %18 = icmp slt i32 %17, 4000
+  br i1 %18, label %19, label %32
+
+19:                                               ; preds = %16
+  %20 = load i32, ptr %2, align 4
+  %21 = sdiv i32 %20, 4
+  %22 = sext i32 %21 to i64
+  %23 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %22
+  %24 = load i32, ptr %23, align 4
+  %25 = add nsw i32 %24, 1
+  %26 = load i32, ptr %2, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [4000 x i32], ptr @D, i64 0, i64 %27
+  store i32 %25, ptr %28, align 4
+  br label %29
+
+29:                                               ; preds = %19
+  %30 = load i32, ptr %2, align 4
+  %31 = add nsw i32 %30, 4
+  store i32 %31, ptr %2, align 4
+  br label %16
+
+32:                                               ; preds = %16
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @shifted() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %15, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %18
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = sub nsw i32 %10, 7
+  %12 = load i32, ptr %1, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %13
+  store i32 %11, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %6
+  %16 = load i32, ptr %1, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %1, align 4
+  br label %3
+
+18:                                               ; preds = %3
+  store i32 5, ptr %2, align 4
+  br label %19
+
+19:                                               ; preds = %33, %18
+  %20 = load i32, ptr %2, align 4
+  %21 = icmp slt i32 %20, 1005
+  br i1 %21, label %22, label %36
+
+22:                                               ; preds = %19
+  %23 = load i32, ptr %2, align 4
+  %24 = sub nsw i32 %23, 5
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = mul nsw i32 %27, 3
+  %29 = load i32, ptr %2, align 4
+  %30 = sub nsw i32 %29, 5
+  %31 = sext i32 %30 to i64
+  %32 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %31
+  store i32 %28, ptr %32, align 4
+  br label %33
+
+33:                                               ; preds = %22
+  %34 = load i32, ptr %2, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %2, align 4
+  br label %19
+
+36:                                               ; preds = %19
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %7, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 1
+  br i1 %5, label %6, label %10
+
+6:                                                ; preds = %3
+  call void @countdown()
+  call void @stride()
+  call void @shifted()
+  br label %7
+
+7:                                                ; preds = %6
+  %8 = load i32, ptr %2, align 4
+  %9 = add nsw i32 %8, 1
+  store i32 %9, ptr %2, align 4
+  br label %3
+
+10:                                               ; preds = %3
+  %11 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %12 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 0), align 4
+  %13 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %14 = load i32, ptr getelementptr inbounds ([4000 x i32], ptr @D, i64 0, i64 3996), align 4
+  %15 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  %16 = add nsw i32 %11, %12
+  %17 = add nsw i32 %16, %13
+  %18 = add nsw i32 %17, %14
+  %19 = add nsw i32 %18, %15
+  %20 = and i32 %19, 255
+  ret i32 %20
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,202 @@
+; ModuleID = 'NonCanonicalLoop.ll'
+source_filename = "NonCanonicalLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [4000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @countdown() #0 {
+  br label %1
+
+1:                                                ; preds = %10, %0
+  %.0 = phi i32 [ 0, %0 ], [ %11, %10 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %12
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %6, 1
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  br label %10
+
+10:                                               ; preds = %3
+  %11 = add nsw i32 %.0, 1
+  br label %1
+
+12:                                               ; preds = %1
+  br label %13
+
+13:                                               ; preds = %22, %12
+  %.01 = phi i32 [ 999, %12 ], [ %23, %22 ]
+  %14 = icmp sge i32 %.01, 0
+  br i1 %14, label %15, label %24
+
+15:                                               ; preds = %13
+  %16 = sext i32 %.01 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = mul nsw i32 %18, 2
+  %20 = sext i32 %.01 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %20
+  store i32 %19, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %15
+  %23 = add nsw i32 %.01, -1
+  br label %13
+
+24:                                               ; preds = %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @stride() #0 {
+  br label %1
+
+1:                                                ; preds = %7, %0
+  %.0 = phi i32 [ 0, %0 ], [ %8, %7 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %9
+
+3:                                                ; preds = %1
+  %4 = mul nsw i32 %.0, 3
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %5
+  store i32 %4, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %3
+  %8 = add nsw i32 %.0, 1
+  br label %1
+
+9:                                                ; preds = %1
+  br label %10
+
+10:                                               ; preds = %20, %9
+  %.01 = phi i32 [ 0, %9 ], [ %21, %20 ]
+  %11 = icmp slt i32 %.01, 4000
+  br i1 %11, label %12, label %22
+
+12:                                               ; preds = %10
+  %13 = sdiv i32 %.01, 4
+  %14 = sext i32 %13 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = add nsw i32 %16, 1
+  %18 = sext i32 %.01 to i64
+  %19 = getelementptr inbounds [4000 x i32], ptr @D, i64 0, i64 %18
+  store i32 %17, ptr %19, align 4
+  br label %20
+
+20:                                               ; preds = %12
+  %21 = add nsw i32 %.01, 4
+  br label %10
+
+22:                                               ; preds = %10
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @shifted() #0 {
+  br label %1
+
+1:                                                ; preds = %10, %0
+  %.0 = phi i32 [ 0, %0 ], [ %11, %10 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %12
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = sub nsw i32 %6, 7
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  br label %10
+
+10:                                               ; preds = %3
+  %11 = add nsw i32 %.0, 1
+  br label %1
+
+12:                                               ; preds = %1
+  br label %13
+
+13:                                               ; preds = %24, %12
+  %.01 = phi i32 [ 5, %12 ], [ %25, %24 ]
+  %14 = icmp slt i32 %.01, 1005
+  br i1 %14, label %15, label %26
+
+15:                                               ; preds = %13
+  %16 = sub nsw i32 %.01, 5
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = mul nsw i32 %19, 3
+  %21 = sub nsw i32 %.01, 5
+  %22 = sext i32 %21 to i64
+  %23 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %22
+  store i32 %20, ptr %23, align 4
+  br label %24
+
+24:                                               ; preds = %15
+  %25 = add nsw i32 %.01, 1
+  br label %13
+
+26:                                               ; preds = %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %4, %0
+  %.0 = phi i32 [ 0, %0 ], [ %5, %4 ]
+  %2 = icmp slt i32 %.0, 1
+  br i1 %2, label %3, label %6
+
+3:                                                ; preds = %1
+  call void @countdown()
+  call void @stride()
+  call void @shifted()
+  br label %4
+
+4:                                                ; preds = %3
+  %5 = add nsw i32 %.0, 1
+  br label %1
+
+6:                                                ; preds = %1
+  %7 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %8 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 0), align 4
+  %9 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %10 = load i32, ptr getelementptr inbounds ([4000 x i32], ptr @D, i64 0, i64 3996), align 4
+  %11 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  %12 = add nsw i32 %7, %8
+  %13 = add nsw i32 %12, %9
+  %14 = add nsw i32 %13, %10
+  %15 = add nsw i32 %14, %11
+  %16 = and i32 %15, 255
+  ret i32 %16
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
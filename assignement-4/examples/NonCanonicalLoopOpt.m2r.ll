@@ -0,0 +1,161 @@
+; ModuleID = 'NonCanonicalLoop.m2r.ll'
+source_filename = "NonCanonicalLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [4000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @countdown() #0 {
+  br label %1
+
+1:                                                ; preds = %18, %0
+  %.0 = phi i32 [ 0, %0 ], [ %19, %18 ]
+  %2 = mul nsw i32 %.0, -1
+  %3 = add i32 %2, 999
+  %4 = icmp slt i32 %.0, 1000
+  br i1 %4, label %5, label %20
+
+5:                                                ; preds = %1
+  %6 = sext i32 %.0 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %6
+  %8 = load i32, ptr %7, align 4
+  %9 = add nsw i32 %8, 1
+  %10 = sext i32 %.0 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %10
+  store i32 %9, ptr %11, align 4
+  %12 = sext i32 %3 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = mul nsw i32 %14, 2
+  %16 = sext i32 %3 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %16
+  store i32 %15, ptr %17, align 4
+  br label %18
+
+18:                                               ; preds = %5
+  %19 = add nsw i32 %.0, 1
+  br label %1
+
+20:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @stride() #0 {
+  br label %1
+
+1:                                                ; preds = %15, %0
+  %.0 = phi i32 [ 0, %0 ], [ %16, %15 ]
+  %2 = shl nuw nsw i32 %.0, 2
+  %3 = icmp slt i32 %.0, 1000
+  br i1 %3, label %4, label %17
+
+4:                                                ; preds = %1
+  %5 = mul nsw i32 %.0, 3
+  %6 = sext i32 %.0 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %6
+  store i32 %5, ptr %7, align 4
+  %8 = sdiv i32 %2, 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %9
+  %11 = load i32, ptr %10, align 4
+  %12 = add nsw i32 %11, 1
+  %13 = sext i32 %2 to i64
+  %14 = getelementptr inbounds [4000 x i32], ptr @D, i64 0, i64 %13
+  store i32 %12, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %4
+  %16 = add nsw i32 %.0, 1
+  br label %1
+
+17:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @shifted() #0 {
+  br label %1
+
+1:                                                ; preds = %19, %0
+  %.0 = phi i32 [ 0, %0 ], [ %20, %19 ]
+  %2 = add i32 %.0, 5
+  %3 = icmp slt i32 %.0, 1000
+  br i1 %3, label %4, label %21
+
+4:                                                ; preds = %1
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %5
+  %7 = load i32, ptr %6, align 4
+  %8 = sub nsw i32 %7, 7
+  %9 = sext i32 %.0 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %9
+  store i32 %8, ptr %10, align 4
+  %11 = sub nsw i32 %2, 5
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = mul nsw i32 %14, 3
+  %16 = sub nsw i32 %2, 5
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %17
+  store i32 %15, ptr %18, align 4
+  br label %19
+
+19:                                               ; preds = %4
+  %20 = add nsw i32 %.0, 1
+  br label %1
+
+21:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %4, %0
+  %.0 = phi i32 [ 0, %0 ], [ %5, %4 ]
+  %2 = icmp slt i32 %.0, 1
+  br i1 %2, label %3, label %6
+
+3:                                                ; preds = %1
+  call void @countdown()
+  call void @stride()
+  call void @shifted()
+  br label %4
+
+4:                                                ; preds = %3
+  %5 = add nsw i32 %.0, 1
+  br label %1
+
+6:                                                ; preds = %1
+  %7 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %8 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @B, i64 0, i64 0), align 4
+  %9 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 999), align 4
+  %10 = load i32, ptr getelementptr inbounds ([4000 x i32], ptr @D, i64 0, i64 3996), align 4
+  %11 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @E, i64 0, i64 999), align 4
+  %12 = add nsw i32 %7, %8
+  %13 = add nsw i32 %12, %9
+  %14 = add nsw i32 %13, %10
+  %15 = add nsw i32 %14, %11
+  %16 = and i32 %15, 255
+  ret i32 %16
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,36 @@
+// Loop adiacenti con trip count diversi: il loop più lungo viene fermato
+// alle iterazioni dell'altro, i due vengono fusi e le iterazioni in più
+// vengono eseguite da una copia del loop dopo quello fuso.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm PeelLoop.c -o PeelLoop.ll
+//	opt -passes=mem2reg -S PeelLoop.ll -o PeelLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -S PeelLoop.m2r.ll -o PeelLoopOpt.m2r.ll
+
+int A[1000], B[1000], C[1000];
+
+// i < n e i < n - 1: L1 ha un'iterazione in più, eseguita dopo il loop fuso
+int first(int n) {
+  for (int i = 0; i < n; i++) {
+    A[i] = i * 3;
+  }
+  for (int i = 0; i < n - 1; i++) {
+    B[i] = A[i] + 1;
+  }
+  return A[n - 1] + B[n - 2];
+}
+
+// Limiti costanti: L2 ha 20 iterazioni in più
+int second() {
+  for (int i = 0; i < 80; i++) {
+    B[i] = i * 2;
+  }
+  for (int i = 0; i < 100; i++) {
+    C[i] = B[i] + i;
+  }
+  return C[99] + C[50];
+}
+
+int main() {
+  return (first(1000) + second()) & 0xff;
+}
@@ -0,0 +1,167 @@
+; ModuleID = 'PeelLoop.c'
+source_filename = "PeelLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @first(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  br label %5
+
+5:                                                ; preds = %15, %1
+  %6 = load i32, ptr %3, align 4
+  %7 = load i32, ptr %2, align 4
+  %8 = icmp slt i32 %6, %7
+  br i1 %8, label %9, label %18
+
+9:                                                ; preds = %5
+  %10 = load i32, ptr %3, align 4
+  %11 = mul nsw i32 %10, 3
+  %12 = load i32, ptr %3, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %13
+  store i32 %11, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %9
+  %16 = load i32, ptr %3, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %3, align 4
+  br label %5
+
+18:                                               ; preds = %5
+  store i32 0, ptr %4, align 4
+  br label %19
+
+19:                                               ; preds = %33, %18
+  %20 = load i32, ptr %4, align 4
+  %21 = load i32, ptr %2, align 4
+  %22 = sub nsw i32 %21, 1
+  %23 = icmp slt i32 %20, %22
+  br i1 %23, label %24, label %36
+
+24:                                               ; preds = %19
+  %25 = load i32, ptr %4, align 4
+  %26 = sext i32 %25 to i64
+  %27 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %26
+  %28 = load i32, ptr %27, align 4
+  %29 = add nsw i32 %28, 1
+  %30 = load i32, ptr %4, align 4
+  %31 = sext i32 %30 to i64
+  %32 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %31
+  store i32 %29, ptr %32, align 4
+  br label %33
+
+33:                                               ; preds = %24
+  %34 = load i32, ptr %4, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %4, align 4
+  br label %19
+
+36:                                               ; preds = %19
+  %37 = load i32, ptr %2, align 4
+  %38 = sub nsw i32 %37, 1
+  %39 = sext i32 %38 to i64
+  %40 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %39
+  %41 = load i32, ptr %40, align 4
+  %42 = load i32, ptr %2, align 4
+  %43 = sub nsw i32 %42, 2
+  %44 = sext i32 %43 to i64
+  %45 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %44
+  %46 = load i32, ptr %45, align 4
+  %47 = add nsw i32 %41, %46
+  ret i32 %47
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @second() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %12, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 80
+  br i1 %5, label %6, label %15
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = mul nsw i32 %7, 2
+  %9 = load i32, ptr %1, align 4
+  %10 = sext i32 %9 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %10
+  store i32 %8, ptr %11, align 4
+  br label %12
+
+12:                                               ; preds = %6
+  %13 = load i32, ptr %1, align 4
+  %14 = add nsw i32 %13, 1
+  store i32 %14, ptr %1, align 4
+  br label %3
+
+15:                                               ; preds = %3
+  store i32 0, ptr %2, align 4
+  br label %16
+
+16:                                               ; preds = %29, %15
+  %17 = load i32, ptr %2, align 4
+  %18 = icmp slt i32 %17, 100
+  br i1 %18, label %19, label %32
+
+19:                                               ; preds = %16
+  %20 = load i32, ptr %2, align 4
+  %21 = sext i32 %20 to i64
+  %22 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %21
+  %23 = load i32, ptr %22, align 4
+  %24 = load i32, ptr %2, align 4
+  %25 = add nsw i32 %23, %24
+  %26 = load i32, ptr %2, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %27
+  store i32 %25, ptr %28, align 4
+  br label %29
+
+29:                                               ; preds = %19
+  %30 = load i32, ptr %2, align 4
+  %31 = add nsw i32 %30, 1
+  store i32 %31, ptr %2, align 4
+  br label %16
+
+32:                                               ; preds = %16
+  %33 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 99), align 4
+  %34 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 50), align 4
+  %35 = add nsw i32 %33, %34
+  ret i32 %35
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  %2 = call i32 @first(i32 noundef 1000)
+  %3 = call i32 @second()
+  %4 = add nsw i32 %2, %3
+  %5 = and i32 %4, 255
+  ret i32 %5
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,134 @@
+; ModuleID = 'PeelLoop.ll'
+source_filename = "PeelLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @first(i32 noundef %0) #0 {
+  br label %2
+
+2:                                                ; preds = %8, %1
+  %.01 = phi i32 [ 0, %1 ], [ %9, %8 ]
+  %3 = icmp slt i32 %.01, %0
+  br i1 %3, label %4, label %10
+
+4:                                                ; preds = %2
+  %5 = mul nsw i32 %.01, 3
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %6
+  store i32 %5, ptr %7, align 4
+  br label %8
+
+8:                                                ; preds = %4
+  %9 = add nsw i32 %.01, 1
+  br label %2
+
+10:                                               ; preds = %2
+  br label %11
+
+11:                                               ; preds = %21, %10
+  %.0 = phi i32 [ 0, %10 ], [ %22, %21 ]
+  %12 = sub nsw i32 %0, 1
+  %13 = icmp slt i32 %.0, %12
+  br i1 %13, label %14, label %23
+
+14:                                               ; preds = %11
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = add nsw i32 %17, 1
+  %19 = sext i32 %.0 to i64
+  %20 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %19
+  store i32 %18, ptr %20, align 4
+  br label %21
+
+21:                                               ; preds = %14
+  %22 = add nsw i32 %.0, 1
+  br label %11
+
+23:                                               ; preds = %11
+  %24 = sub nsw i32 %0, 1
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = sub nsw i32 %0, 2
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %29
+  %31 = load i32, ptr %30, align 4
+  %32 = add nsw i32 %27, %31
+  ret i32 %32
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @second() #0 {
+  br label %1
+
+1:                                                ; preds = %7, %0
+  %.0 = phi i32 [ 0, %0 ], [ %8, %7 ]
+  %2 = icmp slt i32 %.0, 80
+  br i1 %2, label %3, label %9
+
+3:                                                ; preds = %1
+  %4 = mul nsw i32 %.0, 2
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %5
+  store i32 %4, ptr %6, align 4
+  br label %7
+
+7:                                                ; preds = %3
+  %8 = add nsw i32 %.0, 1
+  br label %1
+
+9:                                                ; preds = %1
+  br label %10
+
+10:                                               ; preds = %19, %9
+  %.01 = phi i32 [ 0, %9 ], [ %20, %19 ]
+  %11 = icmp slt i32 %.01, 100
+  br i1 %11, label %12, label %21
+
+12:                                               ; preds = %10
+  %13 = sext i32 %.01 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %13
+  %15 = load i32, ptr %14, align 4
+  %16 = add nsw i32 %15, %.01
+  %17 = sext i32 %.01 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %17
+  store i32 %16, ptr %18, align 4
+  br label %19
+
+19:                                               ; preds = %12
+  %20 = add nsw i32 %.01, 1
+  br label %10
+
+21:                                               ; preds = %10
+  %22 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 99), align 4
+  %23 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 50), align 4
+  %24 = add nsw i32 %22, %23
+  ret i32 %24
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @first(i32 noundef 1000)
+  %2 = call i32 @second()
+  %3 = add nsw i32 %1, %2
+  %4 = and i32 %3, 255
+  ret i32 %4
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
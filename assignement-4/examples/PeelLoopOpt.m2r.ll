@@ -0,0 +1,184 @@
+; ModuleID = 'PeelLoop.m2r.ll'
+source_filename = "PeelLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @first(i32 noundef %0) #0 {
+  %smax = call i32 @llvm.smax.i32(i32 %0, i32 0)
+  %2 = add i32 %0, -1
+  %smax1 = call i32 @llvm.smax.i32(i32 %2, i32 0)
+  %umin = call i32 @llvm.umin.i32(i32 %smax, i32 %smax1)
+  br label %3
+
+3:                                                ; preds = %16, %1
+  %.01 = phi i32 [ 0, %1 ], [ %17, %16 ]
+  %4 = icmp slt i32 %.01, %0
+  %peel.cmp3 = icmp ult i32 %.01, %umin
+  %5 = and i1 %4, %peel.cmp3
+  br i1 %5, label %6, label %18
+
+6:                                                ; preds = %3
+  %7 = mul nsw i32 %.01, 3
+  %8 = sext i32 %.01 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %12, 1
+  %14 = sext i32 %.01 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %14
+  store i32 %13, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %6
+  %17 = add nsw i32 %.01, 1
+  br label %3
+
+18:                                               ; preds = %3
+  br label %19
+
+19:                                               ; preds = %18, %25
+  %.01.peel = phi i32 [ %.01, %18 ], [ %26, %25 ]
+  %20 = icmp slt i32 %.01.peel, %0
+  br i1 %20, label %21, label %.split2
+
+21:                                               ; preds = %19
+  %22 = mul nsw i32 %.01.peel, 3
+  %23 = sext i32 %.01.peel to i64
+  %24 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %23
+  store i32 %22, ptr %24, align 4
+  br label %25
+
+25:                                               ; preds = %21
+  %26 = add nsw i32 %.01.peel, 1
+  br label %19, !llvm.loop !6
+
+.split2:                                          ; preds = %19
+  br label %27
+
+27:                                               ; preds = %.split2, %37
+  %.0.peel = phi i32 [ %.01, %.split2 ], [ %38, %37 ]
+  %28 = sub nsw i32 %0, 1
+  %29 = icmp slt i32 %.0.peel, %28
+  br i1 %29, label %30, label %.split
+
+30:                                               ; preds = %27
+  %31 = sext i32 %.0.peel to i64
+  %32 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %31
+  %33 = load i32, ptr %32, align 4
+  %34 = add nsw i32 %33, 1
+  %35 = sext i32 %.0.peel to i64
+  %36 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %35
+  store i32 %34, ptr %36, align 4
+  br label %37
+
+37:                                               ; preds = %30
+  %38 = add nsw i32 %.0.peel, 1
+  br label %27, !llvm.loop !8
+
+.split:                                           ; preds = %27
+  %39 = sub nsw i32 %0, 1
+  %40 = sext i32 %39 to i64
+  %41 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %40
+  %42 = load i32, ptr %41, align 4
+  %43 = sub nsw i32 %0, 2
+  %44 = sext i32 %43 to i64
+  %45 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %44
+  %46 = load i32, ptr %45, align 4
+  %47 = add nsw i32 %42, %46
+  ret i32 %47
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @second() #0 {
+  br label %1
+
+1:                                                ; preds = %13, %0
+  %.0 = phi i32 [ 0, %0 ], [ %14, %13 ]
+  %2 = icmp slt i32 %.0, 80
+  br i1 %2, label %3, label %15
+
+3:                                                ; preds = %1
+  %4 = mul nsw i32 %.0, 2
+  %5 = sext i32 %.0 to i64
+  %6 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %5
+  store i32 %4, ptr %6, align 4
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = add nsw i32 %9, %.0
+  %11 = sext i32 %.0 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %11
+  store i32 %10, ptr %12, align 4
+  br label %13
+
+13:                                               ; preds = %3
+  %14 = add nsw i32 %.0, 1
+  br label %1
+
+15:                                               ; preds = %1
+  br label %16
+
+16:                                               ; preds = %15, %25
+  %.01.peel = phi i32 [ %.0, %15 ], [ %26, %25 ]
+  %17 = icmp slt i32 %.01.peel, 100
+  br i1 %17, label %18, label %.split
+
+18:                                               ; preds = %16
+  %19 = sext i32 %.01.peel to i64
+  %20 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %19
+  %21 = load i32, ptr %20, align 4
+  %22 = add nsw i32 %21, %.01.peel
+  %23 = sext i32 %.01.peel to i64
+  %24 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %23
+  store i32 %22, ptr %24, align 4
+  br label %25
+
+25:                                               ; preds = %18
+  %26 = add nsw i32 %.01.peel, 1
+  br label %16, !llvm.loop !9
+
+.split:                                           ; preds = %16
+  %27 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 99), align 4
+  %28 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @C, i64 0, i64 50), align 4
+  %29 = add nsw i32 %27, %28
+  ret i32 %29
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @first(i32 noundef 1000)
+  %2 = call i32 @second()
+  %3 = add nsw i32 %1, %2
+  %4 = and i32 %3, 255
+  ret i32 %4
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare i32 @llvm.smax.i32(i32, i32) #1
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare i32 @llvm.umin.i32(i32, i32) #1
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
+!6 = distinct !{!6, !7}
+!7 = !{!"loop-fusion1.nofuse", i32 1}
+!8 = distinct !{!8, !7}
+!9 = distinct !{!9, !7}
@@ -0,0 +1,61 @@
+// Fusione di loop con riduzioni e ricorrenze: le phi dell'header di L2 che
+// non sono induction variable passano nell'header di L1, e preheader,
+// header e latch di L2 vengono eliminati.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm ReductionLoop.c -o ReductionLoop.ll
+//	opt -passes=mem2reg -S ReductionLoop.ll -o ReductionLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -pass-remarks=loop-fusion1 -pass-remarks-missed=loop-fusion1 \
+//	    -S ReductionLoop.m2r.ll -o ReductionLoopOpt.m2r.ll
+//
+// Il loop fuso viene vettorizzato da -passes="function(loop(loop-rotate),loop-vectorize)"
+
+#define N 1000
+
+int A[N], B[N], C[N], D[N];
+
+// Due riduzioni indipendenti sullo stesso array: t diventa una phi del
+// loop fuso
+int sums(void) {
+  int s = 0, t = 0;
+  for (int i = 0; i < N; i++) {
+    s += A[i];
+  }
+  for (int j = 0; j < N; j++) {
+    t += A[j] * 2;
+  }
+  return s + t;
+}
+
+// t parte dal risultato del primo loop: i loop restano separati
+int chained(void) {
+  int s = 0, t;
+  for (int i = 0; i < N; i++) {
+    s += A[i];
+  }
+  t = s;
+  for (int j = 0; j < N; j++) {
+    t += B[j];
+  }
+  return t;
+}
+
+// x non è una ricorrenza affine e viene aggiornata nel latch di L2
+void recurrence(void) {
+  for (int i = 0; i < N; i++) {
+    C[i] = A[i] * 2;
+  }
+  int x = 1;
+  for (int j = 0; j < N; j++, x = x * 3 % 1009) {
+    D[j] = C[j] + x;
+  }
+}
+
+int main() {
+  for (int i = 0; i < N; i++) {
+    A[i] = i;
+    B[i] = N - i;
+  }
+  recurrence();
+  return (sums() + chained() + D[N - 1]) & 0xff;
+}
@@ -0,0 +1,261 @@
+; ModuleID = 'ReductionLoop.c'
+source_filename = "ReductionLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @sums() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  br label %5
+
+5:                                                ; preds = %15, %0
+  %6 = load i32, ptr %3, align 4
+  %7 = icmp slt i32 %6, 1000
+  br i1 %7, label %8, label %18
+
+8:                                                ; preds = %5
+  %9 = load i32, ptr %1, align 4
+  %10 = load i32, ptr %3, align 4
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %9, %13
+  store i32 %14, ptr %1, align 4
+  br label %15
+
+15:                                               ; preds = %8
+  %16 = load i32, ptr %3, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %3, align 4
+  br label %5
+
+18:                                               ; preds = %5
+  store i32 0, ptr %4, align 4
+  br label %19
+
+19:                                               ; preds = %30, %18
+  %20 = load i32, ptr %4, align 4
+  %21 = icmp slt i32 %20, 1000
+  br i1 %21, label %22, label %33
+
+22:                                               ; preds = %19
+  %23 = load i32, ptr %2, align 4
+  %24 = load i32, ptr %4, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = mul nsw i32 %27, 2
+  %29 = add nsw i32 %23, %28
+  store i32 %29, ptr %2, align 4
+  br label %30
+
+30:                                               ; preds = %22
+  %31 = load i32, ptr %4, align 4
+  %32 = add nsw i32 %31, 1
+  store i32 %32, ptr %4, align 4
+  br label %19
+
+33:                                               ; preds = %19
+  %34 = load i32, ptr %1, align 4
+  %35 = load i32, ptr %2, align 4
+  %36 = add nsw i32 %34, %35
+  ret i32 %36
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chained() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %3, align 4
+  br label %5
+
+5:                                                ; preds = %15, %0
+  %6 = load i32, ptr %3, align 4
+  %7 = icmp slt i32 %6, 1000
+  br i1 %7, label %8, label %18
+
+8:                                                ; preds = %5
+  %9 = load i32, ptr %1, align 4
+  %10 = load i32, ptr %3, align 4
+  %11 = sext i32 %10 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %9, %13
+  store i32 %14, ptr %1, align 4
+  br label %15
+
+15:                                               ; preds = %8
+  %16 = load i32, ptr %3, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %3, align 4
+  br label %5
+
+18:                                               ; preds = %5
+  %19 = load i32, ptr %1, align 4
+  store i32 %19, ptr %2, align 4
+  store i32 0, ptr %4, align 4
+  br label %20
+
+20:                                               ; preds = %30, %18
+  %21 = load i32, ptr %4, align 4
+  %22 = icmp slt i32 %21, 1000
+  br i1 %22, label %23, label %33
+
+23:                                               ; preds = %20
+  %24 = load i32, ptr %2, align 4
+  %25 = load i32, ptr %4, align 4
+  %26 = sext i32 %25 to i64
+  %27 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %26
+  %28 = load i32, ptr %27, align 4
+  %29 = add nsw i32 %24, %28
+  store i32 %29, ptr %2, align 4
+  br label %30
+
+30:                                               ; preds = %23
+  %31 = load i32, ptr %4, align 4
+  %32 = add nsw i32 %31, 1
+  store i32 %32, ptr %4, align 4
+  br label %20
+
+33:                                               ; preds = %20
+  %34 = load i32, ptr %2, align 4
+  ret i32 %34
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @recurrence() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %4
+
+4:                                                ; preds = %16, %0
+  %5 = load i32, ptr %1, align 4
+  %6 = icmp slt i32 %5, 1000
+  br i1 %6, label %7, label %19
+
+7:                                                ; preds = %4
+  %8 = load i32, ptr %1, align 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %9
+  %11 = load i32, ptr %10, align 4
+  %12 = mul nsw i32 %11, 2
+  %13 = load i32, ptr %1, align 4
+  %14 = sext i32 %13 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %14
+  store i32 %12, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %7
+  %17 = load i32, ptr %1, align 4
+  %18 = add nsw i32 %17, 1
+  store i32 %18, ptr %1, align 4
+  br label %4
+
+19:                                               ; preds = %4
+  store i32 1, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  br label %20
+
+20:                                               ; preds = %33, %19
+  %21 = load i32, ptr %3, align 4
+  %22 = icmp slt i32 %21, 1000
+  br i1 %22, label %23, label %39
+
+23:                                               ; preds = %20
+  %24 = load i32, ptr %3, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = load i32, ptr %2, align 4
+  %29 = add nsw i32 %27, %28
+  %30 = load i32, ptr %3, align 4
+  %31 = sext i32 %30 to i64
+  %32 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %31
+  store i32 %29, ptr %32, align 4
+  br label %33
+
+33:                                               ; preds = %23
+  %34 = load i32, ptr %3, align 4
+  %35 = add nsw i32 %34, 1
+  store i32 %35, ptr %3, align 4
+  %36 = load i32, ptr %2, align 4
+  %37 = mul nsw i32 %36, 3
+  %38 = srem i32 %37, 1009
+  store i32 %38, ptr %2, align 4
+  br label %20
+
+39:                                               ; preds = %20
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %3
+
+3:                                                ; preds = %16, %0
+  %4 = load i32, ptr %2, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %19
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %2, align 4
+  %8 = load i32, ptr %2, align 4
+  %9 = sext i32 %8 to i64
+  %10 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %9
+  store i32 %7, ptr %10, align 4
+  %11 = load i32, ptr %2, align 4
+  %12 = sub nsw i32 1000, %11
+  %13 = load i32, ptr %2, align 4
+  %14 = sext i32 %13 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %14
+  store i32 %12, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %6
+  %17 = load i32, ptr %2, align 4
+  %18 = add nsw i32 %17, 1
+  store i32 %18, ptr %2, align 4
+  br label %3
+
+19:                                               ; preds = %3
+  call void @recurrence()
+  %20 = call i32 @sums()
+  %21 = call i32 @chained()
+  %22 = add nsw i32 %20, %21
+  %23 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @D, i64 0, i64 999), align 4
+  %24 = add nsw i32 %22, %23
+  %25 = and i32 %24, 255
+  ret i32 %25
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
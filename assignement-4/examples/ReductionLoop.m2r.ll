@@ -0,0 +1,199 @@
+; ModuleID = 'ReductionLoop.ll'
+source_filename = "ReductionLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @sums() #0 {
+  br label %1
+
+1:                                                ; preds = %8, %0
+  %.02 = phi i32 [ 0, %0 ], [ %9, %8 ]
+  %.0 = phi i32 [ 0, %0 ], [ %7, %8 ]
+  %2 = icmp slt i32 %.02, 1000
+  br i1 %2, label %3, label %10
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.02 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %.0, %6
+  br label %8
+
+8:                                                ; preds = %3
+  %9 = add nsw i32 %.02, 1
+  br label %1
+
+10:                                               ; preds = %1
+  br label %11
+
+11:                                               ; preds = %19, %10
+  %.03 = phi i32 [ 0, %10 ], [ %20, %19 ]
+  %.01 = phi i32 [ 0, %10 ], [ %18, %19 ]
+  %12 = icmp slt i32 %.03, 1000
+  br i1 %12, label %13, label %21
+
+13:                                               ; preds = %11
+  %14 = sext i32 %.03 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = mul nsw i32 %16, 2
+  %18 = add nsw i32 %.01, %17
+  br label %19
+
+19:                                               ; preds = %13
+  %20 = add nsw i32 %.03, 1
+  br label %11
+
+21:                                               ; preds = %11
+  %22 = add nsw i32 %.0, %.01
+  ret i32 %22
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chained() #0 {
+  br label %1
+
+1:                                                ; preds = %8, %0
+  %.02 = phi i32 [ 0, %0 ], [ %9, %8 ]
+  %.0 = phi i32 [ 0, %0 ], [ %7, %8 ]
+  %2 = icmp slt i32 %.02, 1000
+  br i1 %2, label %3, label %10
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.02 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %.0, %6
+  br label %8
+
+8:                                                ; preds = %3
+  %9 = add nsw i32 %.02, 1
+  br label %1
+
+10:                                               ; preds = %1
+  br label %11
+
+11:                                               ; preds = %18, %10
+  %.03 = phi i32 [ 0, %10 ], [ %19, %18 ]
+  %.01 = phi i32 [ %.0, %10 ], [ %17, %18 ]
+  %12 = icmp slt i32 %.03, 1000
+  br i1 %12, label %13, label %20
+
+13:                                               ; preds = %11
+  %14 = sext i32 %.03 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = add nsw i32 %.01, %16
+  br label %18
+
+18:                                               ; preds = %13
+  %19 = add nsw i32 %.03, 1
+  br label %11
+
+20:                                               ; preds = %11
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @recurrence() #0 {
+  br label %1
+
+1:                                                ; preds = %10, %0
+  %.0 = phi i32 [ 0, %0 ], [ %11, %10 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %12
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = mul nsw i32 %6, 2
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  br label %10
+
+10:                                               ; preds = %3
+  %11 = add nsw i32 %.0, 1
+  br label %1
+
+12:                                               ; preds = %1
+  br label %13
+
+13:                                               ; preds = %22, %12
+  %.02 = phi i32 [ 0, %12 ], [ %23, %22 ]
+  %.01 = phi i32 [ 1, %12 ], [ %25, %22 ]
+  %14 = icmp slt i32 %.02, 1000
+  br i1 %14, label %15, label %26
+
+15:                                               ; preds = %13
+  %16 = sext i32 %.02 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = add nsw i32 %18, %.01
+  %20 = sext i32 %.02 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %20
+  store i32 %19, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %15
+  %23 = add nsw i32 %.02, 1
+  %24 = mul nsw i32 %.01, 3
+  %25 = srem i32 %24, 1009
+  br label %13
+
+26:                                               ; preds = %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %9, %0
+  %.0 = phi i32 [ 0, %0 ], [ %10, %9 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %11
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  %6 = sub nsw i32 1000, %.0
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  store i32 %6, ptr %8, align 4
+  br label %9
+
+9:                                                ; preds = %3
+  %10 = add nsw i32 %.0, 1
+  br label %1
+
+11:                                               ; preds = %1
+  call void @recurrence()
+  %12 = call i32 @sums()
+  %13 = call i32 @chained()
+  %14 = add nsw i32 %12, %13
+  %15 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @D, i64 0, i64 999), align 4
+  %16 = add nsw i32 %14, %15
+  %17 = and i32 %16, 255
+  ret i32 %17
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
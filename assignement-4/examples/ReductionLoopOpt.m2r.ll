@@ -0,0 +1,169 @@
+; ModuleID = 'ReductionLoop.m2r.ll'
+source_filename = "ReductionLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @sums() #0 {
+  br label %1
+
+1:                                                ; preds = %13, %0
+  %.02 = phi i32 [ 0, %0 ], [ %14, %13 ]
+  %.0 = phi i32 [ 0, %0 ], [ %7, %13 ]
+  %.01 = phi i32 [ 0, %0 ], [ %12, %13 ]
+  %2 = icmp slt i32 %.02, 1000
+  br i1 %2, label %3, label %15
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.02 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %.0, %6
+  %8 = sext i32 %.02 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = mul nsw i32 %10, 2
+  %12 = add nsw i32 %.01, %11
+  br label %13
+
+13:                                               ; preds = %3
+  %14 = add nsw i32 %.02, 1
+  br label %1
+
+15:                                               ; preds = %1
+  %16 = add nsw i32 %.0, %.01
+  ret i32 %16
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @chained() #0 {
+  br label %1
+
+1:                                                ; preds = %8, %0
+  %.02 = phi i32 [ 0, %0 ], [ %9, %8 ]
+  %.0 = phi i32 [ 0, %0 ], [ %7, %8 ]
+  %2 = icmp slt i32 %.02, 1000
+  br i1 %2, label %3, label %10
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.02 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %.0, %6
+  br label %8
+
+8:                                                ; preds = %3
+  %9 = add nsw i32 %.02, 1
+  br label %1
+
+10:                                               ; preds = %1
+  br label %11
+
+11:                                               ; preds = %18, %10
+  %.03 = phi i32 [ 0, %10 ], [ %19, %18 ]
+  %.01 = phi i32 [ %.0, %10 ], [ %17, %18 ]
+  %12 = icmp slt i32 %.03, 1000
+  br i1 %12, label %13, label %20
+
+13:                                               ; preds = %11
+  %14 = sext i32 %.03 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %14
+  %16 = load i32, ptr %15, align 4
+  %17 = add nsw i32 %.01, %16
+  br label %18
+
+18:                                               ; preds = %13
+  %19 = add nsw i32 %.03, 1
+  br label %11
+
+20:                                               ; preds = %11
+  ret i32 %.01
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @recurrence() #0 {
+  br label %1
+
+1:                                                ; preds = %16, %0
+  %.0 = phi i32 [ 0, %0 ], [ %17, %16 ]
+  %.01 = phi i32 [ 1, %0 ], [ %19, %16 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %20
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = mul nsw i32 %6, 2
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  %10 = sext i32 %.0 to i64
+  %11 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %12, %.01
+  %14 = sext i32 %.0 to i64
+  %15 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %14
+  store i32 %13, ptr %15, align 4
+  br label %16
+
+16:                                               ; preds = %3
+  %17 = add nsw i32 %.0, 1
+  %18 = mul nsw i32 %.01, 3
+  %19 = srem i32 %18, 1009
+  br label %1
+
+20:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %9, %0
+  %.0 = phi i32 [ 0, %0 ], [ %10, %9 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %11
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  store i32 %.0, ptr %5, align 4
+  %6 = sub nsw i32 1000, %.0
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %7
+  store i32 %6, ptr %8, align 4
+  br label %9
+
+9:                                                ; preds = %3
+  %10 = add nsw i32 %.0, 1
+  br label %1
+
+11:                                               ; preds = %1
+  call void @recurrence()
+  %12 = call i32 @sums()
+  %13 = call i32 @chained()
+  %14 = add nsw i32 %12, %13
+  %15 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @D, i64 0, i64 999), align 4
+  %16 = add nsw i32 %14, %15
+  %17 = and i32 %16, 255
+  ret i32 %17
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
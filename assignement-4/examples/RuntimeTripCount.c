@@ -0,0 +1,41 @@
+// Loop limitati da valori noti solo a runtime: getSmallConstantTripCount
+// restituisce 0 e prima la fusione non veniva mai applicata. Ora i trip
+// count vengono confrontati come espressioni SCEV.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm RuntimeTripCount.c -o RuntimeTripCount.ll
+//	opt -passes=mem2reg -S RuntimeTripCount.ll -o RuntimeTripCount.m2r.ll
+//	opt -load=../build/libAssignement4.so -load-pass-plugin=../build/libAssignement4.so \
+//	    -passes=loop-fusion1 -fusion-versioning \
+//	    -S RuntimeTripCount.m2r.ll -o RuntimeTripCountOpt.m2r.ll
+
+int A[1000], B[1000];
+
+// Stesso limite n: i trip count sono uguali simbolicamente, fusione diretta
+int same(int n) {
+  for (int i = 0; i < n; i++) {
+    A[i] = i * 3;
+  }
+  for (int i = 0; i < n; i++) {
+    B[i] = A[i] + 1;
+  }
+  return B[n - 1];
+}
+
+// Limiti diversi: sono uguali solo se n == m. Con -fusion-versioning la
+// versione fusa viene eseguita quando il test a runtime lo conferma,
+// altrimenti si eseguono i due loop originali
+int versioned(int n, int m) {
+  int t = 0;
+  for (int i = 0; i < n; i++) {
+    t = i * 5;
+    A[i] = t;
+  }
+  for (int i = 0; i < m; i++) {
+    B[i] = A[i] - 2;
+  }
+  return B[m - 1] + t;
+}
+
+int main() {
+  return (same(1000) + versioned(1000, 1000) + versioned(1000, 500)) & 0xff;
+}
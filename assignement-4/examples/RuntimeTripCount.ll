@@ -0,0 +1,174 @@
+; ModuleID = 'RuntimeTripCount.c'
+source_filename = "RuntimeTripCount.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @same(i32 noundef %0) #0 {
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  store i32 %0, ptr %2, align 4
+  store i32 0, ptr %3, align 4
+  br label %5
+
+5:                                                ; preds = %15, %1
+  %6 = load i32, ptr %3, align 4
+  %7 = load i32, ptr %2, align 4
+  %8 = icmp slt i32 %6, %7
+  br i1 %8, label %9, label %18
+
+9:                                                ; preds = %5
+  %10 = load i32, ptr %3, align 4
+  %11 = mul nsw i32 %10, 3
+  %12 = load i32, ptr %3, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %13
+  store i32 %11, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %9
+  %16 = load i32, ptr %3, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %3, align 4
+  br label %5
+
+18:                                               ; preds = %5
+  store i32 0, ptr %4, align 4
+  br label %19
+
+19:                                               ; preds = %32, %18
+  %20 = load i32, ptr %4, align 4
+  %21 = load i32, ptr %2, align 4
+  %22 = icmp slt i32 %20, %21
+  br i1 %22, label %23, label %35
+
+23:                                               ; preds = %19
+  %24 = load i32, ptr %4, align 4
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = add nsw i32 %27, 1
+  %29 = load i32, ptr %4, align 4
+  %30 = sext i32 %29 to i64
+  %31 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %30
+  store i32 %28, ptr %31, align 4
+  br label %32
+
+32:                                               ; preds = %23
+  %33 = load i32, ptr %4, align 4
+  %34 = add nsw i32 %33, 1
+  store i32 %34, ptr %4, align 4
+  br label %19
+
+35:                                               ; preds = %19
+  %36 = load i32, ptr %2, align 4
+  %37 = sub nsw i32 %36, 1
+  %38 = sext i32 %37 to i64
+  %39 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %38
+  %40 = load i32, ptr %39, align 4
+  ret i32 %40
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @versioned(i32 noundef %0, i32 noundef %1) #0 {
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  %6 = alloca i32, align 4
+  %7 = alloca i32, align 4
+  store i32 %0, ptr %3, align 4
+  store i32 %1, ptr %4, align 4
+  store i32 0, ptr %5, align 4
+  store i32 0, ptr %6, align 4
+  br label %8
+
+8:                                                ; preds = %19, %2
+  %9 = load i32, ptr %6, align 4
+  %10 = load i32, ptr %3, align 4
+  %11 = icmp slt i32 %9, %10
+  br i1 %11, label %12, label %22
+
+12:                                               ; preds = %8
+  %13 = load i32, ptr %6, align 4
+  %14 = mul nsw i32 %13, 5
+  store i32 %14, ptr %5, align 4
+  %15 = load i32, ptr %5, align 4
+  %16 = load i32, ptr %6, align 4
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %17
+  store i32 %15, ptr %18, align 4
+  br label %19
+
+19:                                               ; preds = %12
+  %20 = load i32, ptr %6, align 4
+  %21 = add nsw i32 %20, 1
+  store i32 %21, ptr %6, align 4
+  br label %8
+
+22:                                               ; preds = %8
+  store i32 0, ptr %7, align 4
+  br label %23
+
+23:                                               ; preds = %36, %22
+  %24 = load i32, ptr %7, align 4
+  %25 = load i32, ptr %4, align 4
+  %26 = icmp slt i32 %24, %25
+  br i1 %26, label %27, label %39
+
+27:                                               ; preds = %23
+  %28 = load i32, ptr %7, align 4
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %29
+  %31 = load i32, ptr %30, align 4
+  %32 = sub nsw i32 %31, 2
+  %33 = load i32, ptr %7, align 4
+  %34 = sext i32 %33 to i64
+  %35 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %34
+  store i32 %32, ptr %35, align 4
+  br label %36
+
+36:                                               ; preds = %27
+  %37 = load i32, ptr %7, align 4
+  %38 = add nsw i32 %37, 1
+  store i32 %38, ptr %7, align 4
+  br label %23
+
+39:                                               ; preds = %23
+  %40 = load i32, ptr %4, align 4
+  %41 = sub nsw i32 %40, 1
+  %42 = sext i32 %41 to i64
+  %43 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %42
+  %44 = load i32, ptr %43, align 4
+  %45 = load i32, ptr %5, align 4
+  %46 = add nsw i32 %44, %45
+  ret i32 %46
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  %2 = call i32 @same(i32 noundef 1000)
+  %3 = call i32 @versioned(i32 noundef 1000, i32 noundef 1000)
+  %4 = add nsw i32 %2, %3
+  %5 = call i32 @versioned(i32 noundef 1000, i32 noundef 500)
+  %6 = add nsw i32 %4, %5
+  %7 = and i32 %6, 255
+  ret i32 %7
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,117 @@
+; ModuleID = 'RuntimeTripCount.m2r.ll'
+source_filename = "RuntimeTripCount.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @same(i32 noundef %0) #0 {
+  br label %2
+
+2:                                                ; preds = %14, %1
+  %.01 = phi i32 [ 0, %1 ], [ %15, %14 ]
+  %3 = icmp slt i32 %.01, %0
+  br i1 %3, label %4, label %16
+
+4:                                                ; preds = %2
+  %5 = mul nsw i32 %.01, 3
+  %6 = sext i32 %.01 to i64
+  %7 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %6
+  store i32 %5, ptr %7, align 4
+  %8 = sext i32 %.01 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = add nsw i32 %10, 1
+  %12 = sext i32 %.01 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %12
+  store i32 %11, ptr %13, align 4
+  br label %14
+
+14:                                               ; preds = %4
+  %15 = add nsw i32 %.01, 1
+  br label %2
+
+16:                                               ; preds = %2
+  %17 = sub nsw i32 %0, 1
+  %18 = sext i32 %17 to i64
+  %19 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %18
+  %20 = load i32, ptr %19, align 4
+  ret i32 %20
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @versioned(i32 noundef %0, i32 noundef %1) #0 {
+  br label %3
+
+3:                                                ; preds = %9, %2
+  %.02 = phi i32 [ 0, %2 ], [ %6, %9 ]
+  %.01 = phi i32 [ 0, %2 ], [ %10, %9 ]
+  %4 = icmp slt i32 %.01, %0
+  br i1 %4, label %5, label %11
+
+5:                                                ; preds = %3
+  %6 = mul nsw i32 %.01, 5
+  %7 = sext i32 %.01 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %7
+  store i32 %6, ptr %8, align 4
+  br label %9
+
+9:                                                ; preds = %5
+  %10 = add nsw i32 %.01, 1
+  br label %3
+
+11:                                               ; preds = %3
+  br label %12
+
+12:                                               ; preds = %21, %11
+  %.0 = phi i32 [ 0, %11 ], [ %22, %21 ]
+  %13 = icmp slt i32 %.0, %1
+  br i1 %13, label %14, label %23
+
+14:                                               ; preds = %12
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = sub nsw i32 %17, 2
+  %19 = sext i32 %.0 to i64
+  %20 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %19
+  store i32 %18, ptr %20, align 4
+  br label %21
+
+21:                                               ; preds = %14
+  %22 = add nsw i32 %.0, 1
+  br label %12
+
+23:                                               ; preds = %12
+  %24 = sub nsw i32 %1, 1
+  %25 = sext i32 %24 to i64
+  %26 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %25
+  %27 = load i32, ptr %26, align 4
+  %28 = add nsw i32 %27, %.02
+  ret i32 %28
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = call i32 @same(i32 noundef 1000)
+  %2 = call i32 @versioned(i32 noundef 1000, i32 noundef 1000)
+  %3 = add nsw i32 %1, %2
+  %4 = call i32 @versioned(i32 noundef 1000, i32 noundef 500)
+  %5 = add nsw i32 %3, %4
+  %6 = and i32 %5, 255
+  ret i32 %6
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
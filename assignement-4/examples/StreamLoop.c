@@ -0,0 +1,40 @@
+// Modello di profittabilità: due loop vengono fusi solo se i corpi
+// condividono dati e accedono a pochi oggetti in totale.
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm StreamLoop.c -o StreamLoop.ll
+//	opt -passes=mem2reg -S StreamLoop.ll -o StreamLoop.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-fusion1 \
+//	    -pass-remarks=loop-fusion1 -pass-remarks-missed=loop-fusion1 \
+//	    -S StreamLoop.m2r.ll -o StreamLoopOpt.m2r.ll
+
+#define N 1000
+
+int A[N], B[N], C[N], D[N], E[N], F[N], G[N], H[N], I[N], J[N];
+
+// B viene scritto dal primo loop e riletto dal secondo alla stessa
+// iterazione, quando è ancora in cache: i loop vengono fusi
+void shared(void) {
+  for (int i = 0; i < N; i++) {
+    B[i] = A[i] + 1;
+  }
+  for (int i = 0; i < N; i++) {
+    C[i] = B[i] * 2;
+  }
+}
+
+// Nessun oggetto in comune: la fusione non porta riuso in cache e i loop
+// restano separati
+void disjoint(void) {
+  for (int i = 0; i < N; i++) {
+    A[i] = B[i] + C[i] + D[i] + E[i];
+  }
+  for (int i = 0; i < N; i++) {
+    F[i] = G[i] + H[i] + I[i] + J[i];
+  }
+}
+
+int main() {
+  shared();
+  disjoint();
+  return (A[N - 1] + F[N - 1]) & 0xff;
+}
@@ -0,0 +1,190 @@
+; ModuleID = 'StreamLoop.c'
+source_filename = "StreamLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@F = dso_local global [1000 x i32] zeroinitializer, align 16
+@G = dso_local global [1000 x i32] zeroinitializer, align 16
+@H = dso_local global [1000 x i32] zeroinitializer, align 16
+@I = dso_local global [1000 x i32] zeroinitializer, align 16
+@J = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @shared() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %15, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %18
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = add nsw i32 %10, 1
+  %12 = load i32, ptr %1, align 4
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %13
+  store i32 %11, ptr %14, align 4
+  br label %15
+
+15:                                               ; preds = %6
+  %16 = load i32, ptr %1, align 4
+  %17 = add nsw i32 %16, 1
+  store i32 %17, ptr %1, align 4
+  br label %3
+
+18:                                               ; preds = %3
+  store i32 0, ptr %2, align 4
+  br label %19
+
+19:                                               ; preds = %31, %18
+  %20 = load i32, ptr %2, align 4
+  %21 = icmp slt i32 %20, 1000
+  br i1 %21, label %22, label %34
+
+22:                                               ; preds = %19
+  %23 = load i32, ptr %2, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = mul nsw i32 %26, 2
+  %28 = load i32, ptr %2, align 4
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %29
+  store i32 %27, ptr %30, align 4
+  br label %31
+
+31:                                               ; preds = %22
+  %32 = load i32, ptr %2, align 4
+  %33 = add nsw i32 %32, 1
+  store i32 %33, ptr %2, align 4
+  br label %19
+
+34:                                               ; preds = %19
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @disjoint() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %29, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 1000
+  br i1 %5, label %6, label %32
+
+6:                                                ; preds = %3
+  %7 = load i32, ptr %1, align 4
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %8
+  %10 = load i32, ptr %9, align 4
+  %11 = load i32, ptr %1, align 4
+  %12 = sext i32 %11 to i64
+  %13 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %12
+  %14 = load i32, ptr %13, align 4
+  %15 = add nsw i32 %10, %14
+  %16 = load i32, ptr %1, align 4
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %17
+  %19 = load i32, ptr %18, align 4
+  %20 = add nsw i32 %15, %19
+  %21 = load i32, ptr %1, align 4
+  %22 = sext i32 %21 to i64
+  %23 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %22
+  %24 = load i32, ptr %23, align 4
+  %25 = add nsw i32 %20, %24
+  %26 = load i32, ptr %1, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %27
+  store i32 %25, ptr %28, align 4
+  br label %29
+
+29:                                               ; preds = %6
+  %30 = load i32, ptr %1, align 4
+  %31 = add nsw i32 %30, 1
+  store i32 %31, ptr %1, align 4
+  br label %3
+
+32:                                               ; preds = %3
+  store i32 0, ptr %2, align 4
+  br label %33
+
+33:                                               ; preds = %59, %32
+  %34 = load i32, ptr %2, align 4
+  %35 = icmp slt i32 %34, 1000
+  br i1 %35, label %36, label %62
+
+36:                                               ; preds = %33
+  %37 = load i32, ptr %2, align 4
+  %38 = sext i32 %37 to i64
+  %39 = getelementptr inbounds [1000 x i32], ptr @G, i64 0, i64 %38
+  %40 = load i32, ptr %39, align 4
+  %41 = load i32, ptr %2, align 4
+  %42 = sext i32 %41 to i64
+  %43 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %42
+  %44 = load i32, ptr %43, align 4
+  %45 = add nsw i32 %40, %44
+  %46 = load i32, ptr %2, align 4
+  %47 = sext i32 %46 to i64
+  %48 = getelementptr inbounds [1000 x i32], ptr @I, i64 0, i64 %47
+  %49 = load i32, ptr %48, align 4
+  %50 = add nsw i32 %45, %49
+  %51 = load i32, ptr %2, align 4
+  %52 = sext i32 %51 to i64
+  %53 = getelementptr inbounds [1000 x i32], ptr @J, i64 0, i64 %52
+  %54 = load i32, ptr %53, align 4
+  %55 = add nsw i32 %50, %54
+  %56 = load i32, ptr %2, align 4
+  %57 = sext i32 %56 to i64
+  %58 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %57
+  store i32 %55, ptr %58, align 4
+  br label %59
+
+59:                                               ; preds = %36
+  %60 = load i32, ptr %2, align 4
+  %61 = add nsw i32 %60, 1
+  store i32 %61, ptr %2, align 4
+  br label %33
+
+62:                                               ; preds = %33
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  call void @shared()
+  call void @disjoint()
+  %2 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %3 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @F, i64 0, i64 999), align 4
+  %4 = add nsw i32 %2, %3
+  %5 = and i32 %4, 255
+  ret i32 %5
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
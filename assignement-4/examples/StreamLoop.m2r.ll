@@ -0,0 +1,158 @@
+; ModuleID = 'StreamLoop.ll'
+source_filename = "StreamLoop.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [1000 x i32] zeroinitializer, align 16
+@B = dso_local global [1000 x i32] zeroinitializer, align 16
+@C = dso_local global [1000 x i32] zeroinitializer, align 16
+@D = dso_local global [1000 x i32] zeroinitializer, align 16
+@E = dso_local global [1000 x i32] zeroinitializer, align 16
+@F = dso_local global [1000 x i32] zeroinitializer, align 16
+@G = dso_local global [1000 x i32] zeroinitializer, align 16
+@H = dso_local global [1000 x i32] zeroinitializer, align 16
+@I = dso_local global [1000 x i32] zeroinitializer, align 16
+@J = dso_local global [1000 x i32] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @shared() #0 {
+  br label %1
+
+1:                                                ; preds = %10, %0
+  %.0 = phi i32 [ 0, %0 ], [ %11, %10 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %12
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = add nsw i32 %6, 1
+  %8 = sext i32 %.0 to i64
+  %9 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %8
+  store i32 %7, ptr %9, align 4
+  br label %10
+
+10:                                               ; preds = %3
+  %11 = add nsw i32 %.0, 1
+  br label %1
+
+12:                                               ; preds = %1
+  br label %13
+
+13:                                               ; preds = %22, %12
+  %.01 = phi i32 [ 0, %12 ], [ %23, %22 ]
+  %14 = icmp slt i32 %.01, 1000
+  br i1 %14, label %15, label %24
+
+15:                                               ; preds = %13
+  %16 = sext i32 %.01 to i64
+  %17 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = mul nsw i32 %18, 2
+  %20 = sext i32 %.01 to i64
+  %21 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %20
+  store i32 %19, ptr %21, align 4
+  br label %22
+
+22:                                               ; preds = %15
+  %23 = add nsw i32 %.01, 1
+  br label %13
+
+24:                                               ; preds = %13
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @disjoint() #0 {
+  br label %1
+
+1:                                                ; preds = %21, %0
+  %.0 = phi i32 [ 0, %0 ], [ %22, %21 ]
+  %2 = icmp slt i32 %.0, 1000
+  br i1 %2, label %3, label %23
+
+3:                                                ; preds = %1
+  %4 = sext i32 %.0 to i64
+  %5 = getelementptr inbounds [1000 x i32], ptr @B, i64 0, i64 %4
+  %6 = load i32, ptr %5, align 4
+  %7 = sext i32 %.0 to i64
+  %8 = getelementptr inbounds [1000 x i32], ptr @C, i64 0, i64 %7
+  %9 = load i32, ptr %8, align 4
+  %10 = add nsw i32 %6, %9
+  %11 = sext i32 %.0 to i64
+  %12 = getelementptr inbounds [1000 x i32], ptr @D, i64 0, i64 %11
+  %13 = load i32, ptr %12, align 4
+  %14 = add nsw i32 %10, %13
+  %15 = sext i32 %.0 to i64
+  %16 = getelementptr inbounds [1000 x i32], ptr @E, i64 0, i64 %15
+  %17 = load i32, ptr %16, align 4
+  %18 = add nsw i32 %14, %17
+  %19 = sext i32 %.0 to i64
+  %20 = getelementptr inbounds [1000 x i32], ptr @A, i64 0, i64 %19
+  store i32 %18, ptr %20, align 4
+  br label %21
+
+21:                                               ; preds = %3
+  %22 = add nsw i32 %.0, 1
+  br label %1
+
+23:                                               ; preds = %1
+  br label %24
+
+24:                                               ; preds = %44, %23
+  %.01 = phi i32 [ 0, %23 ], [ %45, %44 ]
+  %25 = icmp slt i32 %.01, 1000
+  br i1 %25, label %26, label %46
+
+26:                                               ; preds = %24
+  %27 = sext i32 %.01 to i64
+  %28 = getelementptr inbounds [1000 x i32], ptr @G, i64 0, i64 %27
+  %29 = load i32, ptr %28, align 4
+  %30 = sext i32 %.01 to i64
+  %31 = getelementptr inbounds [1000 x i32], ptr @H, i64 0, i64 %30
+  %32 = load i32, ptr %31, align 4
+  %33 = add nsw i32 %29, %32
+  %34 = sext i32 %.01 to i64
+  %35 = getelementptr inbounds [1000 x i32], ptr @I, i64 0, i64 %34
+  %36 = load i32, ptr %35, align 4
+  %37 = add nsw i32 %33, %36
+  %38 = sext i32 %.01 to i64
+  %39 = getelementptr inbounds [1000 x i32], ptr @J, i64 0, i64 %38
+  %40 = load i32, ptr %39, align 4
+  %41 = add nsw i32 %37, %40
+  %42 = sext i32 %.01 to i64
+  %43 = getelementptr inbounds [1000 x i32], ptr @F, i64 0, i64 %42
+  store i32 %41, ptr %43, align 4
+  br label %44
+
+44:                                               ; preds = %26
+  %45 = add nsw i32 %.01, 1
+  br label %24
+
+46:                                               ; preds = %24
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  call void @shared()
+  call void @disjoint()
+  %1 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @A, i64 0, i64 999), align 4
+  %2 = load i32, ptr getelementptr inbounds ([1000 x i32], ptr @F, i64 0, i64 999), align 4
+  %3 = add nsw i32 %1, %2
+  %4 = and i32 %3, 255
+  ret i32 %4
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
@@ -0,0 +1,62 @@
+// Tiling di loop: il prodotto di matrici rilegge tutta B per ogni riga di C.
+// Con N = 512 B occupa 1 MB e alla riga successiva non è più nella cache:
+// il nido viene diviso in tile da 32 x 32 x 32 (12 KB di dati).
+//
+//	clang -O0 -Xclang -disable-O0-optnone -S -emit-llvm Tiling.c -o Tiling.ll
+//	opt -passes=mem2reg -S Tiling.ll -o Tiling.m2r.ll
+//	opt -load-pass-plugin=../build/libAssignement4.so -passes=loop-tiling1 \
+//	    -pass-remarks=loop-tiling1 -pass-remarks-missed=loop-tiling1 \
+//	    -S Tiling.m2r.ll -o TilingOpt.m2r.ll
+//
+// La dimensione della cache si sceglie con -tiling-cache-size (32768 byte di
+// default, opzione del plugin da caricare anche con -load).
+
+#define N 512
+#define REPEAT 1
+#define STENCIL_REPEAT 1
+
+int A[N][N], B[N][N], C[N][N], P[N][N], Q[N][N];
+
+// Ogni iterazione di i legge una riga di A e tutta B
+void matmul(void) {
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      for (int k = 0; k < N; k++) {
+        C[i][j] += A[i][k] * B[k][j];
+      }
+    }
+  }
+}
+
+// Le righe i - 1, i e i + 1 di P (6 KB) stanno già nella cache quando
+// servono di nuovo: il nido resta com'è
+void stencil(void) {
+  for (int i = 1; i < N - 1; i++) {
+    for (int j = 1; j < N - 1; j++) {
+      Q[i][j] = P[i - 1][j] + P[i + 1][j] + P[i][j - 1] + P[i][j + 1] - 4 * P[i][j];
+    }
+  }
+}
+
+int main() {
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      A[i][j] = i + j;
+      B[i][j] = i - j;
+      P[i][j] = (i * j) & 7;
+    }
+  }
+  for (int r = 0; r < REPEAT; r++) {
+    matmul();
+  }
+  for (int r = 0; r < STENCIL_REPEAT; r++) {
+    stencil();
+  }
+  unsigned sum = 0;
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      sum = sum * 31 + (C[i][j] ^ Q[i][j]);
+    }
+  }
+  return sum & 0xff;
+}
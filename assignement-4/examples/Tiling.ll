@@ -0,0 +1,372 @@
+; ModuleID = 'Tiling.c'
+source_filename = "Tiling.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@B = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@C = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@P = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@Q = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @matmul() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  br label %4
+
+4:                                                ; preds = %47, %0
+  %5 = load i32, ptr %1, align 4
+  %6 = icmp slt i32 %5, 512
+  br i1 %6, label %7, label %50
+
+7:                                                ; preds = %4
+  store i32 0, ptr %2, align 4
+  br label %8
+
+8:                                                ; preds = %43, %7
+  %9 = load i32, ptr %2, align 4
+  %10 = icmp slt i32 %9, 512
+  br i1 %10, label %11, label %46
+
+11:                                               ; preds = %8
+  store i32 0, ptr %3, align 4
+  br label %12
+
+12:                                               ; preds = %39, %11
+  %13 = load i32, ptr %3, align 4
+  %14 = icmp slt i32 %13, 512
+  br i1 %14, label %15, label %42
+
+15:                                               ; preds = %12
+  %16 = load i32, ptr %1, align 4
+  %17 = sext i32 %16 to i64
+  %18 = getelementptr inbounds [512 x [512 x i32]], ptr @A, i64 0, i64 %17
+  %19 = load i32, ptr %3, align 4
+  %20 = sext i32 %19 to i64
+  %21 = getelementptr inbounds [512 x i32], ptr %18, i64 0, i64 %20
+  %22 = load i32, ptr %21, align 4
+  %23 = load i32, ptr %3, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds [512 x [512 x i32]], ptr @B, i64 0, i64 %24
+  %26 = load i32, ptr %2, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [512 x i32], ptr %25, i64 0, i64 %27
+  %29 = load i32, ptr %28, align 4
+  %30 = mul nsw i32 %22, %29
+  %31 = load i32, ptr %1, align 4
+  %32 = sext i32 %31 to i64
+  %33 = getelementptr inbounds [512 x [512 x i32]], ptr @C, i64 0, i64 %32
+  %34 = load i32, ptr %2, align 4
+  %35 = sext i32 %34 to i64
+  %36 = getelementptr inbounds [512 x i32], ptr %33, i64 0, i64 %35
+  %37 = load i32, ptr %36, align 4
+  %38 = add nsw i32 %37, %30
+  store i32 %38, ptr %36, align 4
+  br label %39
+
+39:                                               ; preds = %15
+  %40 = load i32, ptr %3, align 4
+  %41 = add nsw i32 %40, 1
+  store i32 %41, ptr %3, align 4
+  br label %12
+
+42:                                               ; preds = %12
+  br label %43
+
+43:                                               ; preds = %42
+  %44 = load i32, ptr %2, align 4
+  %45 = add nsw i32 %44, 1
+  store i32 %45, ptr %2, align 4
+  br label %8
+
+46:                                               ; preds = %8
+  br label %47
+
+47:                                               ; preds = %46
+  %48 = load i32, ptr %1, align 4
+  %49 = add nsw i32 %48, 1
+  store i32 %49, ptr %1, align 4
+  br label %4
+
+50:                                               ; preds = %4
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @stencil() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  store i32 1, ptr %1, align 4
+  br label %3
+
+3:                                                ; preds = %65, %0
+  %4 = load i32, ptr %1, align 4
+  %5 = icmp slt i32 %4, 511
+  br i1 %5, label %6, label %68
+
+6:                                                ; preds = %3
+  store i32 1, ptr %2, align 4
+  br label %7
+
+7:                                                ; preds = %61, %6
+  %8 = load i32, ptr %2, align 4
+  %9 = icmp slt i32 %8, 511
+  br i1 %9, label %10, label %64
+
+10:                                               ; preds = %7
+  %11 = load i32, ptr %1, align 4
+  %12 = sub nsw i32 %11, 1
+  %13 = sext i32 %12 to i64
+  %14 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %13
+  %15 = load i32, ptr %2, align 4
+  %16 = sext i32 %15 to i64
+  %17 = getelementptr inbounds [512 x i32], ptr %14, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = load i32, ptr %1, align 4
+  %20 = add nsw i32 %19, 1
+  %21 = sext i32 %20 to i64
+  %22 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %21
+  %23 = load i32, ptr %2, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds [512 x i32], ptr %22, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = add nsw i32 %18, %26
+  %28 = load i32, ptr %1, align 4
+  %29 = sext i32 %28 to i64
+  %30 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %29
+  %31 = load i32, ptr %2, align 4
+  %32 = sub nsw i32 %31, 1
+  %33 = sext i32 %32 to i64
+  %34 = getelementptr inbounds [512 x i32], ptr %30, i64 0, i64 %33
+  %35 = load i32, ptr %34, align 4
+  %36 = add nsw i32 %27, %35
+  %37 = load i32, ptr %1, align 4
+  %38 = sext i32 %37 to i64
+  %39 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %38
+  %40 = load i32, ptr %2, align 4
+  %41 = add nsw i32 %40, 1
+  %42 = sext i32 %41 to i64
+  %43 = getelementptr inbounds [512 x i32], ptr %39, i64 0, i64 %42
+  %44 = load i32, ptr %43, align 4
+  %45 = add nsw i32 %36, %44
+  %46 = load i32, ptr %1, align 4
+  %47 = sext i32 %46 to i64
+  %48 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %47
+  %49 = load i32, ptr %2, align 4
+  %50 = sext i32 %49 to i64
+  %51 = getelementptr inbounds [512 x i32], ptr %48, i64 0, i64 %50
+  %52 = load i32, ptr %51, align 4
+  %53 = mul nsw i32 4, %52
+  %54 = sub nsw i32 %45, %53
+  %55 = load i32, ptr %1, align 4
+  %56 = sext i32 %55 to i64
+  %57 = getelementptr inbounds [512 x [512 x i32]], ptr @Q, i64 0, i64 %56
+  %58 = load i32, ptr %2, align 4
+  %59 = sext i32 %58 to i64
+  %60 = getelementptr inbounds [512 x i32], ptr %57, i64 0, i64 %59
+  store i32 %54, ptr %60, align 4
+  br label %61
+
+61:                                               ; preds = %10
+  %62 = load i32, ptr %2, align 4
+  %63 = add nsw i32 %62, 1
+  store i32 %63, ptr %2, align 4
+  br label %7
+
+64:                                               ; preds = %7
+  br label %65
+
+65:                                               ; preds = %64
+  %66 = load i32, ptr %1, align 4
+  %67 = add nsw i32 %66, 1
+  store i32 %67, ptr %1, align 4
+  br label %3
+
+68:                                               ; preds = %3
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  %1 = alloca i32, align 4
+  %2 = alloca i32, align 4
+  %3 = alloca i32, align 4
+  %4 = alloca i32, align 4
+  %5 = alloca i32, align 4
+  store i32 0, ptr %1, align 4
+  store i32 0, ptr %2, align 4
+  br label %6
+
+6:                                                ; preds = %42, %0
+  %7 = load i32, ptr %2, align 4
+  %8 = icmp slt i32 %7, 512
+  br i1 %8, label %9, label %45
+
+9:                                                ; preds = %6
+  store i32 0, ptr %3, align 4
+  br label %10
+
+10:                                               ; preds = %38, %9
+  %11 = load i32, ptr %3, align 4
+  %12 = icmp slt i32 %11, 512
+  br i1 %12, label %13, label %41
+
+13:                                               ; preds = %10
+  %14 = load i32, ptr %2, align 4
+  %15 = load i32, ptr %3, align 4
+  %16 = add nsw i32 %14, %15
+  %17 = sub nsw i32 %14, %15
+  %18 = mul nsw i32 %14, %15
+  %19 = and i32 %18, 7
+  %20 = load i32, ptr %2, align 4
+  %21 = sext i32 %20 to i64
+  %22 = getelementptr inbounds [512 x [512 x i32]], ptr @A, i64 0, i64 %21
+  %23 = load i32, ptr %3, align 4
+  %24 = sext i32 %23 to i64
+  %25 = getelementptr inbounds [512 x i32], ptr %22, i64 0, i64 %24
+  store i32 %16, ptr %25, align 4
+  %26 = load i32, ptr %2, align 4
+  %27 = sext i32 %26 to i64
+  %28 = getelementptr inbounds [512 x [512 x i32]], ptr @B, i64 0, i64 %27
+  %29 = load i32, ptr %3, align 4
+  %30 = sext i32 %29 to i64
+  %31 = getelementptr inbounds [512 x i32], ptr %28, i64 0, i64 %30
+  store i32 %17, ptr %31, align 4
+  %32 = load i32, ptr %2, align 4
+  %33 = sext i32 %32 to i64
+  %34 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %33
+  %35 = load i32, ptr %3, align 4
+  %36 = sext i32 %35 to i64
+  %37 = getelementptr inbounds [512 x i32], ptr %34, i64 0, i64 %36
+  store i32 %19, ptr %37, align 4
+  br label %38
+
+38:                                               ; preds = %13
+  %39 = load i32, ptr %3, align 4
+  %40 = add nsw i32 %39, 1
+  store i32 %40, ptr %3, align 4
+  br label %10
+
+41:                                               ; preds = %10
+  br label %42
+
+42:                                               ; preds = %41
+  %43 = load i32, ptr %2, align 4
+  %44 = add nsw i32 %43, 1
+  store i32 %44, ptr %2, align 4
+  br label %6
+
+45:                                               ; preds = %6
+  store i32 0, ptr %4, align 4
+  br label %46
+
+46:                                               ; preds = %50, %45
+  %47 = load i32, ptr %4, align 4
+  %48 = icmp slt i32 %47, 1
+  br i1 %48, label %49, label %53
+
+49:                                               ; preds = %46
+  call void @matmul()
+  br label %50
+
+50:                                               ; preds = %49
+  %51 = load i32, ptr %4, align 4
+  %52 = add nsw i32 %51, 1
+  store i32 %52, ptr %4, align 4
+  br label %46
+
+53:                                               ; preds = %46
+  store i32 0, ptr %4, align 4
+  br label %54
+
+54:                                               ; preds = %58, %53
+  %55 = load i32, ptr %4, align 4
+  %56 = icmp slt i32 %55, 1
+  br i1 %56, label %57, label %61
+
+57:                                               ; preds = %54
+  call void @stencil()
+  br label %58
+
+58:                                               ; preds = %57
+  %59 = load i32, ptr %4, align 4
+  %60 = add nsw i32 %59, 1
+  store i32 %60, ptr %4, align 4
+  br label %54
+
+61:                                               ; preds = %54
+  store i32 0, ptr %5, align 4
+  store i32 0, ptr %2, align 4
+  br label %62
+
+62:                                               ; preds = %92, %61
+  %63 = load i32, ptr %2, align 4
+  %64 = icmp slt i32 %63, 512
+  br i1 %64, label %65, label %95
+
+65:                                               ; preds = %62
+  store i32 0, ptr %3, align 4
+  br label %66
+
+66:                                               ; preds = %88, %65
+  %67 = load i32, ptr %3, align 4
+  %68 = icmp slt i32 %67, 512
+  br i1 %68, label %69, label %91
+
+69:                                               ; preds = %66
+  %70 = load i32, ptr %2, align 4
+  %71 = sext i32 %70 to i64
+  %72 = getelementptr inbounds [512 x [512 x i32]], ptr @C, i64 0, i64 %71
+  %73 = load i32, ptr %3, align 4
+  %74 = sext i32 %73 to i64
+  %75 = getelementptr inbounds [512 x i32], ptr %72, i64 0, i64 %74
+  %76 = load i32, ptr %75, align 4
+  %77 = load i32, ptr %2, align 4
+  %78 = sext i32 %77 to i64
+  %79 = getelementptr inbounds [512 x [512 x i32]], ptr @Q, i64 0, i64 %78
+  %80 = load i32, ptr %3, align 4
+  %81 = sext i32 %80 to i64
+  %82 = getelementptr inbounds [512 x i32], ptr %79, i64 0, i64 %81
+  %83 = load i32, ptr %82, align 4
+  %84 = xor i32 %76, %83
+  %85 = load i32, ptr %5, align 4
+  %86 = mul i32 %85, 31
+  %87 = add i32 %86, %84
+  store i32 %87, ptr %5, align 4
+  br label %88
+
+88:                                               ; preds = %69
+  %89 = load i32, ptr %3, align 4
+  %90 = add nsw i32 %89, 1
+  store i32 %90, ptr %3, align 4
+  br label %66
+
+91:                                               ; preds = %66
+  br label %92
+
+92:                                               ; preds = %91
+  %93 = load i32, ptr %2, align 4
+  %94 = add nsw i32 %93, 1
+  store i32 %94, ptr %2, align 4
+  br label %62
+
+95:                                               ; preds = %62
+  %96 = load i32, ptr %5, align 4
+  %97 = and i32 %96, 255
+  ret i32 %97
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
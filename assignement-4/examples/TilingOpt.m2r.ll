@@ -0,0 +1,344 @@
+; ModuleID = 'Tiling.m2r.ll'
+source_filename = "Tiling.c"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-i128:128-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+@A = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@B = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@C = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@P = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+@Q = dso_local global [512 x [512 x i32]] zeroinitializer, align 16
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @matmul() #0 {
+  br label %tile.header
+
+tile.header:                                      ; preds = %0, %tile.latch
+  %.0.tile = phi i32 [ 0, %0 ], [ %.0.tile.next, %tile.latch ]
+  %1 = icmp slt i32 %.0.tile, 512
+  br i1 %1, label %tile.ph, label %47
+
+tile.ph:                                          ; preds = %tile.header
+  br label %tile.header1
+
+tile.header1:                                     ; preds = %tile.latch4, %tile.ph
+  %.01.tile = phi i32 [ 0, %tile.ph ], [ %.01.tile.next, %tile.latch4 ]
+  %2 = icmp slt i32 %.01.tile, 512
+  br i1 %2, label %tile.ph2, label %tile.latch
+
+tile.ph2:                                         ; preds = %tile.header1
+  br label %tile.header3
+
+tile.header3:                                     ; preds = %tile.latch5, %tile.ph2
+  %.02.tile = phi i32 [ 0, %tile.ph2 ], [ %.02.tile.next, %tile.latch5 ]
+  %3 = icmp slt i32 %.02.tile, 512
+  br i1 %3, label %tile.body, label %tile.latch4
+
+tile.body:                                        ; preds = %tile.header3
+  %4 = sub i32 512, %.0.tile
+  %5 = icmp ule i32 %4, 32
+  %6 = add i32 %.0.tile, 32
+  %tile.end = select i1 %5, i32 512, i32 %6
+  %7 = sub i32 512, %.01.tile
+  %8 = icmp ule i32 %7, 32
+  %9 = add i32 %.01.tile, 32
+  %tile.end6 = select i1 %8, i32 512, i32 %9
+  %10 = sub i32 512, %.02.tile
+  %11 = icmp ule i32 %10, 32
+  %12 = add i32 %.02.tile, 32
+  %tile.end7 = select i1 %11, i32 512, i32 %12
+  br label %13
+
+13:                                               ; preds = %tile.body, %45
+  %.0 = phi i32 [ %.0.tile, %tile.body ], [ %46, %45 ]
+  %14 = icmp slt i32 %.0, %tile.end
+  br i1 %14, label %15, label %tile.latch5
+
+15:                                               ; preds = %13
+  br label %16
+
+16:                                               ; preds = %42, %15
+  %.01 = phi i32 [ %.01.tile, %15 ], [ %43, %42 ]
+  %17 = icmp slt i32 %.01, %tile.end6
+  br i1 %17, label %18, label %44
+
+18:                                               ; preds = %16
+  br label %19
+
+19:                                               ; preds = %39, %18
+  %.02 = phi i32 [ %.02.tile, %18 ], [ %40, %39 ]
+  %20 = icmp slt i32 %.02, %tile.end7
+  br i1 %20, label %21, label %41
+
+21:                                               ; preds = %19
+  %22 = sext i32 %.0 to i64
+  %23 = getelementptr inbounds [512 x [512 x i32]], ptr @A, i64 0, i64 %22
+  %24 = sext i32 %.02 to i64
+  %25 = getelementptr inbounds [512 x i32], ptr %23, i64 0, i64 %24
+  %26 = load i32, ptr %25, align 4
+  %27 = sext i32 %.02 to i64
+  %28 = getelementptr inbounds [512 x [512 x i32]], ptr @B, i64 0, i64 %27
+  %29 = sext i32 %.01 to i64
+  %30 = getelementptr inbounds [512 x i32], ptr %28, i64 0, i64 %29
+  %31 = load i32, ptr %30, align 4
+  %32 = mul nsw i32 %26, %31
+  %33 = sext i32 %.0 to i64
+  %34 = getelementptr inbounds [512 x [512 x i32]], ptr @C, i64 0, i64 %33
+  %35 = sext i32 %.01 to i64
+  %36 = getelementptr inbounds [512 x i32], ptr %34, i64 0, i64 %35
+  %37 = load i32, ptr %36, align 4
+  %38 = add nsw i32 %37, %32
+  store i32 %38, ptr %36, align 4
+  br label %39
+
+39:                                               ; preds = %21
+  %40 = add nsw i32 %.02, 1
+  br label %19
+
+41:                                               ; preds = %19
+  br label %42
+
+42:                                               ; preds = %41
+  %43 = add nsw i32 %.01, 1
+  br label %16
+
+44:                                               ; preds = %16
+  br label %45
+
+45:                                               ; preds = %44
+  %46 = add nsw i32 %.0, 1
+  br label %13
+
+tile.latch:                                       ; preds = %tile.header1
+  %.0.tile.next = add i32 %.0.tile, 32
+  br label %tile.header
+
+tile.latch4:                                      ; preds = %tile.header3
+  %.01.tile.next = add i32 %.01.tile, 32
+  br label %tile.header1
+
+tile.latch5:                                      ; preds = %13
+  %.02.tile.next = add i32 %.02.tile, 32
+  br label %tile.header3
+
+47:                                               ; preds = %tile.header
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local void @stencil() #0 {
+  br label %1
+
+1:                                                ; preds = %48, %0
+  %.0 = phi i32 [ 1, %0 ], [ %49, %48 ]
+  %2 = icmp slt i32 %.0, 511
+  br i1 %2, label %3, label %50
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %45, %3
+  %.01 = phi i32 [ 1, %3 ], [ %46, %45 ]
+  %5 = icmp slt i32 %.01, 511
+  br i1 %5, label %6, label %47
+
+6:                                                ; preds = %4
+  %7 = sub nsw i32 %.0, 1
+  %8 = sext i32 %7 to i64
+  %9 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %8
+  %10 = sext i32 %.01 to i64
+  %11 = getelementptr inbounds [512 x i32], ptr %9, i64 0, i64 %10
+  %12 = load i32, ptr %11, align 4
+  %13 = add nsw i32 %.0, 1
+  %14 = sext i32 %13 to i64
+  %15 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %14
+  %16 = sext i32 %.01 to i64
+  %17 = getelementptr inbounds [512 x i32], ptr %15, i64 0, i64 %16
+  %18 = load i32, ptr %17, align 4
+  %19 = add nsw i32 %12, %18
+  %20 = sext i32 %.0 to i64
+  %21 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %20
+  %22 = sub nsw i32 %.01, 1
+  %23 = sext i32 %22 to i64
+  %24 = getelementptr inbounds [512 x i32], ptr %21, i64 0, i64 %23
+  %25 = load i32, ptr %24, align 4
+  %26 = add nsw i32 %19, %25
+  %27 = sext i32 %.0 to i64
+  %28 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %27
+  %29 = add nsw i32 %.01, 1
+  %30 = sext i32 %29 to i64
+  %31 = getelementptr inbounds [512 x i32], ptr %28, i64 0, i64 %30
+  %32 = load i32, ptr %31, align 4
+  %33 = add nsw i32 %26, %32
+  %34 = sext i32 %.0 to i64
+  %35 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %34
+  %36 = sext i32 %.01 to i64
+  %37 = getelementptr inbounds [512 x i32], ptr %35, i64 0, i64 %36
+  %38 = load i32, ptr %37, align 4
+  %39 = mul nsw i32 4, %38
+  %40 = sub nsw i32 %33, %39
+  %41 = sext i32 %.0 to i64
+  %42 = getelementptr inbounds [512 x [512 x i32]], ptr @Q, i64 0, i64 %41
+  %43 = sext i32 %.01 to i64
+  %44 = getelementptr inbounds [512 x i32], ptr %42, i64 0, i64 %43
+  store i32 %40, ptr %44, align 4
+  br label %45
+
+45:                                               ; preds = %6
+  %46 = add nsw i32 %.01, 1
+  br label %4
+
+47:                                               ; preds = %4
+  br label %48
+
+48:                                               ; preds = %47
+  %49 = add nsw i32 %.0, 1
+  br label %1
+
+50:                                               ; preds = %1
+  ret void
+}
+
+; Function Attrs: noinline nounwind sspstrong uwtable
+define dso_local i32 @main() #0 {
+  br label %1
+
+1:                                                ; preds = %26, %0
+  %.01 = phi i32 [ 0, %0 ], [ %27, %26 ]
+  %2 = icmp slt i32 %.01, 512
+  br i1 %2, label %3, label %28
+
+3:                                                ; preds = %1
+  br label %4
+
+4:                                                ; preds = %23, %3
+  %.03 = phi i32 [ 0, %3 ], [ %24, %23 ]
+  %5 = icmp slt i32 %.03, 512
+  br i1 %5, label %6, label %25
+
+6:                                                ; preds = %4
+  %7 = add nsw i32 %.01, %.03
+  %8 = sub nsw i32 %.01, %.03
+  %9 = mul nsw i32 %.01, %.03
+  %10 = and i32 %9, 7
+  %11 = sext i32 %.01 to i64
+  %12 = getelementptr inbounds [512 x [512 x i32]], ptr @A, i64 0, i64 %11
+  %13 = sext i32 %.03 to i64
+  %14 = getelementptr inbounds [512 x i32], ptr %12, i64 0, i64 %13
+  store i32 %7, ptr %14, align 4
+  %15 = sext i32 %.01 to i64
+  %16 = getelementptr inbounds [512 x [512 x i32]], ptr @B, i64 0, i64 %15
+  %17 = sext i32 %.03 to i64
+  %18 = getelementptr inbounds [512 x i32], ptr %16, i64 0, i64 %17
+  store i32 %8, ptr %18, align 4
+  %19 = sext i32 %.01 to i64
+  %20 = getelementptr inbounds [512 x [512 x i32]], ptr @P, i64 0, i64 %19
+  %21 = sext i32 %.03 to i64
+  %22 = getelementptr inbounds [512 x i32], ptr %20, i64 0, i64 %21
+  store i32 %10, ptr %22, align 4
+  br label %23
+
+23:                                               ; preds = %6
+  %24 = add nsw i32 %.03, 1
+  br label %4
+
+25:                                               ; preds = %4
+  br label %26
+
+26:                                               ; preds = %25
+  %27 = add nsw i32 %.01, 1
+  br label %1
+
+28:                                               ; preds = %1
+  br label %29
+
+29:                                               ; preds = %32, %28
+  %.05 = phi i32 [ 0, %28 ], [ %33, %32 ]
+  %30 = icmp slt i32 %.05, 1
+  br i1 %30, label %31, label %34
+
+31:                                               ; preds = %29
+  call void @matmul()
+  br label %32
+
+32:                                               ; preds = %31
+  %33 = add nsw i32 %.05, 1
+  br label %29
+
+34:                                               ; preds = %29
+  br label %35
+
+35:                                               ; preds = %38, %34
+  %.16 = phi i32 [ 0, %34 ], [ %39, %38 ]
+  %36 = icmp slt i32 %.16, 1
+  br i1 %36, label %37, label %40
+
+37:                                               ; preds = %35
+  call void @stencil()
+  br label %38
+
+38:                                               ; preds = %37
+  %39 = add nsw i32 %.16, 1
+  br label %35
+
+40:                                               ; preds = %35
+  br label %41
+
+41:                                               ; preds = %63, %40
+  %.12 = phi i32 [ 0, %40 ], [ %64, %63 ]
+  %.0 = phi i32 [ 0, %40 ], [ %.1, %63 ]
+  %42 = icmp slt i32 %.12, 512
+  br i1 %42, label %43, label %65
+
+43:                                               ; preds = %41
+  br label %44
+
+44:                                               ; preds = %60, %43
+  %.14 = phi i32 [ 0, %43 ], [ %61, %60 ]
+  %.1 = phi i32 [ %.0, %43 ], [ %59, %60 ]
+  %45 = icmp slt i32 %.14, 512
+  br i1 %45, label %46, label %62
+
+46:                                               ; preds = %44
+  %47 = sext i32 %.12 to i64
+  %48 = getelementptr inbounds [512 x [512 x i32]], ptr @C, i64 0, i64 %47
+  %49 = sext i32 %.14 to i64
+  %50 = getelementptr inbounds [512 x i32], ptr %48, i64 0, i64 %49
+  %51 = load i32, ptr %50, align 4
+  %52 = sext i32 %.12 to i64
+  %53 = getelementptr inbounds [512 x [512 x i32]], ptr @Q, i64 0, i64 %52
+  %54 = sext i32 %.14 to i64
+  %55 = getelementptr inbounds [512 x i32], ptr %53, i64 0, i64 %54
+  %56 = load i32, ptr %55, align 4
+  %57 = xor i32 %51, %56
+  %58 = mul i32 %.1, 31
+  %59 = add i32 %58, %57
+  br label %60
+
+60:                                               ; preds = %46
+  %61 = add nsw i32 %.14, 1
+  br label %44
+
+62:                                               ; preds = %44
+  br label %63
+
+63:                                               ; preds = %62
+  %64 = add nsw i32 %.12, 1
+  br label %41
+
+65:                                               ; preds = %41
+  %66 = and i32 %.0, 255
+  ret i32 %66
+}
+
+attributes #0 = { noinline nounwind sspstrong uwtable "frame-pointer"="all" "min-legal-vector-width"="0" "no-trapping-math"="true" "stack-protector-buffer-size"="8" "target-cpu"="x86-64" "target-features"="+cmov,+cx8,+fxsr,+mmx,+sse,+sse2,+x87" "tune-cpu"="generic" }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4}
+!llvm.ident = !{!5}
+
+!0 = !{i32 1, !"wchar_size", i32 4}
+!1 = !{i32 8, !"PIC Level", i32 2}
+!2 = !{i32 7, !"PIE Level", i32 2}
+!3 = !{i32 7, !"uwtable", i32 2}
+!4 = !{i32 7, !"frame-pointer", i32 2}
+!5 = !{!"clang version 19.1.7"}
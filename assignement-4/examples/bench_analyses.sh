@@ -0,0 +1,36 @@
+#!/bin/bash
+# Conta quante volte le analisi vengono ricalcolate in una pipeline che usa
+# i pass dei tre assignment (con -debug-pass-manager). "prima" aggiunge
+# invalidate<all> dopo ogni pass del corso: era l'unico modo di non usare
+# analisi non aggiornate quando i pass restituivano PreservedAnalyses::all().
+# "dopo" si affida agli insiemi di analisi preservate dai pass.
+#
+#   ./bench_analyses.sh [file.ll]
+#
+# OPT sceglie l'opt di LLVM da usare; i plugin vengono cercati nelle
+# cartelle build dei tre assignment.
+set -e
+cd "$(dirname "$0")"
+INPUT=${1:-ChainLoop.m2r.ll}
+OPT=${OPT:-opt}
+ROOT=../..
+PLUGINS=(-load-pass-plugin=$ROOT/assignement-1/build/libAssignement1.so
+         -load-pass-plugin=$ROOT/assignement-3/build/libAssignement3.so
+         -load-pass-plugin=$ROOT/assignement-4/build/libAssignement4.so)
+
+# I pass del corso sono seguiti da @ (dove "prima" invalida tutto)
+PIPELINE='function(all@,loop(loop-invariant)@,loop-fusion1@,loop(indvars,loop-invariant)@,all@,licm)'
+
+count() {
+  "$OPT" "${PLUGINS[@]}" -passes="$1" -debug-pass-manager "$INPUT" -o /dev/null 2>&1 |
+    sed -nE 's/^ *Running analysis: ([^ ]+) on .*/\1/p' | sort | uniq -c
+}
+
+before=$(count "$(echo "$PIPELINE" | sed 's/@/,invalidate<all>/g')")
+after=$(count "$(echo "$PIPELINE" | sed 's/@//g')")
+
+printf "%-45s %8s %8s\n" "Analisi" "prima" "dopo"
+join -1 2 -2 2 -a 1 -a 2 -e 0 -o 0,1.1,2.1 \
+  <(echo "$before" | sort -k2) <(echo "$after" | sort -k2) |
+  awk '{ printf "%-45s %8d %8d\n", $1, $2, $3; b += $2; a += $3 }
+       END { printf "%-45s %8d %8d\n", "Totale", b, a }'